@@ -3,8 +3,25 @@
 // INFO: Convenience Header to be used by Applications that use Flux
 
 #include "Flux/Application.h"
+#include "Flux/Assets/AssetManager.h"
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Input/Input.h"
 #include "Flux/Layer/Layer.h"
 #include "Flux/Logging/Log.h"
+#include "Flux/Math/BatchMath.h"
+#include "Flux/Math/Matrix4x4.h"
+#include "Flux/Memory/Memory.h"
+#include "Flux/Memory/Pool.h"
+#include "Flux/Particles/ParticleSystem.h"
+#include "Flux/Physics/PhysicsWorld.h"
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Renderer/Renderer2D.h"
+#include "Flux/Renderer/TextureAtlas.h"
+#include "Flux/Scene/Components.h"
+#include "Flux/Scene/Entity.h"
+#include "Flux/Scene/Scene.h"
+#include "Flux/Scene/SceneSerializer.h"
+#include "Flux/Simulation/SimulationHost.h"
 
 // INFO: Entry Point for the Application
 #include "Flux/EntryPoint.h"
\ No newline at end of file
@@ -3,18 +3,107 @@
 #include "Application.h"
 
 #include "Flux/Events/ApplicationEvent.h"
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Memory/Memory.h"
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Renderer/NullRenderBackend.h"
+#include "Flux/Renderer/SFMLRenderBackend.h"
+
+#include <charconv>
+#include <chrono>
+#include <cstring>
 
 namespace Flux
 {
-	Application::Application() : isRunning(false)
+	bool ApplicationCommandLineArgs::GetNumberOption(std::string_view option, uint32_t& value, uint32_t minimum) const
+	{
+		const char* text = GetOption(option);
+		if (text == nullptr) { return true; }
+
+		uint32_t number = 0;
+		const char* end = text + std::strlen(text);
+		const auto [parsedEnd, error] = std::from_chars(text, end, number);
+		if (error != std::errc() || parsedEnd != end || text == end || number < minimum) { return false; }
+
+		value = number;
+		return true;
+	}
+
+	ApplicationSpecification ApplicationSpecification::FromCommandLine(const ApplicationCommandLineArgs& args)
+	{
+		ApplicationSpecification specification;
+		specification.headless = args.HasFlag("--headless") || args.GetOption("--instances") != nullptr;
+		specification.renderThread = args.HasFlag("--render-thread");
+
+		// INFO: The EntryPoint Rejects a Bad Value before any Application is Created, Anything Else Keeps the Default
+		args.GetNumberOption("--tick-rate", specification.tickRate);
+
+		return specification;
+	}
+
+	Application::Application() : Application(ApplicationSpecification::FromCommandLine(GetCommandLineArgs()))
+	{
+	}
+
+	Application::Application(const ApplicationSpecification& specification) : specification(specification), isRunning(false)
 	{
-		window = std::make_unique<Window>();
+		// INFO: Shared Worker Pool for Layers, Scenes, Physics and Asset Loading
+		JobSystem::Initialise();
+		Memory::Initialise();
+
+		const ApplicationCommandLineArgs& commandLineArgs = GetCommandLineArgs();
+
+		// INFO: Replaying Swaps the Native Window for a Headless one Fed from the Recording
+		WindowProperties windowProperties;
+		windowProperties.headless = specification.headless;
+		if (const char* replayFilepath = commandLineArgs.GetOption("--replay")) { windowProperties.replayFilepath = replayFilepath; }
+
+		window = Window::Create(windowProperties);
 		FLUX_CORE_ASSERT(window != nullptr, "Failed to create Flux Window!");
-		window->SetEventCallback(BIND_EVENT_FUNCTION(Application::OnEvent));
+
+		// INFO: Headless Windows have No Input to Record
+		const char* recordFilepath = commandLineArgs.GetOption("--record");
+		if (recordFilepath != nullptr && !specification.headless)
+		{
+			inputRecorder = std::make_unique<InputRecorder>(recordFilepath, window->GetWidth(), window->GetHeight());
+			window->SetInputRecorder(inputRecorder.get());
+		}
+
+		// INFO: A Headless Tick is One Fixed Step, so the Tick Rate is the Simulation Rate
+		if (specification.headless && specification.tickRate > 0) { frameClock.SetFixedTimestep(1.0f / static_cast<float>(specification.tickRate)); }
+
+		// INFO: Nothing is Presented Headless, so Pacing Precision isn't Worth a Spinning Core
+		framePacer.SetSpinWaitEnabled(!specification.headless);
+
+		// INFO: Headless Windows (e.g. Replay) Still Run the Renderer's CPU Side, Against a Null Backend
+		if (sf::RenderWindow* nativeWindow = window->GetNativeWindow()) { renderer2D = std::make_unique<Renderer2D>(std::make_unique<SFMLRenderBackend>(*nativeWindow)); }
+		else { renderer2D = std::make_unique<Renderer2D>(std::make_unique<NullRenderBackend>()); }
+
+		renderer2D->SetRenderThreadEnabled(specification.renderThread);
+
+		// INFO: Window Events are Queued on the Bus and Dispatched Once per Frame, Polled Input is Filled as they are Emitted
+		window->SetEventBus(&eventBus);
+		window->SetInput(&input);
+		eventBus.SubscribeAll(this);
 
 		isRunning = true;
 	}
 
+	Application::~Application()
+	{
+		// INFO: The Last Frame is Presented Before the Job System it Generates Vertices on and the Window are Gone
+		renderer2D->SetRenderThreadEnabled(false);
+
+		if (inputRecorder != nullptr)
+		{
+			window->SetInputRecorder(nullptr);
+			inputRecorder->Finish(window->GetFrameIndex());
+		}
+
+		Memory::Shutdown();
+		JobSystem::Shutdown();
+	}
+
 	void Application::OnEvent(Event& event)
 	{
 		EventDispatcher dispatcher(event);
@@ -29,13 +118,59 @@ namespace Flux
 
 	void Application::Run()
 	{
+		FLUX_PROFILE_FUNCTION();
+
+		frameClock.Reset();
+		framePacer.Reset();
+
 		while (isRunning)
 		{
-			layerManager.Update();
-			window->Update();
+			// INFO: Windowed Frames Follow the Window's Framerate Limit (0 = None, VSync Still Applies), Headless the Tick Rate
+			framePacer.SetTargetRate(specification.headless ? specification.tickRate : window->GetFramerateLimit());
+			framePacer.Wait();
+
+			Tick();
+
+			// INFO: With the Render Thread this is the Hand-off, the Present Follows within a Frame
+			framePacer.MarkPresented();
+
+			FLUX_PROFILE_END_FRAME();
 		}
 	}
 
+	void Application::Tick()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		const std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+
+		// INFO: Input is Sampled First, Straight after the Frame Pacer's Wait, so it is as Fresh as Possible when the Frame is Presented
+		window->Update();
+		eventBus.Dispatch();
+
+		// INFO: Headless Ticks Always Advance by One Whole Fixed Step, Whether Paced or Uncapped
+		Timestep deltaTime = specification.headless ? frameClock.Advance(frameClock.GetFixedTimestep()) : frameClock.Tick();
+
+		// INFO: Finalises Background Loads within its Frame Budget, so they are Visible to this Frame's Update
+		assetManager.Update();
+
+		// INFO: Fixed Rate Simulation (Catches up on Accumulated Time, Capped per Frame by the FrameClock)
+		while (frameClock.StepFixed())
+		{
+			FLUX_PROFILE_SCOPE("Application::FixedUpdate");
+			layerManager.FixedUpdate(frameClock.GetFixedTimestep());
+		}
+
+		// INFO: Variable Rate Update and Interpolated Render
+		layerManager.Update(deltaTime);
+
+		renderer2D->BeginFrame();
+		layerManager.Render(*renderer2D, frameClock.GetInterpolationAlpha());
+		renderer2D->EndFrame();
+
+		tickStats.Record(std::chrono::duration<double>(std::chrono::steady_clock::now() - tickStart).count());
+	}
+
 	bool Application::OnWindowClose(WindowCloseEvent& event)
 	{
 		isRunning = false;
@@ -2,38 +2,151 @@
 
 #include "Core.h"
 
+#include <cstdint>
 #include <memory>
+#include <string_view>
 
+#include "Assets/AssetManager.h"
+#include "Events/EventBus.h"
+#include "Input/Input.h"
 #include "Layer/LayerManager.h"
+#include "Renderer/Renderer2D.h"
+#include "Time/FrameClock.h"
+#include "Time/FramePacer.h"
+#include "Time/TickStats.h"
 #include "Window/Window.h"
 
 namespace Flux
 {
 	class WindowCloseEvent;
 
+	struct ApplicationCommandLineArgs
+	{
+		int count = 0;
+		char** args = nullptr;
+
+		/// <summary>
+		/// Returns the argument following the given option (e.g. "--replay file.fxr"), or nullptr if it wasn't passed
+		/// </summary>
+		const char* GetOption(std::string_view option) const
+		{
+			for (int i = 0; i + 1 < count; ++i)
+			{
+				if (option == args[i]) { return args[i + 1]; }
+			}
+			return nullptr;
+		}
+
+		/// <summary>
+		/// Returns true if the option was passed on its own (e.g. "--headless")
+		/// </summary>
+		bool HasFlag(std::string_view flag) const
+		{
+			for (int i = 1; i < count; ++i)
+			{
+				if (flag == args[i]) { return true; }
+			}
+			return false;
+		}
+
+		/// <summary>
+		/// Reads the value following the option as a whole number of at least minimum, value is left as it was if the option wasn't passed.
+		/// Returns false if it was passed with anything else (e.g. "abc", "-1", "4x" or below the minimum).
+		/// </summary>
+		bool GetNumberOption(std::string_view option, uint32_t& value, uint32_t minimum = 0) const;
+	};
+
+	struct ApplicationSpecification
+	{
+		// INFO: No native window, input or presenting, every tick advances the simulation by exactly one fixed step
+		bool headless = false;
+
+		// INFO: Headless only, fixed steps per second of wall time (0 = Uncapped, as fast as the simulation runs)
+		unsigned int tickRate = 60;
+
+		// INFO: Draw and Present the Previous Frame on a Dedicated Thread while the Next is Simulated (See Renderer2D)
+		bool renderThread = false;
+
+		/// <summary>
+		/// Supports --headless, --tick-rate <rate> and --render-thread, --instances <count> implies --headless
+		/// </summary>
+		static ApplicationSpecification FromCommandLine(const ApplicationCommandLineArgs& args);
+	};
+
 	class Application : public IEventListener
 	{
 	public:
+		/// <summary>
+		/// Configured from the command line arguments
+		/// </summary>
 		Application();
-		virtual ~Application() = default;
+		Application(const ApplicationSpecification& specification);
+		virtual ~Application();
+
+		/// <summary>
+		/// Set by the entry point before the application is created, supports --record <file>, --replay <file> and the ApplicationSpecification options
+		/// </summary>
+		static void SetCommandLineArgs(const ApplicationCommandLineArgs& args) { GetCommandLineArgsStorage() = args; }
+		static const ApplicationCommandLineArgs& GetCommandLineArgs() { return GetCommandLineArgsStorage(); }
 
 		virtual void OnEvent(Event& event) override;
 
+		/// <summary>
+		/// Ticks until the window closes or Close is called, paced to the window's framerate limit (or the tick rate when headless)
+		/// </summary>
 		void Run();
 
+		/// <summary>
+		/// A single frame, without the per-process bookkeeping Run does around it (Frame arena reset, profiler frame).
+		/// Used by hosts driving several applications (e.g. SimulationHost), calls for one application must not overlap.
+		/// </summary>
+		void Tick();
+
+		void Close() { isRunning = false; }
+		bool IsRunning() const { return isRunning; }
+
+		const ApplicationSpecification& GetSpecification() const { return specification; }
+		bool IsHeadless() const { return specification.headless; }
+
+		/// <summary>
+		/// Wall time spent in each Tick
+		/// </summary>
+		const TickStats& GetTickStats() const { return tickStats; }
+
 		void PushLayer(Layer* layer) { layerManager.PushLayer(layer); }
 		void PushOverlay(Layer* overlay) { layerManager.PushOverlay(overlay); }
 
 		std::unique_ptr<Window>& GetWindow() { return window; }
+		EventBus& GetEventBus() { return eventBus; }
+		Input& GetInput() { return input; }
+		AssetManager& GetAssetManager() { return assetManager; }
+		FrameClock& GetFrameClock() { return frameClock; }
+		FramePacer& GetFramePacer() { return framePacer; }
+		Renderer2D& GetRenderer2D() { return *renderer2D; }
 
 	private:
 		bool OnWindowClose(WindowCloseEvent& event);
 
+		static ApplicationCommandLineArgs& GetCommandLineArgsStorage()
+		{
+			static ApplicationCommandLineArgs commandLineArgs;
+			return commandLineArgs;
+		}
+
 	private:
+		ApplicationSpecification specification;
 		bool isRunning;
 
 		std::unique_ptr<Window> window;
+		std::unique_ptr<InputRecorder> inputRecorder;
+		std::unique_ptr<Renderer2D> renderer2D;
+		EventBus eventBus;
+		Input input;
+		AssetManager assetManager; // Declared before the layers so it outlives the handles they hold
 		LayerManager layerManager;
+		FrameClock frameClock;
+		FramePacer framePacer;
+		TickStats tickStats;
 	};
 
 	// INFO: Defined by client to create custom entry point 
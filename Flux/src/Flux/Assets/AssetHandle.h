@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+
+namespace Flux
+{
+	enum class AssetState : uint8_t
+	{
+		Loading,	// Decoding on a worker or waiting to be finalised on the main thread
+		Ready,
+		Failed
+	};
+
+	enum class AssetFinaliseResult
+	{
+		Pending,	// More work left, Finalise is called again (Possibly next frame)
+		Finished,
+		Failed
+	};
+
+	/// <summary>
+	/// Shared state of one loaded file, owned by the AssetManager and kept alive by the handles pointing at it
+	/// </summary>
+	class AssetSlot
+	{
+	public:
+		AssetSlot(const std::filesystem::path& filepath, const std::atomic<uint64_t>& frameIndex) : filepath(filepath), frameIndex(frameIndex) {}
+		virtual ~AssetSlot() = default;
+
+		AssetSlot(const AssetSlot&) = delete;
+		AssetSlot& operator=(const AssetSlot&) = delete;
+
+		/// <summary>
+		/// Worker thread, reads and decodes the file into CPU memory without touching the live asset
+		/// </summary>
+		virtual bool Decode() = 0;
+
+		/// <summary>
+		/// Main thread, turns the decoded data into the live asset (e.g. GPU upload) in small slices so it fits the frame budget
+		/// </summary>
+		virtual AssetFinaliseResult Finalise() = 0;
+
+		/// <summary>
+		/// Bytes held by the live asset, counted against the AssetManager's cache budget once unreferenced
+		/// </summary>
+		virtual size_t GetMemorySize() const = 0;
+
+		const std::filesystem::path& GetFilepath() const { return filepath; }
+		AssetState GetState() const { return state.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// True once the first load has finished, stays true (Showing the old data) while hot reloading
+		/// </summary>
+		bool IsLoaded() const { return isLoaded.load(std::memory_order_acquire); }
+		uint32_t GetVersion() const { return version.load(std::memory_order_acquire); }
+		uint32_t GetReferenceCount() const { return referenceCount.load(std::memory_order_acquire); }
+
+	private:
+		friend class AssetManager;
+		template<typename T> friend class AssetHandle;
+
+		void AddReference() { referenceCount.fetch_add(1, std::memory_order_relaxed); }
+
+		void Release()
+		{
+			// INFO: Stamped before Letting Go, Once the Count Hits Zero the Manager may Evict the Slot
+			lastReleasedFrame.store(frameIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			referenceCount.fetch_sub(1, std::memory_order_release);
+		}
+
+	private:
+		std::filesystem::path filepath;
+		const std::atomic<uint64_t>& frameIndex;
+
+		std::atomic<uint32_t> referenceCount = 0;
+		std::atomic<uint64_t> lastReleasedFrame = 0;
+
+		std::atomic<AssetState> state = AssetState::Loading;
+		std::atomic<bool> isLoaded = false;
+		std::atomic<uint32_t> version = 0;
+
+		bool isReloadRequested = false; // Main thread only
+	};
+
+	/// <summary>
+	/// Slot holding a live asset of type T
+	/// </summary>
+	template<typename T>
+	class Asset : public AssetSlot
+	{
+	public:
+		using AssetSlot::AssetSlot;
+
+		const T& Get() const { return asset; }
+
+	protected:
+		T asset;
+	};
+
+	/// <summary>
+	/// Reference counted handle returned immediately by AssetManager::Load, Get returns nullptr until the asset has loaded.
+	/// Read assets on the main thread, hot reloads replace them in place there. The manager must outlive its handles.
+	/// </summary>
+	template<typename T>
+	class AssetHandle
+	{
+	public:
+		AssetHandle() = default;
+
+		AssetHandle(const AssetHandle& other) : slot(other.slot)
+		{
+			if (slot != nullptr) { slot->AddReference(); }
+		}
+
+		AssetHandle(AssetHandle&& other) noexcept : slot(std::exchange(other.slot, nullptr)) {}
+
+		AssetHandle& operator=(AssetHandle other) noexcept
+		{
+			std::swap(slot, other.slot);
+			return *this;
+		}
+
+		~AssetHandle() { Reset(); }
+
+		void Reset()
+		{
+			if (slot != nullptr) { slot->Release(); }
+			slot = nullptr;
+		}
+
+		const T* Get() const { return IsLoaded() ? &static_cast<const Asset<T>*>(slot)->Get() : nullptr; }
+		const T* operator->() const { return Get(); }
+
+		bool IsLoaded() const { return slot != nullptr && slot->IsLoaded(); }
+		bool IsFailed() const { return slot != nullptr && slot->GetState() == AssetState::Failed; }
+
+		/// <summary>
+		/// Increases every time the asset finishes loading, compare against a stored version to notice hot reloads
+		/// </summary>
+		uint32_t GetVersion() const { return slot != nullptr ? slot->GetVersion() : 0; }
+		const std::filesystem::path& GetFilepath() const { return slot->GetFilepath(); }
+
+		explicit operator bool() const { return slot != nullptr; }
+
+		bool operator==(const AssetHandle& other) const { return slot == other.slot; }
+
+	private:
+		friend class AssetManager;
+
+		// INFO: Adopts a Reference the Manager Already Took
+		explicit AssetHandle(AssetSlot* slot) : slot(slot) {}
+
+	private:
+		AssetSlot* slot = nullptr;
+	};
+}
\ No newline at end of file
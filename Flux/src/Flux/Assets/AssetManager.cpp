@@ -0,0 +1,224 @@
+#include "FluxPCH.h"
+
+#include "AssetManager.h"
+
+#include <format>
+
+#include "Flux/Memory/Memory.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	AssetManager::AssetManager(const AssetManagerSpecification& specification) : specification(specification),
+		pendingCount(0), frameIndex(0), cachedMemory(0)
+	{
+	}
+
+	AssetManager::~AssetManager()
+	{
+		// INFO: Decode Jobs Hold Slot Pointers
+		JobSystem::Wait(decodeCounter);
+
+		std::scoped_lock lock(slotMutex);
+		for (const auto& [key, slot] : slots)
+		{
+			FLUX_CORE_ASSERT(slot->GetReferenceCount() == 0, std::format("Asset is still referenced as the AssetManager is destroyed: {0}", key));
+		}
+	}
+
+	void AssetManager::Update()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		frameIndex.fetch_add(1, std::memory_order_relaxed);
+
+		FinaliseLoads(specification.frameBudget);
+		if (specification.enableHotReload) { ReloadChangedFiles(); }
+		EvictUnused();
+	}
+
+	void AssetManager::FinishLoading()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		while (GetPendingCount() > 0)
+		{
+			JobSystem::Wait(decodeCounter);
+			FinaliseLoads(std::chrono::steady_clock::duration::max());
+		}
+	}
+
+	size_t AssetManager::GetAssetCount() const
+	{
+		std::scoped_lock lock(slotMutex);
+		return slots.size();
+	}
+
+	AssetSlot* AssetManager::Acquire(std::string_view typeName, const std::filesystem::path& filepath, SlotFactory factory)
+	{
+		const std::filesystem::path normalisedPath = filepath.lexically_normal();
+
+		std::string key;
+		key.reserve(typeName.size() + normalisedPath.native().size() + 1);
+		key.append(typeName).append(":").append(normalisedPath.generic_string());
+
+		AssetSlot* slot = nullptr;
+		bool isNewSlot = false;
+		{
+			std::scoped_lock lock(slotMutex);
+
+			auto [it, isInserted] = slots.try_emplace(std::move(key));
+			if (isInserted)
+			{
+				it->second = factory(normalisedPath, frameIndex);
+				if (specification.enableHotReload) { fileWatcher.Watch(normalisedPath); }
+			}
+
+			slot = it->second.get();
+			slot->AddReference();
+			isNewSlot = isInserted;
+		}
+
+		if (isNewSlot) { StartDecode(slot); }
+		return slot;
+	}
+
+	void AssetManager::StartDecode(AssetSlot* slot)
+	{
+		slot->state.store(AssetState::Loading, std::memory_order_release);
+		pendingCount.fetch_add(1, std::memory_order_relaxed);
+
+		JobSystem::Run([this, slot]()
+		{
+			FLUX_PROFILE_SCOPE("AssetManager::Decode");
+
+			const bool isDecoded = slot->Decode();
+			if (!isDecoded) { FLUX_CORE_ERROR("Failed to load asset: {0}", slot->GetFilepath().string()); }
+
+			std::scoped_lock lock(finaliseMutex);
+			finaliseQueue.push_back({ slot, isDecoded });
+		}, &decodeCounter);
+	}
+
+	void AssetManager::CompleteLoad(AssetSlot* slot, bool isLoaded)
+	{
+		if (isLoaded)
+		{
+			slot->version.fetch_add(1, std::memory_order_release);
+			slot->isLoaded.store(true, std::memory_order_release);
+		}
+
+		pendingCount.fetch_sub(1, std::memory_order_release);
+
+		// INFO: The File Changed Again while it was Loading, what was Just Loaded is Already Stale
+		if (slot->isReloadRequested)
+		{
+			slot->isReloadRequested = false;
+			StartDecode(slot);
+			return;
+		}
+
+		// INFO: A Failed Reload Keeps the Previous Version
+		slot->state.store(slot->IsLoaded() ? AssetState::Ready : AssetState::Failed, std::memory_order_release);
+	}
+
+	void AssetManager::FinaliseLoads(std::chrono::steady_clock::duration budget)
+	{
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		while (true)
+		{
+			DecodedAsset decoded;
+			{
+				std::scoped_lock lock(finaliseMutex);
+				if (finaliseQueue.empty()) { break; }
+
+				decoded = finaliseQueue.front();
+			}
+
+			const AssetFinaliseResult result = decoded.isDecoded ? decoded.slot->Finalise() : AssetFinaliseResult::Failed;
+
+			if (result != AssetFinaliseResult::Pending)
+			{
+				{
+					std::scoped_lock lock(finaliseMutex);
+					finaliseQueue.pop_front();
+				}
+
+				if (decoded.isDecoded && result == AssetFinaliseResult::Failed) { FLUX_CORE_ERROR("Failed to finalise asset: {0}", decoded.slot->GetFilepath().string()); }
+				CompleteLoad(decoded.slot, result == AssetFinaliseResult::Finished);
+			}
+
+			if (std::chrono::steady_clock::now() - start >= budget) { break; }
+		}
+	}
+
+	void AssetManager::ReloadChangedFiles()
+	{
+		std::scoped_lock lock(slotMutex);
+
+		for (const std::filesystem::path& filepath : fileWatcher.PollChanges())
+		{
+			for (auto& [key, slot] : slots)
+			{
+				if (slot->GetFilepath() != filepath) { continue; }
+
+				FLUX_CORE_INFO("Reloading changed asset: {0}", key);
+
+				if (slot->GetState() == AssetState::Loading) { slot->isReloadRequested = true; }
+				else { StartDecode(slot.get()); }
+			}
+		}
+	}
+
+	void AssetManager::EvictUnused()
+	{
+		std::scoped_lock lock(slotMutex);
+
+		cachedMemory = 0;
+
+		for (auto it = slots.begin(); it != slots.end();)
+		{
+			const AssetSlot& slot = *it->second;
+
+			if (slot.GetReferenceCount() > 0 || slot.GetState() == AssetState::Loading)
+			{
+				++it;
+				continue;
+			}
+
+			// INFO: Failed Loads are Forgotten Once Nothing Refers to them, so Loading the Path Again Retries
+			if (slot.GetState() == AssetState::Failed)
+			{
+				if (specification.enableHotReload) { fileWatcher.Unwatch(slot.GetFilepath()); }
+				it = slots.erase(it);
+				continue;
+			}
+
+			cachedMemory += slot.GetMemorySize();
+			++it;
+		}
+
+		if (cachedMemory <= specification.cacheBudget) { return; }
+
+		// INFO: Over Budget, Unload the Assets Released Longest Ago First
+		ScratchScope scratch;
+		std::pmr::vector<std::pair<uint64_t, decltype(slots)::iterator>> candidates(scratch.GetResource());
+		for (auto it = slots.begin(); it != slots.end(); ++it)
+		{
+			const AssetSlot& slot = *it->second;
+			if (slot.GetReferenceCount() == 0 && slot.GetState() == AssetState::Ready) { candidates.emplace_back(slot.lastReleasedFrame.load(std::memory_order_relaxed), it); }
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		for (const auto& [lastReleasedFrame, it] : candidates)
+		{
+			if (cachedMemory <= specification.cacheBudget) { break; }
+
+			cachedMemory -= std::min(cachedMemory, it->second->GetMemorySize());
+			if (specification.enableHotReload) { fileWatcher.Unwatch(it->second->GetFilepath()); }
+			slots.erase(it);
+		}
+	}
+}
\ No newline at end of file
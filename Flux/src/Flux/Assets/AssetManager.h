@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "AssetHandle.h"
+#include "AssetTypes.h"
+#include "FileWatcher.h"
+#include "Flux/Jobs/JobSystem.h"
+
+namespace Flux
+{
+	struct AssetManagerSpecification
+	{
+		std::chrono::microseconds frameBudget = std::chrono::microseconds(2000);	// Main thread time per frame spent finalising loads
+		size_t cacheBudget = 256ull * 1024 * 1024;									// Bytes of unreferenced assets kept around before the least recently used are unloaded
+
+#ifdef FLUX_RELEASE
+		bool enableHotReload = false;
+#else
+		bool enableHotReload = true;
+#endif
+	};
+
+	/// <summary>
+	/// Loads assets without blocking the caller, files are decoded on the JobSystem and finalised (e.g. uploaded to the GPU) on
+	/// the main thread within a per-frame budget. Loads of the same file share one asset, unreferenced assets stay cached
+	/// until the cache budget is exceeded, and watched files are re-imported when they change on disk.
+	/// </summary>
+	class AssetManager
+	{
+	public:
+		AssetManager(const AssetManagerSpecification& specification = AssetManagerSpecification());
+		~AssetManager();
+
+		AssetManager(const AssetManager&) = delete;
+		AssetManager& operator=(const AssetManager&) = delete;
+
+		/// <summary>
+		/// Returns a handle straight away and starts loading the file unless it is already loaded or loading, thread-safe.
+		/// T is sf::Texture, sf::Image, sf::SoundBuffer or sf::Font (See AssetTraits).
+		/// </summary>
+		template<typename T>
+		AssetHandle<T> Load(const std::filesystem::path& filepath)
+		{
+			using Slot = typename AssetTraits<T>::Slot;
+
+			return AssetHandle<T>(Acquire(AssetTraits<T>::Name, filepath, [](const std::filesystem::path& path, const std::atomic<uint64_t>& frameIndex) -> std::unique_ptr<AssetSlot>
+			{
+				return std::make_unique<Slot>(path, frameIndex);
+			}));
+		}
+
+		/// <summary>
+		/// Once per frame on the main thread, finalises decoded assets until the frame budget runs out, starts hot reloads
+		/// and unloads the least recently released assets while the cache is over budget
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Blocks until every pending load has finished, ignoring the frame budget (e.g. behind a loading screen)
+		/// </summary>
+		void FinishLoading();
+
+		void SetFrameBudget(std::chrono::microseconds budget) { specification.frameBudget = budget; }
+		void SetCacheBudget(size_t bytes) { specification.cacheBudget = bytes; }
+
+		uint32_t GetPendingCount() const { return pendingCount.load(std::memory_order_acquire); }
+		size_t GetAssetCount() const;
+
+		/// <summary>
+		/// Bytes held by unreferenced assets as of the last Update
+		/// </summary>
+		size_t GetCachedMemory() const { return cachedMemory; }
+
+		const AssetManagerSpecification& GetSpecification() const { return specification; }
+
+	private:
+		using SlotFactory = std::unique_ptr<AssetSlot>(*)(const std::filesystem::path&, const std::atomic<uint64_t>&);
+
+		/// <summary>
+		/// Finds or creates the slot and takes a reference on it while the slots are locked, so it can't be evicted in between
+		/// </summary>
+		AssetSlot* Acquire(std::string_view typeName, const std::filesystem::path& filepath, SlotFactory factory);
+
+		void StartDecode(AssetSlot* slot);
+		void CompleteLoad(AssetSlot* slot, bool isLoaded);
+
+		void FinaliseLoads(std::chrono::steady_clock::duration budget);
+		void ReloadChangedFiles();
+		void EvictUnused();
+
+	private:
+		AssetManagerSpecification specification;
+
+		mutable std::mutex slotMutex; // Guards slots and fileWatcher
+		std::unordered_map<std::string, std::unique_ptr<AssetSlot>> slots; // Keyed by type name and normalised path
+		FileWatcher fileWatcher;
+
+		struct DecodedAsset
+		{
+			AssetSlot* slot;
+			bool isDecoded; // False if decoding failed, the main thread still completes the load so all state changes happen there
+		};
+
+		std::mutex finaliseMutex;
+		std::deque<DecodedAsset> finaliseQueue; // Only the main thread pops
+
+		JobCounter decodeCounter;
+		std::atomic<uint32_t> pendingCount;
+		std::atomic<uint64_t> frameIndex;
+
+		size_t cachedMemory;
+	};
+}
\ No newline at end of file
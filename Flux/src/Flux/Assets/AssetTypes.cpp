@@ -0,0 +1,135 @@
+#include "FluxPCH.h"
+
+#include "AssetTypes.h"
+
+#include <sfml/Audio/InputSoundFile.hpp>
+
+namespace Flux
+{
+	namespace
+	{
+		// INFO: Roughly a Quarter of a Millisecond of Upload per Slice on Typical Hardware
+		constexpr size_t TextureUploadSliceBytes = 256 * 1024;
+	}
+
+#pragma region Texture
+	bool TextureAsset::Decode()
+	{
+		return image.loadFromFile(GetFilepath());
+	}
+
+	AssetFinaliseResult TextureAsset::Finalise()
+	{
+		const sf::Vector2u size = image.getSize();
+
+		if (uploadedRows == 0)
+		{
+			staging = sf::Texture();
+			if (!staging.resize(size)) { return AssetFinaliseResult::Failed; }
+		}
+
+		const unsigned int rowBytes = size.x * 4;
+		const unsigned int sliceRows = std::max(1u, static_cast<unsigned int>(TextureUploadSliceBytes / std::max(rowBytes, 1u)));
+		const unsigned int rows = std::min(sliceRows, size.y - uploadedRows);
+
+		staging.update(image.getPixelsPtr() + static_cast<size_t>(uploadedRows) * rowBytes, sf::Vector2u(size.x, rows), sf::Vector2u(0, uploadedRows));
+		uploadedRows += rows;
+
+		if (uploadedRows < size.y) { return AssetFinaliseResult::Pending; }
+
+		// INFO: Keep the Sampling Settings Chosen for the Previous Version when Hot Reloading
+		staging.setSmooth(asset.isSmooth());
+		staging.setRepeated(asset.isRepeated());
+		asset.swap(staging);
+
+		staging = sf::Texture();
+		image = sf::Image();
+		uploadedRows = 0;
+
+		return AssetFinaliseResult::Finished;
+	}
+
+	size_t TextureAsset::GetMemorySize() const
+	{
+		const sf::Vector2u size = asset.getSize();
+		return static_cast<size_t>(size.x) * size.y * 4;
+	}
+#pragma endregion Texture
+
+#pragma region Image
+	bool ImageAsset::Decode()
+	{
+		return image.loadFromFile(GetFilepath());
+	}
+
+	AssetFinaliseResult ImageAsset::Finalise()
+	{
+		asset = std::move(image);
+		image = sf::Image();
+
+		return AssetFinaliseResult::Finished;
+	}
+
+	size_t ImageAsset::GetMemorySize() const
+	{
+		const sf::Vector2u size = asset.getSize();
+		return static_cast<size_t>(size.x) * size.y * 4;
+	}
+#pragma endregion Image
+
+#pragma region Sound
+	bool SoundAsset::Decode()
+	{
+		sf::InputSoundFile file;
+		if (!file.openFromFile(GetFilepath())) { return false; }
+
+		samples.resize(static_cast<size_t>(file.getSampleCount()));
+		samples.resize(static_cast<size_t>(file.read(samples.data(), samples.size())));
+
+		channelCount = file.getChannelCount();
+		sampleRate = file.getSampleRate();
+		channelMap = file.getChannelMap();
+
+		return true;
+	}
+
+	AssetFinaliseResult SoundAsset::Finalise()
+	{
+		const bool isLoaded = asset.loadFromSamples(samples.data(), samples.size(), channelCount, sampleRate, channelMap);
+
+		samples = std::vector<std::int16_t>();
+		channelMap.clear();
+
+		return isLoaded ? AssetFinaliseResult::Finished : AssetFinaliseResult::Failed;
+	}
+
+	size_t SoundAsset::GetMemorySize() const
+	{
+		return static_cast<size_t>(asset.getSampleCount()) * sizeof(std::int16_t);
+	}
+#pragma endregion Sound
+
+#pragma region Font
+	bool FontAsset::Decode()
+	{
+		std::ifstream file(GetFilepath(), std::ios::binary | std::ios::ate);
+		if (!file) { return false; }
+
+		decodedData.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(decodedData.data()), static_cast<std::streamsize>(decodedData.size())));
+	}
+
+	AssetFinaliseResult FontAsset::Finalise()
+	{
+		const bool isLoaded = asset.openFromMemory(decodedData.data(), decodedData.size());
+
+		// INFO: The Font Reads from this Memory from Now on, Moving the Vector Keeps the Buffer where it is
+		if (isLoaded) { fontData = std::move(decodedData); }
+		decodedData = std::vector<std::byte>();
+
+		return isLoaded ? AssetFinaliseResult::Finished : AssetFinaliseResult::Failed;
+	}
+#pragma endregion Font
+}
\ No newline at end of file
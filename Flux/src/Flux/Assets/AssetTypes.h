@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <sfml/Audio/SoundBuffer.hpp>
+#include <sfml/Audio/SoundChannel.hpp>
+#include <sfml/Graphics/Font.hpp>
+#include <sfml/Graphics/Image.hpp>
+#include <sfml/Graphics/Texture.hpp>
+
+#include "AssetHandle.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Decodes the image on a worker, then uploads it a band of rows at a time into a staging texture that is swapped in
+	/// once complete (Sprites keep pointing at the same sf::Texture across hot reloads)
+	/// </summary>
+	class TextureAsset final : public Asset<sf::Texture>
+	{
+	public:
+		using Asset::Asset;
+
+		virtual bool Decode() override;
+		virtual AssetFinaliseResult Finalise() override;
+		virtual size_t GetMemorySize() const override;
+
+	private:
+		sf::Image image;
+		sf::Texture staging;
+		unsigned int uploadedRows = 0;
+	};
+
+	/// <summary>
+	/// CPU side image, e.g. window icons or data read back by gameplay code
+	/// </summary>
+	class ImageAsset final : public Asset<sf::Image>
+	{
+	public:
+		using Asset::Asset;
+
+		virtual bool Decode() override;
+		virtual AssetFinaliseResult Finalise() override;
+		virtual size_t GetMemorySize() const override;
+
+	private:
+		sf::Image image;
+	};
+
+	/// <summary>
+	/// Fully decoded sound effect, stream long music tracks with sf::Music instead
+	/// </summary>
+	class SoundAsset final : public Asset<sf::SoundBuffer>
+	{
+	public:
+		using Asset::Asset;
+
+		virtual bool Decode() override;
+		virtual AssetFinaliseResult Finalise() override;
+		virtual size_t GetMemorySize() const override;
+
+	private:
+		std::vector<std::int16_t> samples;
+		unsigned int channelCount = 0;
+		unsigned int sampleRate = 0;
+		std::vector<sf::SoundChannel> channelMap;
+	};
+
+	/// <summary>
+	/// The file is read on a worker and kept in memory, sf::Font reads glyphs from it on demand
+	/// </summary>
+	class FontAsset final : public Asset<sf::Font>
+	{
+	public:
+		using Asset::Asset;
+
+		virtual bool Decode() override;
+		virtual AssetFinaliseResult Finalise() override;
+		virtual size_t GetMemorySize() const override { return fontData.size(); }
+
+	private:
+		std::vector<std::byte> decodedData;
+		std::vector<std::byte> fontData;
+	};
+
+	/// <summary>
+	/// Maps a loadable type to its slot, specialise it to add new asset types
+	/// </summary>
+	template<typename T>
+	struct AssetTraits;
+
+	template<>
+	struct AssetTraits<sf::Texture>
+	{
+		using Slot = TextureAsset;
+		static constexpr std::string_view Name = "Texture";
+	};
+
+	template<>
+	struct AssetTraits<sf::Image>
+	{
+		using Slot = ImageAsset;
+		static constexpr std::string_view Name = "Image";
+	};
+
+	template<>
+	struct AssetTraits<sf::SoundBuffer>
+	{
+		using Slot = SoundAsset;
+		static constexpr std::string_view Name = "Sound";
+	};
+
+	template<>
+	struct AssetTraits<sf::Font>
+	{
+		using Slot = FontAsset;
+		static constexpr std::string_view Name = "Font";
+	};
+}
\ No newline at end of file
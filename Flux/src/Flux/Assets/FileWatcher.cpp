@@ -0,0 +1,161 @@
+#include "FluxPCH.h"
+
+#include "FileWatcher.h"
+
+#ifdef FLUX_PLATFORM_LINUX
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Flux
+{
+#ifndef FLUX_PLATFORM_LINUX
+	namespace
+	{
+		constexpr size_t FilesCheckedPerPoll = 8;
+
+		std::filesystem::file_time_type GetLastWriteTime(const std::filesystem::path& filepath)
+		{
+			std::error_code error;
+			const std::filesystem::file_time_type time = std::filesystem::last_write_time(filepath, error);
+			return error ? std::filesystem::file_time_type::min() : time;
+		}
+	}
+#endif
+
+#ifdef FLUX_PLATFORM_LINUX
+	FileWatcher::FileWatcher() : inotifyDescriptor(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+	{
+		FLUX_CORE_VERIFY(inotifyDescriptor >= 0, "Failed to initialise inotify, hot reloading is disabled!");
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		if (inotifyDescriptor >= 0) { close(inotifyDescriptor); }
+	}
+
+	void FileWatcher::Watch(const std::filesystem::path& filepath)
+	{
+		const std::string key = GetKey(filepath);
+		WatchedFile& file = files[key];
+		if (file.referenceCount++ > 0 || inotifyDescriptor < 0) { return; }
+
+		file.filepath = key;
+
+		std::filesystem::path directoryPath = file.filepath.parent_path();
+		if (directoryPath.empty()) { directoryPath = "."; }
+
+		WatchedDirectory& directory = directories[directoryPath.generic_string()];
+		if (directory.fileCount++ > 0) { return; }
+
+		// INFO: Editors Often Save by Writing a Temporary and Renaming it over the Original, so Renames Count as Writes
+		directory.descriptor = inotify_add_watch(inotifyDescriptor, directoryPath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+		if (directory.descriptor >= 0) { directoryPaths[directory.descriptor] = directoryPath; }
+		else { FLUX_CORE_WARN("Failed to watch directory for changes: {0}", directoryPath.string()); }
+	}
+
+	void FileWatcher::Unwatch(const std::filesystem::path& filepath)
+	{
+		auto fileIt = files.find(GetKey(filepath));
+		if (fileIt == files.end() || --fileIt->second.referenceCount > 0) { return; }
+
+		std::filesystem::path directoryPath = fileIt->second.filepath.parent_path();
+		if (directoryPath.empty()) { directoryPath = "."; }
+
+		files.erase(fileIt);
+
+		auto directoryIt = directories.find(directoryPath.generic_string());
+		if (directoryIt == directories.end() || --directoryIt->second.fileCount > 0) { return; }
+
+		if (directoryIt->second.descriptor >= 0)
+		{
+			inotify_rm_watch(inotifyDescriptor, directoryIt->second.descriptor);
+			directoryPaths.erase(directoryIt->second.descriptor);
+		}
+
+		directories.erase(directoryIt);
+	}
+
+	std::vector<std::filesystem::path> FileWatcher::PollChanges()
+	{
+		std::vector<std::filesystem::path> changes;
+		if (inotifyDescriptor < 0) { return changes; }
+
+		alignas(inotify_event) char buffer[4096];
+
+		while (true)
+		{
+			const ssize_t length = read(inotifyDescriptor, buffer, sizeof(buffer));
+			if (length <= 0) { break; }
+
+			for (ssize_t offset = 0; offset < length;)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+				offset += sizeof(inotify_event) + event->len;
+
+				auto directoryIt = directoryPaths.find(event->wd);
+				if (event->len == 0 || directoryIt == directoryPaths.end()) { continue; }
+
+				// INFO: Other Files in the Same Directory Raise Events Too, Only Report the Watched Ones
+				auto fileIt = files.find(GetKey(directoryIt->second / event->name));
+				if (fileIt == files.end()) { continue; }
+
+				if (std::find(changes.begin(), changes.end(), fileIt->second.filepath) == changes.end()) { changes.push_back(fileIt->second.filepath); }
+			}
+		}
+
+		return changes;
+	}
+#else
+	FileWatcher::FileWatcher() : pollCursor(0)
+	{
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+	}
+
+	void FileWatcher::Watch(const std::filesystem::path& filepath)
+	{
+		const std::string key = GetKey(filepath);
+		WatchedFile& file = files[key];
+		if (file.referenceCount++ > 0) { return; }
+
+		file.filepath = key;
+		file.lastWriteTime = GetLastWriteTime(file.filepath);
+		pollOrder.push_back(key);
+	}
+
+	void FileWatcher::Unwatch(const std::filesystem::path& filepath)
+	{
+		const std::string key = GetKey(filepath);
+
+		auto fileIt = files.find(key);
+		if (fileIt == files.end() || --fileIt->second.referenceCount > 0) { return; }
+
+		files.erase(fileIt);
+		std::erase(pollOrder, key);
+	}
+
+	std::vector<std::filesystem::path> FileWatcher::PollChanges()
+	{
+		std::vector<std::filesystem::path> changes;
+
+		const size_t checkCount = std::min(FilesCheckedPerPoll, pollOrder.size());
+		for (size_t i = 0; i < checkCount; ++i)
+		{
+			pollCursor = (pollCursor + 1) % pollOrder.size();
+			WatchedFile& file = files[pollOrder[pollCursor]];
+
+			const std::filesystem::file_time_type lastWriteTime = GetLastWriteTime(file.filepath);
+			if (lastWriteTime != file.lastWriteTime)
+			{
+				file.lastWriteTime = lastWriteTime;
+				changes.push_back(file.filepath);
+			}
+		}
+
+		return changes;
+	}
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Flux
+{
+	/// <summary>
+	/// Reports writes to a set of watched files. Uses inotify on Linux (Directory watches filtered to the watched files),
+	/// elsewhere it compares write times of a few files per poll so no single frame pays for the whole set.
+	/// Not thread-safe, callers serialise access.
+	/// </summary>
+	class FileWatcher
+	{
+	public:
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		/// <summary>
+		/// Reference counted per file, every Watch needs a matching Unwatch
+		/// </summary>
+		void Watch(const std::filesystem::path& filepath);
+		void Unwatch(const std::filesystem::path& filepath);
+
+		/// <summary>
+		/// Non-blocking, returns the watched files changed since the last poll (Each at most once)
+		/// </summary>
+		std::vector<std::filesystem::path> PollChanges();
+
+	private:
+		struct WatchedFile
+		{
+			std::filesystem::path filepath;
+			uint32_t referenceCount = 0;
+			std::filesystem::file_time_type lastWriteTime;
+		};
+
+		static std::string GetKey(const std::filesystem::path& filepath) { return filepath.lexically_normal().generic_string(); }
+
+	private:
+		std::unordered_map<std::string, WatchedFile> files;
+
+#ifdef FLUX_PLATFORM_LINUX
+		struct WatchedDirectory
+		{
+			int descriptor = -1;
+			uint32_t fileCount = 0;
+		};
+
+		int inotifyDescriptor;
+		std::unordered_map<std::string, WatchedDirectory> directories;
+		std::unordered_map<int, std::filesystem::path> directoryPaths;
+#else
+		std::vector<std::string> pollOrder;
+		size_t pollCursor;
+#endif
+	};
+}
\ No newline at end of file
@@ -6,11 +6,18 @@ static constexpr int FLUX_FAILURE = 1;
 
 static constexpr bool FLUX_FAILED(int result) { return result != FLUX_SUCCESS; }
 
+// INFO: Breaks into an Attached Debugger (__debugbreak is MSVC Only)
+#ifdef _MSC_VER
+	#define FLUX_DEBUGBREAK() __debugbreak()
+#else
+	#define FLUX_DEBUGBREAK() __builtin_trap()
+#endif
+
 // INFO: Custom Assertion Macros
 #ifdef FLUX_ASSERTS_ENABLED
-	#define FLUX_MINIMAL_ASSERT(expression) if (!(expression)) { __debugbreak(); }
-	#define FLUX_CORE_ASSERT(expression, message) if (!(expression)) { FLUX_CORE_ERROR("Assertion Failed: {0}", message); __debugbreak(); }
-	#define FLUX_ASSERT(expression, message) if (!(expression)) { FLUX_ERROR("Assertion Failed: {0}", message); __debugbreak(); }
+	#define FLUX_MINIMAL_ASSERT(expression) if (!(expression)) { FLUX_DEBUGBREAK(); }
+	#define FLUX_CORE_ASSERT(expression, message) if (!(expression)) { FLUX_CORE_ERROR("Assertion Failed: {0}", message); FLUX_DEBUGBREAK(); }
+	#define FLUX_ASSERT(expression, message) if (!(expression)) { FLUX_ERROR("Assertion Failed: {0}", message); FLUX_DEBUGBREAK(); }
 #else
 	#define FLUX_MINIMAL_ASSERT(expression) ((void)0)
 	#define FLUX_CORE_ASSERT(expression, message) ((void)0)
@@ -2,17 +2,74 @@
 
 #include "Flux/Application.h"
 #include "Flux/Logging/Log.h"
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Simulation/SimulationHost.h"
 
-#ifdef FLUX_PLATFORM_WINDOWS
+#include <iostream>
+
+#if defined(FLUX_PLATFORM_WINDOWS) || defined(FLUX_PLATFORM_LINUX)
 
 extern std::unique_ptr<Flux::Application> Flux::CreateApplication();
 
 int main(int argc, char** argv)
 {
 	Flux::Log::Initialise();
+	Flux::Application::SetCommandLineArgs({ argc, argv });
+
+	const Flux::ApplicationCommandLineArgs& commandLineArgs = Flux::Application::GetCommandLineArgs();
+
+	// INFO: Numeric Options are Checked before Anything Starts, a Bad Value Stops Here rather than Running with the Default
+	uint32_t instanceCount = 0;
+	uint32_t workerThreadCount = 0;
+	uint32_t tickRate = 0;
+
+	const bool isValid = commandLineArgs.GetNumberOption("--instances", instanceCount, 1) &&
+						 commandLineArgs.GetNumberOption("--threads", workerThreadCount, 1) &&
+						 commandLineArgs.GetNumberOption("--tick-rate", tickRate);
+
+	if (!isValid)
+	{
+		std::cerr << "Invalid command line, --instances and --threads expect a whole number of at least 1, --tick-rate a whole number (0 = Uncapped)\n"
+					 "Usage: [--headless] [--tick-rate <rate>] [--render-thread] [--record <file>] [--replay <file>] [--instances <count> [--threads <count>]]\n";
+
+		Flux::Log::Shutdown();
+		return 1;
+	}
+
+	// INFO: --instances <count> Hosts that Many Headless Applications in this Process Instead of Running One
+	std::unique_ptr<Flux::SimulationHost> host;
+	std::unique_ptr<Flux::Application> app;
+
+	FLUX_PROFILE_BEGIN_SESSION("Startup", "FluxProfile-Startup.json");
+	if (instanceCount > 0)
+	{
+		host = std::make_unique<Flux::SimulationHost>(Flux::SimulationHostSpecification::FromCommandLine(commandLineArgs));
+		for (uint32_t i = 0; i < instanceCount; ++i) { host->AddInstance(Flux::CreateApplication()); }
+	}
+	else
+	{
+		app = Flux::CreateApplication();
+	}
+	FLUX_PROFILE_END_SESSION();
+
+	FLUX_PROFILE_BEGIN_SESSION("Runtime", "FluxProfile-Runtime.json");
+	if (host != nullptr)
+	{
+		host->Run();
+		host->LogTickStats();
+	}
+	else
+	{
+		app->Run();
+	}
+	FLUX_PROFILE_END_SESSION();
+
+	FLUX_PROFILE_BEGIN_SESSION("Shutdown", "FluxProfile-Shutdown.json");
+	host.reset();
+	app.reset();
+	FLUX_PROFILE_END_SESSION();
 
-	std::unique_ptr<Flux::Application> app = Flux::CreateApplication();
-	app->Run();
+	Flux::Log::Shutdown();
 
 	return 0;
 }
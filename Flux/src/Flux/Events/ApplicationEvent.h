@@ -2,7 +2,7 @@
 
 #include "Event.h"
 
-#include <sstream>
+#include <format>
 
 #include "Flux/Math/Vector2.h"
 
@@ -27,9 +27,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "WindowResizeEvent: " << width << ", " << height;
-			return ss.str();
+			return std::format("WindowResizeEvent: {0}, {1}", width, height);
 		}
 
 		EVENT_CLASS_TYPE(EventType::WindowResize);
@@ -67,9 +65,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "WindowMovedEvent: " << position;
-			return ss.str();
+			return std::format("WindowMovedEvent: {0}", position);
 		}
 
 		EVENT_CLASS_TYPE(EventType::WindowMoved);
@@ -2,9 +2,13 @@
 
 #include "Flux/Core.h"
 
+#include <cstdint>
 #include <string>
 #include <format>
 #include <functional>
+#include <utility>
+
+#include "Flux/Utility/Delegate.h"
 
 namespace Flux
 {
@@ -13,9 +17,20 @@ namespace Flux
 		None = 0,
 		WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved,	// Application Events
 		KeyPressed, KeyReleased,												// Keyboard Events
-		MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseWheelScrolled	// Mouse Events
+		MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseWheelScrolled,	// Mouse Events
+		Count																		// Number of Event Types (Keep Last)
 	};
 
+	static constexpr size_t EventTypeCount = static_cast<size_t>(EventType::Count);
+	static_assert(EventTypeCount <= 32, "EventType no longer fits into an EventTypeMask!");
+
+	using EventTypeMask = uint32_t;
+
+	constexpr EventTypeMask EventTypeBit(EventType type)
+	{
+		return static_cast<EventTypeMask>(1) << static_cast<uint32_t>(type);
+	}
+
 	enum class EventCategory
 	{
 		None			= 0,
@@ -60,7 +75,8 @@ namespace Flux
 		bool handled = false;
 	};
 
-#define BIND_EVENT_FUNCTION(fn) std::bind(&fn, this, std::placeholders::_1)
+// INFO: Captures only this, so it fits inline in a Delegate and can be inlined by EventDispatcher::Dispatch
+#define BIND_EVENT_FUNCTION(fn) [this](auto&&... args) -> decltype(auto) { return std::invoke(&fn, this, std::forward<decltype(args)>(args)...); }
 
 	class IEventListener
 	{
@@ -68,36 +84,48 @@ namespace Flux
 		virtual void OnEvent(Event& event) = 0;
 	};
 
+	class EventBus;
+
 	class EventEmitter
 	{
 	public:
-		using EventCallbackFunction = std::function<void(Event&)>;
+		using EventCallbackFunction = Delegate<void(Event&)>;
 
 		virtual ~EventEmitter() = default;
 
+		/// <summary>
+		/// Events are handed to the callback immediately, unless an EventBus is set in which case they are queued on it
+		/// </summary>
 		void SetEventCallback(const EventCallbackFunction& callback) { eventCallback = callback; }
+		void SetEventBus(EventBus* bus) { eventBus = bus; }
+
+	protected:
+		// INFO: Defined in EventBus.h
+		template<typename T, typename... Args>
+		void EmitEvent(Args&&... args);
 
 	protected:
 		EventCallbackFunction eventCallback;
+		EventBus* eventBus = nullptr;
 	};
 
 	class EventDispatcher
 	{
-		template<typename T>
-		using EventFunction = std::function<bool(T&)>;
-
 	public:
 		EventDispatcher(Event& event) : event(event) {}
 
-		template<typename T>
-		bool Dispatch(EventFunction<T> function);
+		/// <summary>
+		/// Calls function (any callable taking T& and returning bool) if the event is of type T
+		/// </summary>
+		template<typename T, typename F>
+		bool Dispatch(F&& function);
 
 	private:
 		Event& event;
 	};
 
-	template<typename T>
-	inline bool EventDispatcher::Dispatch(EventFunction<T> function)
+	template<typename T, typename F>
+	inline bool EventDispatcher::Dispatch(F&& function)
 	{
 		if (event.GetEventType() == T::GetStaticType())
 		{
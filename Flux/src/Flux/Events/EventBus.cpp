@@ -0,0 +1,115 @@
+#include "FluxPCH.h"
+
+#include "EventBus.h"
+
+#include <bit>
+
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	EventQueue::EventQueue(size_t initialCapacity) : capacity(std::bit_ceil(std::max<size_t>(initialCapacity, 1))), head(0), size(0)
+	{
+		slots = std::make_unique<EventSlot[]>(capacity);
+	}
+
+	EventQueue::~EventQueue()
+	{
+		Clear();
+	}
+
+	void EventQueue::PopFront(EventSlot& destination)
+	{
+		FLUX_CORE_ASSERT(size > 0, "Trying to pop an event from an empty EventQueue!");
+
+		EventSlot& slot = slots[head];
+		slot.relocate(destination, slot);
+
+		head = (head + 1) & (capacity - 1);
+		--size;
+	}
+
+	void EventQueue::Clear()
+	{
+		for (; size > 0; --size)
+		{
+			slots[head].Destroy();
+			head = (head + 1) & (capacity - 1);
+		}
+
+		head = 0;
+	}
+
+	void EventQueue::Grow()
+	{
+		const size_t newCapacity = capacity * 2;
+		auto newSlots = std::make_unique<EventSlot[]>(newCapacity);
+
+		// INFO: Unwrap the Ring into the Start of the New Storage
+		for (size_t i = 0; i < size; ++i)
+		{
+			EventSlot& slot = slots[(head + i) & (capacity - 1)];
+			slot.relocate(newSlots[i], slot);
+		}
+
+		slots = std::move(newSlots);
+		capacity = newCapacity;
+		head = 0;
+	}
+
+	void EventBus::Subscribe(EventType type, IEventListener* listener)
+	{
+		FLUX_CORE_ASSERT(listener != nullptr, "Trying to subscribe a null listener to the EventBus!");
+
+		auto& listeners = subscribers[static_cast<size_t>(type)];
+		if (std::find(listeners.begin(), listeners.end(), listener) == listeners.end())
+		{
+			listeners.push_back(listener);
+		}
+	}
+
+	void EventBus::SubscribeAll(IEventListener* listener)
+	{
+		for (size_t type = static_cast<size_t>(EventType::None) + 1; type < EventTypeCount; ++type)
+		{
+			Subscribe(static_cast<EventType>(type), listener);
+		}
+	}
+
+	void EventBus::Unsubscribe(EventType type, IEventListener* listener)
+	{
+		auto& listeners = subscribers[static_cast<size_t>(type)];
+		listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+	}
+
+	void EventBus::UnsubscribeAll(IEventListener* listener)
+	{
+		for (auto& listeners : subscribers)
+		{
+			listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+		}
+	}
+
+	void EventBus::Dispatch()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: Only Deliver what was Queued Before Dispatch, Anything Published by Listeners Waits for the Next Batch
+		EventSlot current;
+		for (size_t remaining = queue.GetSize(); remaining > 0; --remaining)
+		{
+			// INFO: Move the Event out First so Listeners can Publish (and Grow the Queue) Safely
+			queue.PopFront(current);
+			Event& event = current.Get();
+
+			const auto& listeners = subscribers[static_cast<size_t>(event.GetEventType())];
+			for (size_t i = 0; i < listeners.size(); ++i)
+			{
+				listeners[i]->OnEvent(event);
+				if (event.IsHandled()) { break; }
+			}
+
+			current.Destroy();
+		}
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "Event.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Storage large enough to hold any event by value
+	/// </summary>
+	struct EventSlot
+	{
+		static constexpr size_t MaxEventSize = 64;
+
+		using RelocateFunction = void(*)(EventSlot& destination, EventSlot& source);
+
+		alignas(std::max_align_t) std::byte storage[MaxEventSize];
+		RelocateFunction relocate = nullptr;
+
+		Event& Get() { return *std::launder(reinterpret_cast<Event*>(storage)); }
+
+		void Destroy()
+		{
+			Get().~Event();
+			relocate = nullptr;
+		}
+	};
+
+	/// <summary>
+	/// Growable ring buffer of events stored by value, events are moved (never copied) when the ring grows
+	/// </summary>
+	class EventQueue
+	{
+	public:
+		EventQueue(size_t initialCapacity = 256);
+		~EventQueue();
+
+		EventQueue(const EventQueue&) = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+
+		template<typename T, typename... Args>
+		void Push(Args&&... args);
+
+		/// <summary>
+		/// Moves the oldest event into destination and removes it from the queue
+		/// </summary>
+		void PopFront(EventSlot& destination);
+
+		void Clear();
+
+		size_t GetSize() const { return size; }
+		size_t GetCapacity() const { return capacity; }
+		bool IsEmpty() const { return size == 0; }
+
+	private:
+		template<typename T>
+		static void Relocate(EventSlot& destination, EventSlot& source);
+
+		void Grow();
+
+	private:
+		std::unique_ptr<EventSlot[]> slots;
+		size_t capacity;
+		size_t head;
+		size_t size;
+	};
+
+	/// <summary>
+	/// Queues events for the frame and dispatches them in one batch to the listeners subscribed to each event type
+	/// </summary>
+	class EventBus
+	{
+	public:
+		EventBus(size_t initialCapacity = 256) : queue(initialCapacity) {}
+
+		/// <summary>
+		/// Constructs the event in the queue, it is delivered on the next Dispatch
+		/// </summary>
+		template<typename T, typename... Args>
+		void Publish(Args&&... args) { queue.Push<T>(std::forward<Args>(args)...); }
+
+		/// <summary>
+		/// Listeners receive events in the order they subscribed, a handled event is not passed to later listeners
+		/// </summary>
+		void Subscribe(EventType type, IEventListener* listener);
+		void SubscribeAll(IEventListener* listener);
+		void Unsubscribe(EventType type, IEventListener* listener);
+		void UnsubscribeAll(IEventListener* listener);
+
+		/// <summary>
+		/// Delivers every event queued before the call, events published while dispatching are delivered next time
+		/// </summary>
+		void Dispatch();
+
+		size_t GetQueuedEventCount() const { return queue.GetSize(); }
+
+	private:
+		EventQueue queue;
+		std::array<std::vector<IEventListener*>, EventTypeCount> subscribers;
+	};
+
+	template<typename T, typename... Args>
+	inline void EventQueue::Push(Args&&... args)
+	{
+		static_assert(std::is_base_of_v<Event, T>, "EventQueue can only store types derived from Event!");
+		static_assert(sizeof(T) <= EventSlot::MaxEventSize, "Event type is too large for an EventSlot!");
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Event type is over-aligned for an EventSlot!");
+
+		if (size == capacity) { Grow(); }
+
+		EventSlot& slot = slots[(head + size) & (capacity - 1)];
+		new (slot.storage) T(std::forward<Args>(args)...);
+		slot.relocate = &Relocate<T>;
+		++size;
+	}
+
+	template<typename T>
+	inline void EventQueue::Relocate(EventSlot& destination, EventSlot& source)
+	{
+		T* sourceEvent = std::launder(reinterpret_cast<T*>(source.storage));
+		new (destination.storage) T(std::move(*sourceEvent));
+		destination.relocate = source.relocate;
+
+		sourceEvent->~T();
+		source.relocate = nullptr;
+	}
+
+	template<typename T, typename... Args>
+	inline void EventEmitter::EmitEvent(Args&&... args)
+	{
+		if (eventBus != nullptr)
+		{
+			eventBus->Publish<T>(std::forward<Args>(args)...);
+		}
+		else if (eventCallback)
+		{
+			T event(std::forward<Args>(args)...);
+			eventCallback(event);
+		}
+	}
+}
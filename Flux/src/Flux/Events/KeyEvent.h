@@ -2,7 +2,7 @@
 
 #include "Event.h"
 
-#include <sstream>
+#include <format>
 
 namespace Flux
 {
@@ -28,9 +28,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "KeyPressedEvent: " << keyCode << " (Repeat Count: " << repeatCount << ")";
-			return ss.str();
+			return std::format("KeyPressedEvent: {0} (Repeat Count: {1})", keyCode, repeatCount);
 		}
 
 		EVENT_CLASS_TYPE(EventType::KeyPressed);
@@ -46,9 +44,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "KeyReleasedEvent: " << keyCode;
-			return ss.str();
+			return std::format("KeyReleasedEvent: {0}", keyCode);
 		}
 
 		EVENT_CLASS_TYPE(EventType::KeyReleased);
@@ -2,7 +2,7 @@
 
 #include "Event.h"
 
-#include <sstream>
+#include <format>
 
 #include "Flux/Math/Vector2.h"
 
@@ -30,9 +30,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "MouseButtonPressedEvent: " << buttonCode << " at " << position;
-			return ss.str();
+			return std::format("MouseButtonPressedEvent: {0} at {1}", buttonCode, position);
 		}
 
 		EVENT_CLASS_TYPE(EventType::MouseButtonPressed);
@@ -45,9 +43,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "MouseButtonReleasedEvent: " << buttonCode << " at " << position;
-			return ss.str();
+			return std::format("MouseButtonReleasedEvent: {0} at {1}", buttonCode, position);
 		}
 
 		EVENT_CLASS_TYPE(EventType::MouseButtonReleased);
@@ -62,9 +58,7 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-			ss << "MouseMovedEvent: " << position;
-			return ss.str();
+			return std::format("MouseMovedEvent: {0}", position);
 		}
 
 		EVENT_CLASS_TYPE(EventType::MouseMoved);
@@ -83,20 +77,18 @@ namespace Flux
 
 		std::string ToString() const override
 		{
-			std::stringstream ss;
-
 			// INFO: Vertical Scroll
 			if (buttonCode == 0)
 			{
-				ss << "MouseScrolledEvent: " << std::format("Vertical Scroll: {0} at {1}", delta, position);
+				return std::format("MouseScrolledEvent: Vertical Scroll: {0} at {1}", delta, position);
 			}
 			// INFO: Horizontal Scroll
 			else if (buttonCode == 1)
 			{
-				ss << "MouseScrolledEvent: " << std::format("Horizontal Scroll: {0} at {1}", delta, position);
+				return std::format("MouseScrolledEvent: Horizontal Scroll: {0} at {1}", delta, position);
 			}
 
-			return ss.str();
+			return std::string();
 		}
 
 		EVENT_CLASS_TYPE(EventType::MouseWheelScrolled);
@@ -0,0 +1,126 @@
+#include "FluxPCH.h"
+
+#include "Input.h"
+
+#include "Flux/Events/ApplicationEvent.h"
+#include "Flux/Events/KeyEvent.h"
+#include "Flux/Events/MouseEvent.h"
+
+namespace Flux
+{
+	bool Input::IsActionDown(InputActionID action) const
+	{
+		if (action >= actionMap.GetActionCount()) { return false; }
+
+		const InputAction& binding = actionMap.GetAction(action);
+		return (published.keysDown & binding.keys).any() || (published.mouseButtonsDown & binding.mouseButtons).any();
+	}
+
+	bool Input::WasActionPressedThisFrame(InputActionID action) const
+	{
+		if (action >= actionMap.GetActionCount()) { return false; }
+
+		const InputAction& binding = actionMap.GetAction(action);
+		return (published.keysPressed & binding.keys).any() || (published.mouseButtonsPressed & binding.mouseButtons).any();
+	}
+
+	bool Input::WasActionReleasedThisFrame(InputActionID action) const
+	{
+		if (action >= actionMap.GetActionCount()) { return false; }
+
+		const InputAction& binding = actionMap.GetAction(action);
+		return (published.keysReleased & binding.keys).any() || (published.mouseButtonsReleased & binding.mouseButtons).any();
+	}
+
+	void Input::OnEvent(const Event& event)
+	{
+		switch (event.GetEventType())
+		{
+			case EventType::KeyPressed:
+			{
+				// INFO: Key Repeats Arrive as Further Presses of a Key that is Already Down
+				const int keyCode = static_cast<const KeyPressedEvent&>(event).GetKeyCode();
+				if (IsValidKey(keyCode) && !pending.keysDown.test(keyCode))
+				{
+					pending.keysDown.set(keyCode);
+					pending.keysPressed.set(keyCode);
+				}
+				break;
+			}
+			case EventType::KeyReleased:
+			{
+				const int keyCode = static_cast<const KeyReleasedEvent&>(event).GetKeyCode();
+				if (IsValidKey(keyCode))
+				{
+					pending.keysDown.reset(keyCode);
+					pending.keysReleased.set(keyCode);
+				}
+				break;
+			}
+			case EventType::MouseButtonPressed:
+			{
+				const MouseButtonPressedEvent& buttonEvent = static_cast<const MouseButtonPressedEvent&>(event);
+				if (IsValidMouseButton(buttonEvent.GetButtonCode()))
+				{
+					pending.mouseButtonsDown.set(buttonEvent.GetButtonCode());
+					pending.mouseButtonsPressed.set(buttonEvent.GetButtonCode());
+				}
+				pending.mousePosition = buttonEvent.GetPosition();
+				break;
+			}
+			case EventType::MouseButtonReleased:
+			{
+				const MouseButtonReleasedEvent& buttonEvent = static_cast<const MouseButtonReleasedEvent&>(event);
+				if (IsValidMouseButton(buttonEvent.GetButtonCode()))
+				{
+					pending.mouseButtonsDown.reset(buttonEvent.GetButtonCode());
+					pending.mouseButtonsReleased.set(buttonEvent.GetButtonCode());
+				}
+				pending.mousePosition = buttonEvent.GetPosition();
+				break;
+			}
+			case EventType::MouseMoved:
+			{
+				pending.mousePosition = static_cast<const MouseMovedEvent&>(event).GetPosition();
+				if (sampleMouseMoves) { pendingMouseMoves.push_back(pending.mousePosition); }
+				break;
+			}
+			case EventType::MouseWheelScrolled:
+			{
+				// INFO: The Button Code is the Wheel (0 = Vertical, 1 = Horizontal)
+				const MouseScrolledEvent& scrollEvent = static_cast<const MouseScrolledEvent&>(event);
+				if (scrollEvent.GetButtonCode() == 0) { pending.scrollDelta.y += scrollEvent.GetDelta(); }
+				else { pending.scrollDelta.x += scrollEvent.GetDelta(); }
+				pending.mousePosition = scrollEvent.GetPosition();
+				break;
+			}
+			case EventType::WindowLostFocus:
+			{
+				// INFO: Releases Happening While Unfocused Never Arrive, so Let Go of Everything Now
+				pending.keysReleased |= pending.keysDown;
+				pending.mouseButtonsReleased |= pending.mouseButtonsDown;
+				pending.keysDown.reset();
+				pending.mouseButtonsDown.reset();
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	void Input::Publish(uint64_t frameIndex)
+	{
+		pending.frameIndex = frameIndex;
+		published = pending;
+
+		// INFO: Held State Carries Over, Per Frame Edges and Deltas Start Again
+		pending.keysPressed.reset();
+		pending.keysReleased.reset();
+		pending.mouseButtonsPressed.reset();
+		pending.mouseButtonsReleased.reset();
+		pending.scrollDelta = Vector2F();
+
+		publishedMouseMoves.swap(pendingMouseMoves);
+		pendingMouseMoves.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "Flux/Math/Vector2.h"
+
+#include "InputActionMap.h"
+
+namespace Flux
+{
+	class Event;
+
+	/// <summary>
+	/// Input state as of the end of one window update, keys and mouse buttons are bitsets indexed by their codes
+	/// </summary>
+	struct InputSnapshot
+	{
+		KeySet keysDown;
+		KeySet keysPressed;		// Went down during the update (Even if released again before it ended)
+		KeySet keysReleased;
+
+		MouseButtonSet mouseButtonsDown;
+		MouseButtonSet mouseButtonsPressed;
+		MouseButtonSet mouseButtonsReleased;
+
+		Vector2I mousePosition;
+		Vector2F scrollDelta; // Summed over the update, x is the horizontal wheel
+
+		uint64_t frameIndex = 0;
+	};
+
+	/// <summary>
+	/// Polled input, filled from the window's events as they are emitted and published as a snapshot at the end of every
+	/// Window::Update. Queries read the published snapshot, which only changes inside Window::Update, so they are O(1) and
+	/// safe from worker threads during layer updates and renders.
+	/// </summary>
+	class Input
+	{
+	public:
+		bool IsKeyDown(int keyCode) const { return IsValidKey(keyCode) && published.keysDown.test(keyCode); }
+		bool WasKeyPressedThisFrame(int keyCode) const { return IsValidKey(keyCode) && published.keysPressed.test(keyCode); }
+		bool WasKeyReleasedThisFrame(int keyCode) const { return IsValidKey(keyCode) && published.keysReleased.test(keyCode); }
+
+		bool IsMouseButtonDown(int buttonCode) const { return IsValidMouseButton(buttonCode) && published.mouseButtonsDown.test(buttonCode); }
+		bool WasMouseButtonPressedThisFrame(int buttonCode) const { return IsValidMouseButton(buttonCode) && published.mouseButtonsPressed.test(buttonCode); }
+		bool WasMouseButtonReleasedThisFrame(int buttonCode) const { return IsValidMouseButton(buttonCode) && published.mouseButtonsReleased.test(buttonCode); }
+
+		const Vector2I& GetMousePosition() const { return published.mousePosition; }
+		const Vector2F& GetScrollDelta() const { return published.scrollDelta; }
+
+		/// <summary>
+		/// Keeps every mouse position the window reported, not just the last (Disabled by Default).
+		/// For layers that need the raw high rate samples (e.g. drawing strokes) when the window coalesces mouse moves.
+		/// </summary>
+		void SetMouseMoveSamplingEnabled(bool enabled) { sampleMouseMoves = enabled; }
+		bool IsMouseMoveSamplingEnabled() const { return sampleMouseMoves; }
+
+		/// <summary>
+		/// Mouse positions in the order they were reported during the last window update, empty unless sampling is enabled
+		/// </summary>
+		std::span<const Vector2I> GetMouseMoveSamples() const { return publishedMouseMoves; }
+
+		/// <summary>
+		/// True while any of the action's bindings is held
+		/// </summary>
+		bool IsActionDown(InputActionID action) const;
+		bool WasActionPressedThisFrame(InputActionID action) const;
+		bool WasActionReleasedThisFrame(InputActionID action) const;
+
+		/// <summary>
+		/// Looks the action up by name first, prefer the InputActionID overloads for actions queried every frame
+		/// </summary>
+		bool IsActionDown(std::string_view action) const { return IsActionDown(actionMap.FindAction(action)); }
+		bool WasActionPressedThisFrame(std::string_view action) const { return WasActionPressedThisFrame(actionMap.FindAction(action)); }
+		bool WasActionReleasedThisFrame(std::string_view action) const { return WasActionReleasedThisFrame(actionMap.FindAction(action)); }
+
+		InputActionMap& GetActionMap() { return actionMap; }
+		const InputActionMap& GetActionMap() const { return actionMap; }
+
+		const InputSnapshot& GetSnapshot() const { return published; }
+
+		/// <summary>
+		/// Folds an emitted window event into the pending snapshot, called by the Window
+		/// </summary>
+		void OnEvent(const Event& event);
+
+		/// <summary>
+		/// Makes the pending snapshot the one queries read and starts the next, called by the Window at the end of Update
+		/// </summary>
+		void Publish(uint64_t frameIndex);
+
+	private:
+		static bool IsValidKey(int keyCode) { return keyCode >= 0 && keyCode < KeyCount; }
+		static bool IsValidMouseButton(int buttonCode) { return buttonCode >= 0 && buttonCode < MouseButtonCount; }
+
+	private:
+		InputSnapshot pending;		// Written by the window during Update
+		InputSnapshot published;	// Read by everything else
+
+		bool sampleMouseMoves = false;
+		std::vector<Vector2I> pendingMouseMoves; // Swapped on publish rather than copied, so both keep their capacity
+		std::vector<Vector2I> publishedMouseMoves;
+
+		InputActionMap actionMap;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "FluxPCH.h"
+
+#include "InputActionMap.h"
+
+#include <sfml/Window/Keyboard.hpp>
+#include <sfml/Window/Mouse.hpp>
+#include <yaml-cpp/yaml.h>
+
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	static_assert(KeyCount == sf::Keyboard::KeyCount, "KeyCount no longer matches SFML's keys!");
+	static_assert(MouseButtonCount == sf::Mouse::ButtonCount, "MouseButtonCount no longer matches SFML's mouse buttons!");
+
+	namespace
+	{
+		// INFO: Indexed by Code, in sf::Keyboard::Key and sf::Mouse::Button Order
+		constexpr std::array<const char*, KeyCount> KeyNames =
+		{
+			"A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M",
+			"N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z",
+			"Num0", "Num1", "Num2", "Num3", "Num4", "Num5", "Num6", "Num7", "Num8", "Num9", "Escape", "LControl", "LShift",
+			"LAlt", "LSystem", "RControl", "RShift", "RAlt", "RSystem", "Menu", "LBracket", "RBracket", "Semicolon", "Comma", "Period", "Apostrophe",
+			"Slash", "Backslash", "Grave", "Equal", "Hyphen", "Space", "Enter", "Backspace", "Tab", "PageUp", "PageDown", "End", "Home",
+			"Insert", "Delete", "Add", "Subtract", "Multiply", "Divide", "Left", "Right", "Up", "Down", "Numpad0", "Numpad1", "Numpad2",
+			"Numpad3", "Numpad4", "Numpad5", "Numpad6", "Numpad7", "Numpad8", "Numpad9", "F1", "F2", "F3", "F4", "F5", "F6",
+			"F7", "F8", "F9", "F10", "F11", "F12", "F13", "F14", "F15", "Pause"
+		};
+
+		constexpr std::array<const char*, MouseButtonCount> MouseButtonNames = { "Left", "Right", "Middle", "Extra1", "Extra2" };
+	}
+
+	InputActionID InputActionMap::AddAction(std::string_view name)
+	{
+		if (const InputActionID existing = FindAction(name); existing != InvalidInputAction) { return existing; }
+
+		const InputActionID action = static_cast<InputActionID>(actions.size());
+		actions.push_back({ std::string(name), KeySet(), MouseButtonSet() });
+		actionIDs.emplace(name, action);
+		return action;
+	}
+
+	InputActionID InputActionMap::FindAction(std::string_view name) const
+	{
+		const auto it = actionIDs.find(name);
+		return it != actionIDs.end() ? it->second : InvalidInputAction;
+	}
+
+	void InputActionMap::BindKey(InputActionID action, int keyCode)
+	{
+		FLUX_CORE_ASSERT(action < actions.size(), "Binding a key to an unknown input action!");
+		FLUX_CORE_ASSERT(keyCode >= 0 && keyCode < KeyCount, "Key code out of range!");
+
+		actions[action].keys.set(keyCode);
+	}
+
+	void InputActionMap::BindMouseButton(InputActionID action, int buttonCode)
+	{
+		FLUX_CORE_ASSERT(action < actions.size(), "Binding a mouse button to an unknown input action!");
+		FLUX_CORE_ASSERT(buttonCode >= 0 && buttonCode < MouseButtonCount, "Mouse button code out of range!");
+
+		actions[action].mouseButtons.set(buttonCode);
+	}
+
+	void InputActionMap::ClearBindings(InputActionID action)
+	{
+		FLUX_CORE_ASSERT(action < actions.size(), "Clearing the bindings of an unknown input action!");
+
+		actions[action].keys.reset();
+		actions[action].mouseButtons.reset();
+	}
+
+	void InputActionMap::Clear()
+	{
+		actions.clear();
+		actionIDs.clear();
+	}
+
+	bool InputActionMap::SerializeYAML(const std::filesystem::path& filepath) const
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << YAML::Key << "Actions" << YAML::Value << YAML::BeginMap;
+
+		for (const InputAction& action : actions)
+		{
+			out << YAML::Key << action.name << YAML::Value << YAML::BeginMap;
+
+			out << YAML::Key << "Keys" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+			for (int keyCode = 0; keyCode < KeyCount; ++keyCode)
+			{
+				if (action.keys.test(keyCode)) { out << KeyNames[keyCode]; }
+			}
+			out << YAML::EndSeq;
+
+			out << YAML::Key << "MouseButtons" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+			for (int buttonCode = 0; buttonCode < MouseButtonCount; ++buttonCode)
+			{
+				if (action.mouseButtons.test(buttonCode)) { out << MouseButtonNames[buttonCode]; }
+			}
+			out << YAML::EndSeq;
+
+			out << YAML::EndMap;
+		}
+
+		out << YAML::EndMap;
+		out << YAML::EndMap;
+
+		std::ofstream file(filepath, std::ios::trunc);
+		if (!file.is_open())
+		{
+			FLUX_CORE_ERROR("Failed to open input action file for writing: {0}", filepath.string());
+			return false;
+		}
+
+		file << out.c_str();
+		return file.good();
+	}
+
+	bool InputActionMap::DeserializeYAML(const std::filesystem::path& filepath)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: yaml-cpp Reports Malformed Files and Failed Conversions by Throwing
+		try
+		{
+			const YAML::Node data = YAML::LoadFile(filepath.string());
+
+			const YAML::Node actionNodes = data["Actions"];
+			if (!actionNodes.IsMap())
+			{
+				FLUX_CORE_ERROR("Not an input action file: {0}", filepath.string());
+				return false;
+			}
+
+			for (const auto& actionNode : actionNodes)
+			{
+				const InputActionID action = AddAction(actionNode.first.as<std::string>());
+
+				for (const YAML::Node& keyNode : actionNode.second["Keys"])
+				{
+					const std::string keyName = keyNode.as<std::string>();
+					if (const int keyCode = KeyFromString(keyName); keyCode >= 0) { BindKey(action, keyCode); }
+					else { FLUX_CORE_WARN("Unknown key {0} bound to input action {1}", keyName, GetAction(action).name); }
+				}
+
+				for (const YAML::Node& buttonNode : actionNode.second["MouseButtons"])
+				{
+					const std::string buttonName = buttonNode.as<std::string>();
+					if (const int buttonCode = MouseButtonFromString(buttonName); buttonCode >= 0) { BindMouseButton(action, buttonCode); }
+					else { FLUX_CORE_WARN("Unknown mouse button {0} bound to input action {1}", buttonName, GetAction(action).name); }
+				}
+			}
+		}
+		catch (const YAML::Exception& exception)
+		{
+			FLUX_CORE_ERROR("Failed to load input action file {0}: {1}", filepath.string(), exception.what());
+			return false;
+		}
+
+		return true;
+	}
+
+	int InputActionMap::KeyFromString(std::string_view name)
+	{
+		const auto it = std::find(KeyNames.begin(), KeyNames.end(), name);
+		return it != KeyNames.end() ? static_cast<int>(it - KeyNames.begin()) : -1;
+	}
+
+	int InputActionMap::MouseButtonFromString(std::string_view name)
+	{
+		const auto it = std::find(MouseButtonNames.begin(), MouseButtonNames.end(), name);
+		return it != MouseButtonNames.end() ? static_cast<int>(it - MouseButtonNames.begin()) : -1;
+	}
+
+	const char* InputActionMap::KeyToString(int keyCode)
+	{
+		return keyCode >= 0 && keyCode < KeyCount ? KeyNames[keyCode] : "Unknown";
+	}
+
+	const char* InputActionMap::MouseButtonToString(int buttonCode)
+	{
+		return buttonCode >= 0 && buttonCode < MouseButtonCount ? MouseButtonNames[buttonCode] : "Unknown";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Flux
+{
+	// INFO: Match SFML's sf::Keyboard::KeyCount and sf::Mouse::ButtonCount, Flux events carry SFML's key and button codes
+	static constexpr int KeyCount = 101;
+	static constexpr int MouseButtonCount = 5;
+
+	using KeySet = std::bitset<KeyCount>;
+	using MouseButtonSet = std::bitset<MouseButtonCount>;
+
+	using InputActionID = uint32_t;
+	static constexpr InputActionID InvalidInputAction = ~static_cast<InputActionID>(0);
+
+	struct InputAction
+	{
+		std::string name;
+
+		KeySet keys;
+		MouseButtonSet mouseButtons;
+	};
+
+	/// <summary>
+	/// Named actions (e.g. "Jump") bound to any number of keys and mouse buttons, so gameplay asks for the action rather than the input.
+	/// Look actions up once with FindAction and query them by ID, the bindings are masks tested against a whole InputSnapshot at once.
+	/// Edit the map on the main thread only, while nothing is querying it.
+	/// </summary>
+	class InputActionMap
+	{
+	public:
+		/// <summary>
+		/// Returns the existing action if the name is already taken
+		/// </summary>
+		InputActionID AddAction(std::string_view name);
+
+		/// <summary>
+		/// Returns InvalidInputAction if there is no action with the name
+		/// </summary>
+		InputActionID FindAction(std::string_view name) const;
+
+		void BindKey(InputActionID action, int keyCode);
+		void BindMouseButton(InputActionID action, int buttonCode);
+		void ClearBindings(InputActionID action);
+
+		const InputAction& GetAction(InputActionID action) const { return actions[action]; }
+		size_t GetActionCount() const { return actions.size(); }
+
+		void Clear();
+
+		/// <summary>
+		/// Actions map to sequences of key and mouse button names (SFML's enumerator names, e.g. "Space", "LShift", "Left")
+		/// </summary>
+		bool SerializeYAML(const std::filesystem::path& filepath) const;
+
+		/// <summary>
+		/// Adds the file's bindings to any actions of the same name rather than replacing them
+		/// </summary>
+		bool DeserializeYAML(const std::filesystem::path& filepath);
+
+		/// <summary>
+		/// Returns -1 for unknown names
+		/// </summary>
+		static int KeyFromString(std::string_view name);
+		static int MouseButtonFromString(std::string_view name);
+
+		static const char* KeyToString(int keyCode);
+		static const char* MouseButtonToString(int buttonCode);
+
+	private:
+		struct NameHash
+		{
+			using is_transparent = void;
+			size_t operator()(std::string_view name) const { return std::hash<std::string_view>()(name); }
+		};
+
+		std::vector<InputAction> actions;
+		std::unordered_map<std::string, InputActionID, NameHash, std::equal_to<>> actionIDs;
+	};
+}
\ No newline at end of file
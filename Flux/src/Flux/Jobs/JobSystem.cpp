@@ -0,0 +1,367 @@
+#include "FluxPCH.h"
+
+#include "JobSystem.h"
+
+#include <thread>
+
+#include "WorkStealingQueue.h"
+
+namespace Flux
+{
+	struct Job
+	{
+		JobFunction function;
+		JobCounter* counter = nullptr;
+
+		std::atomic<bool> isFinished = true;
+		bool isHeapAllocated = false;
+	};
+
+	namespace
+	{
+		constexpr uint32_t JobPoolSize = 4096;
+		constexpr uint32_t InvalidThreadIndex = ~0u;
+		constexpr uint32_t SpinCountBeforeSleep = 64;
+
+		struct alignas(64) ThreadData
+		{
+			WorkStealingQueue<Job*, JobPoolSize> queue;
+
+			// INFO: Ring of Jobs Allocated by this Thread, a Slot is Reused Once its Job has Finished
+			std::unique_ptr<Job[]> jobPool = std::make_unique<Job[]>(JobPoolSize);
+			uint32_t nextJob = 0;
+
+			uint32_t nextVictim = 0;
+		};
+
+		struct JobSystemData
+		{
+			std::mutex lifetimeMutex; // Guards Initialise/Shutdown
+			uint32_t referenceCount = 0;
+
+			std::atomic<bool> isRunning = false;
+			std::vector<std::unique_ptr<ThreadData>> threadData; // [0] is the thread that started the system, the rest are workers
+			std::vector<std::thread> workers;
+
+			// INFO: Jobs Run from Threads Outside the Pool (They Have no Deque of their Own)
+			std::mutex injectedMutex;
+			std::deque<Job*> injectedJobs;
+			std::atomic<uint32_t> injectedCount = 0;
+
+			std::atomic<uint32_t> wakeGeneration = 0;
+			std::atomic<uint32_t> sleepingWorkers = 0;
+
+			// INFO: Workers Left Running at Exit (Missing Shutdown) are Stopped Rather than Terminating the Process
+			~JobSystemData()
+			{
+				isRunning.store(false, std::memory_order_release);
+				wakeGeneration.fetch_add(1);
+				wakeGeneration.notify_all();
+
+				for (std::thread& worker : workers) { worker.join(); }
+			}
+		};
+
+		JobSystemData& GetJobSystemData()
+		{
+			static JobSystemData data;
+			return data;
+		}
+
+		thread_local uint32_t threadIndex = InvalidThreadIndex;
+
+		void WakeWorker(JobSystemData& data)
+		{
+			data.wakeGeneration.fetch_add(1);
+			if (data.sleepingWorkers.load() > 0) { data.wakeGeneration.notify_one(); }
+		}
+
+		Job* FindJob(JobSystemData& data)
+		{
+			const uint32_t index = threadIndex;
+
+			if (index != InvalidThreadIndex)
+			{
+				if (Job* job = data.threadData[index]->queue.Pop()) { return job; }
+			}
+
+			if (data.injectedCount.load(std::memory_order_relaxed) > 0)
+			{
+				std::scoped_lock lock(data.injectedMutex);
+				if (!data.injectedJobs.empty())
+				{
+					Job* job = data.injectedJobs.front();
+					data.injectedJobs.pop_front();
+					data.injectedCount.fetch_sub(1, std::memory_order_relaxed);
+					return job;
+				}
+			}
+
+			// INFO: Steal, Starting from a Different Victim Each Time to Spread Contention
+			static thread_local uint32_t externalVictim = 0;
+			const uint32_t threadCount = static_cast<uint32_t>(data.threadData.size());
+			const uint32_t start = index != InvalidThreadIndex ? data.threadData[index]->nextVictim++ : externalVictim++;
+
+			for (uint32_t i = 0; i < threadCount; ++i)
+			{
+				const uint32_t victim = (start + i) % threadCount;
+				if (victim == index) { continue; }
+
+				if (Job* job = data.threadData[victim]->queue.Steal()) { return job; }
+			}
+
+			return nullptr;
+		}
+	}
+
+	void JobSystem::Initialise(uint32_t workerThreadCount)
+	{
+		JobSystemData& data = GetJobSystemData();
+		std::scoped_lock lock(data.lifetimeMutex);
+
+		if (data.referenceCount++ > 0) { return; }
+
+		if (workerThreadCount == 0)
+		{
+			const uint32_t hardwareThreadCount = std::thread::hardware_concurrency();
+			workerThreadCount = hardwareThreadCount > 1 ? hardwareThreadCount - 1 : 1;
+		}
+
+		data.threadData.clear();
+		for (uint32_t i = 0; i <= workerThreadCount; ++i) { data.threadData.push_back(std::make_unique<ThreadData>()); }
+
+		threadIndex = 0;
+		data.isRunning.store(true, std::memory_order_release);
+
+		for (uint32_t i = 1; i <= workerThreadCount; ++i) { data.workers.emplace_back(&JobSystem::WorkerThread, i); }
+
+		FLUX_CORE_INFO("Job System started with {0} worker threads", workerThreadCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		JobSystemData& data = GetJobSystemData();
+		std::scoped_lock lock(data.lifetimeMutex);
+
+		FLUX_CORE_ASSERT(data.referenceCount > 0, "Job System was shut down more times than it was initialised!");
+		if (data.referenceCount == 0 || --data.referenceCount > 0) { return; }
+
+		// INFO: Finish Anything Still Queued so Counters Being Waited on Elsewhere Still Complete
+		while (Job* job = FindJob(data)) { ExecuteJob(job); }
+
+		data.isRunning.store(false, std::memory_order_release);
+		data.wakeGeneration.fetch_add(1);
+		data.wakeGeneration.notify_all();
+
+		for (std::thread& worker : data.workers) { worker.join(); }
+		data.workers.clear();
+
+		while (Job* job = FindJob(data)) { ExecuteJob(job); }
+
+		threadIndex = InvalidThreadIndex;
+		data.threadData.clear();
+	}
+
+	bool JobSystem::IsInitialised()
+	{
+		return GetJobSystemData().isRunning.load(std::memory_order_acquire);
+	}
+
+	uint32_t JobSystem::GetWorkerThreadCount()
+	{
+		JobSystemData& data = GetJobSystemData();
+		return IsInitialised() ? static_cast<uint32_t>(data.threadData.size()) - 1 : 0;
+	}
+
+	bool JobSystem::IsWorkerThread()
+	{
+		return threadIndex != InvalidThreadIndex && threadIndex != 0;
+	}
+
+	void JobSystem::Run(const JobFunction& function, JobCounter* counter)
+	{
+		FLUX_CORE_ASSERT(function, "Trying to run an empty job!");
+
+		if (!IsInitialised())
+		{
+			function();
+			return;
+		}
+
+		if (counter != nullptr) { counter->value.fetch_add(1, std::memory_order_relaxed); }
+		SubmitJob(AllocateJob(function, counter));
+	}
+
+	void JobSystem::RunAfter(JobCounter& dependency, const JobFunction& function, JobCounter* counter)
+	{
+		FLUX_CORE_ASSERT(function, "Trying to run an empty job!");
+
+		if (!IsInitialised())
+		{
+			Wait(dependency);
+			function();
+			return;
+		}
+
+		if (counter != nullptr) { counter->value.fetch_add(1, std::memory_order_relaxed); }
+		Job* job = AllocateJob(function, counter);
+
+		{
+			// INFO: The Dependency only Reaches Zero while Holding this Lock, so the Job is Either Queued Now or Released Later
+			std::scoped_lock lock(dependency.continuationMutex);
+			if (!dependency.IsDone())
+			{
+				dependency.continuations.push_back(job);
+				return;
+			}
+		}
+
+		SubmitJob(job);
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		JobSystemData& data = GetJobSystemData();
+
+		while (!counter.IsDone())
+		{
+			if (Job* job = FindJob(data)) { ExecuteJob(job); }
+			else { std::this_thread::yield(); }
+		}
+
+		// INFO: The Last Job Decrements the Counter Under this Lock, Wait for it to Let Go before the Counter can be Destroyed
+		std::scoped_lock lock(counter.continuationMutex);
+	}
+
+	bool JobSystem::TryRunJob()
+	{
+		if (!IsInitialised()) { return false; }
+
+		Job* job = FindJob(GetJobSystemData());
+		if (job == nullptr) { return false; }
+
+		ExecuteJob(job);
+		return true;
+	}
+
+	uint32_t JobSystem::GetBatchSize(uint32_t count, uint32_t minBatchSize)
+	{
+		if (!IsInitialised()) { return count; }
+
+		const uint32_t batchCount = GetThreadCount() * 4;
+		return std::max(std::max(minBatchSize, 1u), (count + batchCount - 1) / batchCount);
+	}
+
+	Job* JobSystem::AllocateJob(const JobFunction& function, JobCounter* counter)
+	{
+		JobSystemData& data = GetJobSystemData();
+		Job* job = nullptr;
+
+		if (threadIndex == InvalidThreadIndex)
+		{
+			job = new Job();
+			job->isHeapAllocated = true;
+		}
+		else
+		{
+			ThreadData& thread = *data.threadData[threadIndex];
+			job = &thread.jobPool[thread.nextJob++ & (JobPoolSize - 1)];
+
+			// INFO: The Ring Wrapped onto a Job that is Still Queued or Running, Help Out until it Finishes
+			while (!job->isFinished.load(std::memory_order_acquire))
+			{
+				if (Job* other = FindJob(data)) { ExecuteJob(other); }
+				else { std::this_thread::yield(); }
+			}
+
+			job->isFinished.store(false, std::memory_order_relaxed);
+		}
+
+		job->function = function;
+		job->counter = counter;
+		return job;
+	}
+
+	void JobSystem::SubmitJob(Job* job)
+	{
+		JobSystemData& data = GetJobSystemData();
+
+		if (threadIndex == InvalidThreadIndex)
+		{
+			std::scoped_lock lock(data.injectedMutex);
+			data.injectedJobs.push_back(job);
+			data.injectedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		else if (!data.threadData[threadIndex]->queue.Push(job))
+		{
+			// INFO: Deque is Full, Running the Job Here is Cheaper than Growing it
+			ExecuteJob(job);
+			return;
+		}
+
+		WakeWorker(data);
+	}
+
+	void JobSystem::ExecuteJob(Job* job)
+	{
+		job->function();
+
+		JobCounter* counter = job->counter;
+
+		if (job->isHeapAllocated) { delete job; }
+		else { job->isFinished.store(true, std::memory_order_release); }
+
+		if (counter != nullptr) { DecrementCounter(*counter); }
+	}
+
+	void JobSystem::DecrementCounter(JobCounter& counter)
+	{
+		// INFO: Lock-Free Unless this Could be the Last Job, Reaching Zero has to Happen Under the Continuation Lock
+		uint32_t value = counter.value.load(std::memory_order_relaxed);
+		while (value > 1)
+		{
+			if (counter.value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) { return; }
+		}
+
+		std::vector<Job*> continuations;
+		{
+			std::scoped_lock lock(counter.continuationMutex);
+			if (counter.value.fetch_sub(1, std::memory_order_acq_rel) == 1) { continuations.swap(counter.continuations); }
+		}
+
+		for (Job* job : continuations) { SubmitJob(job); }
+	}
+
+	void JobSystem::WorkerThread(uint32_t index)
+	{
+		JobSystemData& data = GetJobSystemData();
+		threadIndex = index;
+
+		uint32_t spinCount = 0;
+		while (data.isRunning.load(std::memory_order_acquire))
+		{
+			// INFO: Read the Generation before Looking for Work, a Job Pushed after this Changes it and Cancels the Sleep
+			const uint32_t generation = data.wakeGeneration.load();
+
+			if (Job* job = FindJob(data))
+			{
+				ExecuteJob(job);
+				spinCount = 0;
+				continue;
+			}
+
+			if (++spinCount < SpinCountBeforeSleep)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			data.sleepingWorkers.fetch_add(1);
+			data.wakeGeneration.wait(generation);
+			data.sleepingWorkers.fetch_sub(1);
+			spinCount = 0;
+		}
+
+		threadIndex = InvalidThreadIndex;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "Flux/Utility/Delegate.h"
+
+namespace Flux
+{
+	struct Job;
+
+	/// <summary>
+	/// Job callables are stored inline in the job, capture pointers or references to anything larger
+	/// </summary>
+	using JobFunction = Delegate<void(), 6 * sizeof(void*)>;
+
+	/// <summary>
+	/// Counts the unfinished jobs it was passed to, wait on it or run jobs after it with JobSystem::RunAfter.
+	/// Call JobSystem::Wait before destroying a counter, a finishing job may still be touching it after IsDone turns true.
+	/// </summary>
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return value.load(std::memory_order_acquire) == 0; }
+		uint32_t GetValue() const { return value.load(std::memory_order_acquire); }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32_t> value = 0;
+
+		mutable std::mutex continuationMutex;
+		std::vector<Job*> continuations; // Jobs waiting for the counter to reach zero
+	};
+
+	/// <summary>
+	/// Shared work-stealing thread pool, one worker per core (minus the main thread) each with its own job deque.
+	/// Started by the Application, without it every job runs inline on the calling thread.
+	/// </summary>
+	class JobSystem
+	{
+	public:
+		JobSystem() = delete;
+		JobSystem(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		~JobSystem() = delete;
+
+		/// <summary>
+		/// Reference counted, only the first call starts the workers (0 = one worker per hardware thread minus the caller)
+		/// </summary>
+		static void Initialise(uint32_t workerThreadCount = 0);
+		static void Shutdown();
+		static bool IsInitialised();
+
+		static uint32_t GetWorkerThreadCount();
+
+		/// <summary>
+		/// Threads able to run jobs, the workers plus whichever thread is waiting
+		/// </summary>
+		static uint32_t GetThreadCount() { return GetWorkerThreadCount() + 1; }
+
+		/// <summary>
+		/// True on the pool's worker threads, i.e. the caller is running inside a job the pool picked up
+		/// </summary>
+		static bool IsWorkerThread();
+
+		static void Run(const JobFunction& function, JobCounter* counter = nullptr);
+
+		/// <summary>
+		/// Queues the job once dependency reaches zero (Immediately if it already has)
+		/// </summary>
+		static void RunAfter(JobCounter& dependency, const JobFunction& function, JobCounter* counter = nullptr);
+
+		/// <summary>
+		/// Runs queued jobs on the calling thread until the counter reaches zero, rather than blocking it
+		/// </summary>
+		static void Wait(const JobCounter& counter);
+
+		/// <summary>
+		/// Runs one queued job on the calling thread, returns false if there was none. For waits that aren't on a counter,
+		/// so a thread waiting inside a job still helps the pool make progress.
+		/// </summary>
+		static bool TryRunJob();
+
+		/// <summary>
+		/// Splits [0, count) into batches of at least minBatchSize and calls function(begin, end) for each batch across the pool,
+		/// the calling thread takes part and returns once every batch has finished
+		/// </summary>
+		template<typename F>
+		static void ParallelFor(uint32_t count, F&& function, uint32_t minBatchSize = 1)
+		{
+			if (count == 0) { return; }
+
+			const uint32_t batchSize = GetBatchSize(count, minBatchSize);
+			if (batchSize >= count)
+			{
+				function(0u, count);
+				return;
+			}
+
+			JobCounter counter;
+			std::remove_reference_t<F>* batchFunction = &function;
+
+			for (uint32_t begin = batchSize; begin < count; begin += batchSize)
+			{
+				const uint32_t end = std::min(begin + batchSize, count);
+				Run([batchFunction, begin, end]() { (*batchFunction)(begin, end); }, &counter);
+			}
+
+			function(0u, batchSize);
+			Wait(counter);
+		}
+
+		/// <summary>
+		/// Batch size ParallelFor uses, enough batches for each thread to steal a few to even out uneven work
+		/// </summary>
+		static uint32_t GetBatchSize(uint32_t count, uint32_t minBatchSize);
+
+	private:
+		static Job* AllocateJob(const JobFunction& function, JobCounter* counter);
+		static void SubmitJob(Job* job);
+		static void ExecuteJob(Job* job);
+		static void DecrementCounter(JobCounter& counter);
+
+		static void WorkerThread(uint32_t index);
+	};
+}
\ No newline at end of file
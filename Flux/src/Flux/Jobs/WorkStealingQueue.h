@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace Flux
+{
+	/// <summary>
+	/// Fixed capacity Chase-Lev deque, the owning thread pushes and pops at the bottom while any thread may steal from the top.
+	/// Follows the C11 memory ordering from "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013)
+	/// </summary>
+	template<typename T, size_t Capacity>
+	class WorkStealingQueue
+	{
+		static_assert(std::is_pointer_v<T>, "WorkStealingQueue stores pointers, nullptr means empty!");
+		static_assert((Capacity & (Capacity - 1)) == 0, "WorkStealingQueue capacity must be a power of two!");
+
+	public:
+		WorkStealingQueue() = default;
+
+		WorkStealingQueue(const WorkStealingQueue&) = delete;
+		WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+		/// <summary>
+		/// Owner Thread Only, returns false when the queue is full
+		/// </summary>
+		bool Push(T item)
+		{
+			const int64_t b = bottom.load(std::memory_order_relaxed);
+			const int64_t t = top.load(std::memory_order_acquire);
+
+			if (b - t >= static_cast<int64_t>(Capacity)) { return false; }
+
+			// INFO: Release Publishes the Item (and Whatever it Points to) to Thieves that Acquire Bottom
+			buffer[b & Mask].store(item, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// <summary>
+		/// Owner Thread Only, takes the most recently pushed item (LIFO keeps the owner's working set warm in cache)
+		/// </summary>
+		T Pop()
+		{
+			const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+			bottom.store(b, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t t = top.load(std::memory_order_relaxed);
+
+			if (t > b)
+			{
+				bottom.store(b + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T item = buffer[b & Mask].load(std::memory_order_relaxed);
+
+			// INFO: Last Item, Race Thieves for it
+			if (t == b)
+			{
+				if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) { item = nullptr; }
+				bottom.store(b + 1, std::memory_order_relaxed);
+			}
+
+			return item;
+		}
+
+		/// <summary>
+		/// Any Thread, takes the oldest item
+		/// </summary>
+		T Steal()
+		{
+			int64_t t = top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t b = bottom.load(std::memory_order_acquire);
+
+			if (t >= b) { return nullptr; }
+
+			T item = buffer[t & Mask].load(std::memory_order_relaxed);
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) { return nullptr; }
+
+			return item;
+		}
+
+		bool IsEmpty() const { return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed); }
+
+	private:
+		static constexpr int64_t Mask = static_cast<int64_t>(Capacity) - 1;
+
+		// INFO: Top and Bottom on Separate Cache Lines, Thieves Hammer Top while the Owner Works on Bottom
+		alignas(64) std::atomic<int64_t> top = 0;
+		alignas(64) std::atomic<int64_t> bottom = 0;
+		alignas(64) std::array<std::atomic<T>, Capacity> buffer = {};
+	};
+}
\ No newline at end of file
@@ -3,9 +3,29 @@
 #include "Flux/Core.h"
 
 #include "Flux/Events/Event.h"
+#include "Flux/Time/Timestep.h"
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace Flux
 {
+	class Renderer2D;
+
+	/// <summary>
+	/// What a layer's Update touches, used by the LayerManager to run updates that don't conflict in parallel
+	/// </summary>
+	struct LayerUpdateAccess
+	{
+		bool isDeclared = false; // Undeclared layers are assumed to touch everything and update in push order
+
+		std::vector<std::string> dependencies; // Names of layers whose Update must finish first
+		std::vector<std::string> reads;
+		std::vector<std::string> writes;
+	};
+
 	class Layer : public IEventListener
 	{
 	public:
@@ -17,16 +37,65 @@ namespace Flux
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
 
-		virtual void Update() {}
+		/// <summary>
+		/// Called once per frame with the variable frame time
+		/// </summary>
+		virtual void Update(Timestep deltaTime) {}
+
+		/// <summary>
+		/// Called zero or more times per frame at the fixed simulation rate, put deterministic simulation here
+		/// </summary>
+		virtual void FixedUpdate(Timestep fixedTimestep) {}
+
+		/// <summary>
+		/// Called once per frame after updating, submit sprites to the renderer here.
+		/// interpolationAlpha is how far (0-1) the frame is between the last two fixed steps
+		/// </summary>
+		virtual void Render(Renderer2D& renderer, float interpolationAlpha) {}
 
 		const std::string& GetName() const { return name; }
 
 		bool IsEnabled() const { return enabled; }
 		void SetEnabled(bool enabled) { this->enabled = enabled; }
 
+		bool IsSubscribedTo(EventType type) const { return (eventSubscriptions & EventTypeBit(type)) != 0; }
+
+		const LayerUpdateAccess& GetUpdateAccess() const { return updateAccess; }
+
+	protected:
+		/// <summary>
+		/// Restricts OnEvent to the given event types (Defaults to every type), call from the constructor or OnAttach
+		/// </summary>
+		void SubscribeToEvents(std::initializer_list<EventType> types)
+		{
+			eventSubscriptions = 0;
+			for (EventType type : types) { eventSubscriptions |= EventTypeBit(type); }
+		}
+
+		/// <summary>
+		/// Opts Update into running on a worker thread alongside layers it doesn't conflict with, call from the constructor or OnAttach.
+		/// Resources are any names the layers agree on (e.g. "Scene", "Audio"), a layer writing one runs apart from every other layer using it.
+		/// Layers sharing a resource still update in push order, an empty declaration means Update shares nothing.
+		/// </summary>
+		void DeclareUpdateAccess(std::initializer_list<std::string_view> reads, std::initializer_list<std::string_view> writes = {})
+		{
+			updateAccess.isDeclared = true;
+			updateAccess.reads.assign(reads.begin(), reads.end());
+			updateAccess.writes.assign(writes.begin(), writes.end());
+		}
+
+		/// <summary>
+		/// Runs Update after the named layer's, regardless of push order
+		/// </summary>
+		void DependsOn(std::string_view layerName) { updateAccess.dependencies.emplace_back(layerName); }
+
 	protected:
 		std::string name;
 
 		bool enabled;
+
+		EventTypeMask eventSubscriptions = ~static_cast<EventTypeMask>(0);
+
+		LayerUpdateAccess updateAccess;
 	};
 }
\ No newline at end of file
@@ -2,6 +2,11 @@
 
 #include "LayerManager.h"
 
+#include <queue>
+#include <thread>
+
+#include "Flux/Profiling/Profiler.h"
+
 namespace Flux
 {
 	LayerManager::LayerManager() : layerInsert(layers.begin())
@@ -23,10 +28,11 @@ namespace Flux
 
 	void LayerManager::OnEvent(Event& event)
 	{
-		for (auto it = layers.rbegin(); it != layers.rend(); ++it)
-		{
-			Layer* layer = *it;
+		FLUX_PROFILE_FUNCTION();
 
+		// INFO: Only Visit Layers Subscribed to this Event Type (Already in Reverse Layer Order)
+		for (Layer* layer : eventSubscribers[static_cast<size_t>(event.GetEventType())])
+		{
 			FLUX_CORE_ASSERT(layer != nullptr, "LayerManager contains a null layer!");
 
 			if (layer->IsEnabled()) { layer->OnEvent(event); }
@@ -34,13 +40,87 @@ namespace Flux
 		}
 	}
 
-	void LayerManager::Update()
+	void LayerManager::Update(Timestep deltaTime)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		if (isUpdateGraphDirty) { RebuildUpdateGraph(); }
+
+		if (isUpdateSequential || !JobSystem::IsInitialised())
+		{
+			for (uint32_t index : updateOrder)
+			{
+				Layer* layer = updateGraph[index].layer;
+				FLUX_CORE_ASSERT(layer != nullptr, "LayerManager contains a null layer!");
+
+				if (layer->IsEnabled())
+				{
+					FLUX_PROFILE_SCOPE_DYNAMIC(layer->GetName());
+					layer->Update(deltaTime);
+				}
+			}
+
+			return;
+		}
+
+		for (uint32_t i = 0; i < updateGraph.size(); ++i) { remainingPredecessors[i].store(updateGraph[i].predecessorCount, std::memory_order_relaxed); }
+
+		{
+			std::lock_guard lock(mainThreadMutex);
+			mainThreadReady.clear();
+			remainingNodes = static_cast<uint32_t>(updateGraph.size());
+		}
+
+		// INFO: Each Finished Layer Schedules the Successors it was the Last Predecessor of, so the Node Count Never Hits Zero Early
+		JobCounter counter;
+		for (uint32_t i = 0; i < updateGraph.size(); ++i)
+		{
+			if (updateGraph[i].predecessorCount == 0) { ScheduleUpdateNode(i, deltaTime, counter); }
+		}
+
+		// INFO: Undeclared Layers Update Here, so Anything Thread Affine they Touch (e.g. the Native Window) Stays on the Calling Thread.
+		// Between them the Thread Runs Queued Jobs Instead of Blocking, Update may Itself be Running Inside a Job (e.g. a Hosted Instance)
+		while (true)
+		{
+			uint32_t index = 0;
+			bool hasMainThreadNode = false;
+
+			{
+				std::lock_guard lock(mainThreadMutex);
+				if (!mainThreadReady.empty())
+				{
+					index = mainThreadReady.back();
+					mainThreadReady.pop_back();
+					hasMainThreadNode = true;
+				}
+				else if (remainingNodes == 0) { break; }
+			}
+
+			if (hasMainThreadNode) { RunUpdateNode(index, deltaTime, counter); }
+			else if (!JobSystem::TryRunJob()) { std::this_thread::yield(); }
+		}
+
+		// INFO: The Last Worker Node may Still be Returning from its Job
+		JobSystem::Wait(counter);
+	}
+
+	void LayerManager::FixedUpdate(Timestep fixedTimestep)
+	{
+		for (Layer* layer : layers)
+		{
+			FLUX_CORE_ASSERT(layer != nullptr, "LayerManager contains a null layer!");
+
+			if (layer->IsEnabled()) { layer->FixedUpdate(fixedTimestep); }
+		}
+	}
+
+	void LayerManager::Render(Renderer2D& renderer, float interpolationAlpha)
 	{
 		for (Layer* layer : layers)
 		{
 			FLUX_CORE_ASSERT(layer != nullptr, "LayerManager contains a null layer!");
 
-			if (layer->IsEnabled()) { layer->Update(); }
+			if (layer->IsEnabled()) { layer->Render(renderer, interpolationAlpha); }
 		}
 	}
 
@@ -50,6 +130,9 @@ namespace Flux
 
 		layer->OnAttach();
 		layerInsert = layers.emplace(layerInsert, layer);
+
+		RebuildEventSubscribers();
+		isUpdateGraphDirty = true;
 	}
 
 	void LayerManager::PopLayer(Layer* layer)
@@ -64,6 +147,9 @@ namespace Flux
 			(*it)->OnDetach();
 			layers.erase(it);
 			--layerInsert;
+
+			RebuildEventSubscribers();
+			isUpdateGraphDirty = true;
 		}
 	}
 
@@ -73,6 +159,9 @@ namespace Flux
 
 		overlay->OnAttach();
 		layers.emplace_back(overlay);
+
+		RebuildEventSubscribers();
+		isUpdateGraphDirty = true;
 	}
 
 	void LayerManager::PopOverlay(Layer* overlay)
@@ -86,6 +175,9 @@ namespace Flux
 		{
 			(*it)->OnDetach();
 			layers.erase(it);
+
+			RebuildEventSubscribers();
+			isUpdateGraphDirty = true;
 		}
 	}
 
@@ -100,4 +192,156 @@ namespace Flux
 			(*it)->SetEnabled(enabled);
 		}
 	}
+
+	void LayerManager::RebuildEventSubscribers()
+	{
+		for (size_t type = 0; type < EventTypeCount; ++type)
+		{
+			Layers& subscribers = eventSubscribers[type];
+			subscribers.clear();
+
+			for (auto it = layers.rbegin(); it != layers.rend(); ++it)
+			{
+				if ((*it)->IsSubscribedTo(static_cast<EventType>(type))) { subscribers.push_back(*it); }
+			}
+		}
+	}
+
+	void LayerManager::RebuildUpdateGraph()
+	{
+		const uint32_t count = static_cast<uint32_t>(layers.size());
+
+		updateGraph.assign(count, UpdateNode());
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			updateGraph[i].layer = layers[i];
+			updateGraph[i].runsOnWorker = layers[i]->GetUpdateAccess().isDeclared;
+		}
+
+		auto addEdge = [this](uint32_t from, uint32_t to)
+		{
+			std::vector<uint32_t>& successors = updateGraph[from].successors;
+			if (std::find(successors.begin(), successors.end(), to) != successors.end()) { return; }
+
+			successors.push_back(to);
+			++updateGraph[to].predecessorCount;
+		};
+
+		auto conflicts = [](const LayerUpdateAccess& a, const LayerUpdateAccess& b)
+		{
+			if (!a.isDeclared || !b.isDeclared) { return true; }
+
+			auto overlaps = [](const std::vector<std::string>& x, const std::vector<std::string>& y) { return std::find_first_of(x.begin(), x.end(), y.begin(), y.end()) != x.end(); };
+			return overlaps(a.writes, b.writes) || overlaps(a.writes, b.reads) || overlaps(a.reads, b.writes);
+		};
+
+		std::vector<std::vector<uint32_t>> dependencies(count);
+		for (uint32_t j = 0; j < count; ++j)
+		{
+			for (const std::string& dependency : layers[j]->GetUpdateAccess().dependencies)
+			{
+				auto it = std::find_if(layers.begin(), layers.end(), [&dependency](const Layer* layer) { return layer->GetName() == dependency; });
+
+				if (it == layers.end()) { FLUX_CORE_WARN("Layer {0} depends on {1}, which isn't in the LayerManager", layers[j]->GetName(), dependency); }
+				else if (*it != layers[j]) { dependencies[j].push_back(static_cast<uint32_t>(it - layers.begin())); }
+			}
+		}
+
+		auto dependsOn = [&dependencies](uint32_t layer, uint32_t dependency)
+		{
+			return std::find(dependencies[layer].begin(), dependencies[layer].end(), dependency) != dependencies[layer].end();
+		};
+
+		// INFO: Conflicting Layers Keep their Push Order Unless an Explicit Dependency Says Otherwise
+		for (uint32_t j = 0; j < count; ++j)
+		{
+			for (uint32_t i = 0; i < j; ++i)
+			{
+				if (!conflicts(layers[i]->GetUpdateAccess(), layers[j]->GetUpdateAccess())) { continue; }
+
+				if (dependsOn(i, j)) { addEdge(j, i); }
+				else { addEdge(i, j); }
+			}
+
+			for (uint32_t dependency : dependencies[j]) { addEdge(dependency, j); }
+		}
+
+		// INFO: Kahn's Algorithm, Taking the Earliest Pushed Ready Layer so Sequential Updates Stay Close to Push Order
+		std::vector<uint32_t> remaining(count);
+		std::vector<uint32_t> depth(count, 0);
+		std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ready;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			remaining[i] = updateGraph[i].predecessorCount;
+			if (remaining[i] == 0) { ready.push(i); }
+		}
+
+		updateOrder.clear();
+		uint32_t longestChain = 0;
+
+		while (!ready.empty())
+		{
+			const uint32_t index = ready.top();
+			ready.pop();
+			updateOrder.push_back(index);
+			longestChain = std::max(longestChain, depth[index] + 1);
+
+			for (uint32_t successor : updateGraph[index].successors)
+			{
+				depth[successor] = std::max(depth[successor], depth[index] + 1);
+				if (--remaining[successor] == 0) { ready.push(successor); }
+			}
+		}
+
+		if (updateOrder.size() != count)
+		{
+			FLUX_CORE_ERROR("Layer update dependencies form a cycle, updating layers in push order");
+
+			for (UpdateNode& node : updateGraph)
+			{
+				node.successors.clear();
+				node.predecessorCount = 0;
+			}
+
+			updateOrder.clear();
+			for (uint32_t i = 0; i < count; ++i) { updateOrder.push_back(i); }
+			longestChain = count;
+		}
+
+		remainingPredecessors = std::make_unique<std::atomic<uint32_t>[]>(count);
+		isUpdateSequential = longestChain == count;
+		isUpdateGraphDirty = false;
+	}
+
+	void LayerManager::RunUpdateNode(uint32_t index, Timestep deltaTime, JobCounter& counter)
+	{
+		const UpdateNode& node = updateGraph[index];
+
+		if (node.layer->IsEnabled())
+		{
+			FLUX_PROFILE_SCOPE_DYNAMIC(node.layer->GetName());
+			node.layer->Update(deltaTime);
+		}
+
+		for (uint32_t successor : node.successors)
+		{
+			if (remainingPredecessors[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) { ScheduleUpdateNode(successor, deltaTime, counter); }
+		}
+
+		std::lock_guard lock(mainThreadMutex);
+		--remainingNodes;
+	}
+
+	void LayerManager::ScheduleUpdateNode(uint32_t index, Timestep deltaTime, JobCounter& counter)
+	{
+		if (updateGraph[index].runsOnWorker)
+		{
+			JobSystem::Run([this, index, deltaTime, &counter]() { RunUpdateNode(index, deltaTime, counter); }, &counter);
+			return;
+		}
+
+		std::lock_guard lock(mainThreadMutex);
+		mainThreadReady.push_back(index);
+	}
 }
\ No newline at end of file
@@ -4,8 +4,14 @@
 
 #include "Flux/Events/Event.h"
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#include "Flux/Jobs/JobSystem.h"
+
 #include "Layer.h"
 
 namespace Flux
@@ -20,7 +26,13 @@ namespace Flux
 
 		virtual void OnEvent(Event& event) override;
 
-		void Update();
+		/// <summary>
+		/// Layers that declared their update access run in parallel across the JobSystem where they don't conflict,
+		/// the rest update one at a time in push order on the calling (Main) thread
+		/// </summary>
+		void Update(Timestep deltaTime);
+		void FixedUpdate(Timestep fixedTimestep);
+		void Render(Renderer2D& renderer, float interpolationAlpha);
 
 		/// <summary>
 		/// Push Layers in the order in which you want them to receive events (First Push = First to Receive Events)
@@ -37,7 +49,45 @@ namespace Flux
 		void SetLayerEnabled(Layer* layer, bool enabled);
 
 	private:
+		/// <summary>
+		/// Rebuilds the per event type lists of subscribed layers in event receiving order
+		/// </summary>
+		void RebuildEventSubscribers();
+
+		/// <summary>
+		/// Rebuilds the DAG of layer updates from each layer's declared access and dependencies
+		/// </summary>
+		void RebuildUpdateGraph();
+		void RunUpdateNode(uint32_t index, Timestep deltaTime, JobCounter& counter);
+
+		/// <summary>
+		/// Queues a node whose predecessors have all finished, on a worker if its layer declared its access, otherwise for the thread calling Update
+		/// </summary>
+		void ScheduleUpdateNode(uint32_t index, Timestep deltaTime, JobCounter& counter);
+
+	private:
+		struct UpdateNode
+		{
+			Layer* layer = nullptr;
+			std::vector<uint32_t> successors;
+			uint32_t predecessorCount = 0;
+			bool runsOnWorker = false; // Only layers that declared their update access leave the thread calling Update
+		};
+
 		Layers layers;
 		Layers::iterator layerInsert;
+
+		std::array<Layers, EventTypeCount> eventSubscribers;
+
+		std::vector<UpdateNode> updateGraph; // In push order
+		std::vector<uint32_t> updateOrder; // Topological order, used when updating on one thread
+		std::unique_ptr<std::atomic<uint32_t>[]> remainingPredecessors;
+
+		// INFO: Ready Nodes of Undeclared Layers, Run by the Thread Calling Update while the Workers Run the Rest
+		std::mutex mainThreadMutex;
+		std::vector<uint32_t> mainThreadReady;
+		uint32_t remainingNodes = 0; // Guarded by mainThreadMutex
+		bool isUpdateGraphDirty = true;
+		bool isUpdateSequential = true; // The graph is a single chain, nothing to gain from the JobSystem
 	};
 }
\ No newline at end of file
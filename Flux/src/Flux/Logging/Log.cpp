@@ -2,38 +2,246 @@
 
 #include "Log.h"
 
+#include <atomic>
+#include <csignal>
+#include <exception>
+#include <thread>
+
+#ifdef FLUX_PLATFORM_WINDOWS
+	#include <io.h>
+#else
+	#include <unistd.h>
+#endif
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 #include "Formatters/MultiLevelFormatter.h"
 
 namespace Flux
 {
-	void Log::Initialise()
+	namespace
 	{
-		static bool isInitialised = false;
+		struct LogData
+		{
+			std::shared_ptr<spdlog::details::thread_pool> threadPool;
+			std::vector<spdlog::sink_ptr> sinks;
+
+			std::mutex workerMutex;
+			std::vector<std::thread::id> workerThreadIDs;
+
+			std::atomic<bool> crashHandled = false;
+			std::terminate_handler previousTerminateHandler = nullptr;
+		};
+
+		LogData& GetLogData()
+		{
+			static LogData data;
+			return data;
+		}
+
+		int FileDescriptorOf(std::FILE* file)
+		{
+#ifdef FLUX_PLATFORM_WINDOWS
+			return _fileno(file);
+#else
+			return fileno(file);
+#endif
+		}
+
+		// INFO: Descriptor of the Open Log File, Read by the Signal Handler so it Lives Outside LogData (No Static Guard or Lock to Touch)
+		std::atomic<int> logFileDescriptor = -1;
+
+		spdlog::async_overflow_policy ToSpdlogPolicy(LogOverflowPolicy policy)
+		{
+			switch (policy)
+			{
+				case LogOverflowPolicy::Block: return spdlog::async_overflow_policy::block;
+				case LogOverflowPolicy::DiscardNew: return spdlog::async_overflow_policy::discard_new;
+				case LogOverflowPolicy::OverwriteOldest:
+				default: return spdlog::async_overflow_policy::overrun_oldest;
+			}
+		}
+
+		std::shared_ptr<spdlog::logger> CreateLogger(const std::string& name, const std::vector<spdlog::sink_ptr>& sinks, const LogSpecification& specification)
+		{
+			LogData& data = GetLogData();
 
-		if (!isInitialised)
+			if (specification.mode == LogMode::Asynchronous)
+			{
+				return std::make_shared<spdlog::async_logger>(name, sinks.begin(), sinks.end(), data.threadPool, ToSpdlogPolicy(specification.overflowPolicy));
+			}
+
+			return std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+		}
+
+		bool IsLogWorkerThread()
 		{
-			// INFO: Core Logger Creation
-			auto coreSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-			FLUX_MINIMAL_ASSERT(coreSink != nullptr);
-			coreSink->set_formatter(std::make_unique<MultiLevelFormatter>());
+			LogData& data = GetLogData();
+			std::scoped_lock lock(data.workerMutex);
 
-			auto& coreLogger = GetCoreLogger();
-			coreLogger = std::make_shared<spdlog::logger>("FLUX", coreSink);
-			FLUX_MINIMAL_ASSERT(coreLogger != nullptr);
-			spdlog::register_logger(coreLogger);
-			coreLogger->set_level(spdlog::level::trace);
+			return std::find(data.workerThreadIDs.begin(), data.workerThreadIDs.end(), std::this_thread::get_id()) != data.workerThreadIDs.end();
+		}
 
-			// INFO: Client Logger Creation
-			auto& clientLogger = GetClientLogger();
-			clientLogger = spdlog::stdout_color_mt("APP");
-			FLUX_CORE_ASSERT(clientLogger != nullptr, "Client Logger failed to initialise!");
-			clientLogger->set_level(spdlog::level::trace);
-			clientLogger->set_pattern("[%T]%^ %n: %v%$"); // Time, Color-Begin, Logger Name, Message, Color-End
+		/// <summary>
+		/// Best effort drain when the process is going down, queued messages are often the ones explaining the crash
+		/// </summary>
+		void FlushOnCrash()
+		{
+			LogData& data = GetLogData();
+			if (data.crashHandled.exchange(true)) { return; }
 
-			isInitialised = true;
+			// INFO: A Crashing Log Worker can't Drain (and Join) Itself, so Only Flush what the Sinks Already Hold
+			if (IsLogWorkerThread())
+			{
+				for (auto& sink : data.sinks) { sink->flush(); }
+				return;
+			}
+
+			Log::Shutdown();
 		}
+
+		void CrashSignalHandler(int signal)
+		{
+			// INFO: Only Async-Signal-Safe Calls in Here, Draining the Queue Takes Locks the Crashing Thread may Hold. The File is
+			// Unbuffered, so Every Message the Worker Wrote is Already with the OS and only the Still Queued Ones are Lost.
+			static constexpr char CrashNotice[] = "FLUX: Fatal signal, log messages still queued were not written\n";
+
+#ifdef FLUX_PLATFORM_WINDOWS
+			_write(2, CrashNotice, sizeof(CrashNotice) - 1);
+			if (const int fileDescriptor = logFileDescriptor.load(); fileDescriptor >= 0) { _commit(fileDescriptor); }
+#else
+			[[maybe_unused]] const ssize_t written = write(STDERR_FILENO, CrashNotice, sizeof(CrashNotice) - 1);
+			if (const int fileDescriptor = logFileDescriptor.load(); fileDescriptor >= 0) { fsync(fileDescriptor); }
+#endif
+
+			// INFO: Re-raise with the Default Handler so the Process Still Crashes (Core Dumps, Debuggers, Exit Codes)
+			std::signal(signal, SIG_DFL);
+			std::raise(signal);
+		}
+
+		void CrashTerminateHandler()
+		{
+			FlushOnCrash();
+
+			if (std::terminate_handler previous = GetLogData().previousTerminateHandler) { previous(); }
+			std::abort();
+		}
+
+		void InstallCrashHandlers()
+		{
+			// INFO: Crashes Only, SIGTERM is a Normal Request to Exit and Left to the Application
+			for (int signal : { SIGABRT, SIGFPE, SIGILL, SIGSEGV })
+			{
+				std::signal(signal, &CrashSignalHandler);
+			}
+
+			// INFO: Initialising Again after a Shutdown Mustn't Chain the Handler to Itself
+			const std::terminate_handler previous = std::set_terminate(&CrashTerminateHandler);
+			if (previous != &CrashTerminateHandler) { GetLogData().previousTerminateHandler = previous; }
+		}
+	}
+
+	void Log::Initialise(const LogSpecification& specification)
+	{
+		// INFO: Already Running, Shutdown First to Initialise with a Different Specification
+		if (GetCoreLogger() != nullptr) { return; }
+
+		LogData& data = GetLogData();
+		data.crashHandled = false;
+
+		// INFO: Background Thread Pool, Formatting and Sink Writes Happen Here in Asynchronous Mode
+		if (specification.mode == LogMode::Asynchronous)
+		{
+			data.threadPool = std::make_shared<spdlog::details::thread_pool>(specification.queueSize, specification.threadCount, [&data]()
+			{
+				std::scoped_lock lock(data.workerMutex);
+				data.workerThreadIDs.push_back(std::this_thread::get_id());
+			});
+			FLUX_MINIMAL_ASSERT(data.threadPool != nullptr);
+		}
+
+		// INFO: Optional Rotating File Sink, Shared by Both Loggers
+		std::shared_ptr<spdlog::sinks::rotating_file_sink_mt> fileSink;
+		if (!specification.filepath.empty())
+		{
+			// INFO: Unbuffered, Each Message Reaches the OS as it's Written so a Crash Only Loses what was Still Queued
+			spdlog::file_event_handlers fileEvents;
+			fileEvents.after_open = [](const spdlog::filename_t&, std::FILE* file)
+			{
+				std::setvbuf(file, nullptr, _IONBF, 0);
+				logFileDescriptor.store(FileDescriptorOf(file));
+			};
+			fileEvents.before_close = [](const spdlog::filename_t&, std::FILE*) { logFileDescriptor.store(-1); };
+
+			fileSink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(specification.filepath.string(), specification.maxFileSize, specification.maxFileCount, false, fileEvents);
+			FLUX_MINIMAL_ASSERT(fileSink != nullptr);
+			fileSink->set_pattern("[%Y-%m-%d %T.%e] [%t] %n %l: %v [%s:%#]"); // Date and Time, Thread, Logger Name, Level, Message, File and Line
+			data.sinks.push_back(fileSink);
+		}
+
+		// INFO: Core Logger Creation
+		auto coreSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+		FLUX_MINIMAL_ASSERT(coreSink != nullptr);
+		coreSink->set_formatter(std::make_unique<MultiLevelFormatter>());
+		data.sinks.push_back(coreSink);
+
+		std::vector<spdlog::sink_ptr> coreSinks = { coreSink };
+		if (fileSink) { coreSinks.push_back(fileSink); }
+
+		auto& coreLogger = GetCoreLogger();
+		coreLogger = CreateLogger("FLUX", coreSinks, specification);
+		FLUX_MINIMAL_ASSERT(coreLogger != nullptr);
+		spdlog::register_logger(coreLogger);
+		coreLogger->set_level(spdlog::level::trace);
+		coreLogger->flush_on(spdlog::level::err);
+
+		// INFO: Client Logger Creation
+		auto clientSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+		FLUX_CORE_ASSERT(clientSink != nullptr, "Client Logger sink failed to initialise!");
+		clientSink->set_pattern("[%T]%^ %n: %v%$"); // Time, Color-Begin, Logger Name, Message, Color-End
+		data.sinks.push_back(clientSink);
+
+		std::vector<spdlog::sink_ptr> clientSinks = { clientSink };
+		if (fileSink) { clientSinks.push_back(fileSink); }
+
+		auto& clientLogger = GetClientLogger();
+		clientLogger = CreateLogger("APP", clientSinks, specification);
+		FLUX_CORE_ASSERT(clientLogger != nullptr, "Client Logger failed to initialise!");
+		spdlog::register_logger(clientLogger);
+		clientLogger->set_level(spdlog::level::trace);
+		clientLogger->flush_on(spdlog::level::err);
+
+		if (specification.flushOnCrash) { InstallCrashHandlers(); }
+	}
+
+	void Log::Shutdown()
+	{
+		LogData& data = GetLogData();
+
+		Flush();
+
+		GetCoreLogger().reset();
+		GetClientLogger().reset();
+		spdlog::drop_all();
+
+		// INFO: Destroying the Pool Processes Everything Still Queued, then Joins its Threads
+		data.threadPool.reset();
+
+		{
+			std::scoped_lock lock(data.workerMutex);
+			data.workerThreadIDs.clear();
+		}
+
+		for (auto& sink : data.sinks) { sink->flush(); }
+		data.sinks.clear();
+	}
+
+	void Log::Flush()
+	{
+		if (auto& coreLogger = GetCoreLogger()) { coreLogger->flush(); }
+		if (auto& clientLogger = GetClientLogger()) { clientLogger->flush(); }
 	}
 
 	std::shared_ptr<spdlog::logger>& Log::GetCoreLogger()
@@ -9,8 +9,42 @@
 #endif
 #include <spdlog/spdlog.h>
 
+#include <cstddef>
+#include <filesystem>
+
 namespace Flux
 {
+	enum class LogMode
+	{
+		Synchronous,	// Messages are formatted and written on the calling thread
+		Asynchronous	// Messages are queued and formatted/written on a background thread
+	};
+
+	enum class LogOverflowPolicy
+	{
+		Block,			// Wait for space in the queue (Never loses messages, can stall the caller)
+		OverwriteOldest,// Drop the oldest queued message (Never stalls the caller)
+		DiscardNew		// Drop the message being logged (Never stalls the caller)
+	};
+
+	struct LogSpecification
+	{
+		LogMode mode = LogMode::Asynchronous;
+
+		// INFO: Asynchronous Mode Settings, Queue Memory is Bounded by queueSize Messages
+		size_t queueSize = 8192;
+		size_t threadCount = 1;
+		LogOverflowPolicy overflowPolicy = LogOverflowPolicy::OverwriteOldest;
+
+		// INFO: Rotating File Sink (Disabled when Empty), Shared by the Core and Client Loggers
+		std::filesystem::path filepath;
+		size_t maxFileSize = 5 * 1024 * 1024;
+		size_t maxFileCount = 3;
+
+		// INFO: Drains Queued Messages on std::terminate, on Fatal Signals (Where Draining isn't Safe) Syncs what was Already Written
+		bool flushOnCrash = true;
+	};
+
 	/// <summary>
 	/// Wrapper class for logging system provided by spdlog
 	/// </summary>
@@ -23,7 +57,17 @@ namespace Flux
 		Log& operator=(const Log&) = delete;
 		~Log() = delete;
 
-		static void Initialise();
+		static void Initialise(const LogSpecification& specification = LogSpecification());
+
+		/// <summary>
+		/// Writes out every queued message and stops the background thread, logging is unavailable afterwards
+		/// </summary>
+		static void Shutdown();
+
+		/// <summary>
+		/// Requests a flush of every sink (Asynchronous Mode: the flush happens after already queued messages)
+		/// </summary>
+		static void Flush();
 
 		static std::shared_ptr<spdlog::logger>& GetCoreLogger();
 		static std::shared_ptr<spdlog::logger>& GetClientLogger();
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <string>
+
+#include <sfml/Graphics/View.hpp>
+
+#include "Vector2.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Axis aligned bounding box in world space (min is the top-left corner in SFML's y-down coordinates)
+	/// </summary>
+	struct AABB
+	{
+		Vector2F min;
+		Vector2F max;
+
+		AABB() = default;
+		AABB(const Vector2F& min, const Vector2F& max) : min(min), max(max) {}
+
+		static AABB FromCenter(const Vector2F& center, const Vector2F& halfExtents)
+		{
+			return AABB(Vector2F(center.x - halfExtents.x, center.y - halfExtents.y), Vector2F(center.x + halfExtents.x, center.y + halfExtents.y));
+		}
+
+		/// <summary>
+		/// World rectangle visible through the view, rotated views return the box around the rotated rectangle
+		/// </summary>
+		static AABB FromView(const sf::View& view)
+		{
+			const sf::Vector2f halfSize = view.getSize() * 0.5f;
+			const float radians = view.getRotation().asRadians();
+			const float cosine = std::abs(std::cos(radians));
+			const float sine = std::abs(std::sin(radians));
+
+			return FromCenter(view.getCenter(), Vector2F(halfSize.x * cosine + halfSize.y * sine, halfSize.x * sine + halfSize.y * cosine));
+		}
+
+		static AABB Union(const AABB& a, const AABB& b)
+		{
+			return AABB(Vector2F(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y)), Vector2F(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y)));
+		}
+
+		Vector2F GetCenter() const { return Vector2F((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f); }
+		Vector2F GetSize() const { return Vector2F(max.x - min.x, max.y - min.y); }
+
+		/// <summary>
+		/// Surface area heuristic used by the spatial index, cheaper than area and just as good for 2D trees
+		/// </summary>
+		float GetPerimeter() const { return 2.0f * ((max.x - min.x) + (max.y - min.y)); }
+
+		bool Overlaps(const AABB& other) const
+		{
+			return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y;
+		}
+
+		bool Contains(const AABB& other) const
+		{
+			return min.x <= other.min.x && min.y <= other.min.y && other.max.x <= max.x && other.max.y <= max.y;
+		}
+
+		bool Contains(const Vector2F& point) const
+		{
+			return min.x <= point.x && point.x <= max.x && min.y <= point.y && point.y <= max.y;
+		}
+
+		AABB Expanded(float margin) const
+		{
+			return AABB(Vector2F(min.x - margin, min.y - margin), Vector2F(max.x + margin, max.y + margin));
+		}
+
+		std::string ToString() const
+		{
+			return std::format("[{0} - {1}]", min, max);
+		}
+	};
+}
+
+// INFO: Specialization for Logging AABBs
+template<typename CharT>
+struct std::formatter<Flux::AABB, CharT> : std::formatter<std::string>
+{
+	template <typename FormatContext>
+	FormatContext::iterator format(const Flux::AABB& aabb, FormatContext& ctx) const
+	{
+		return std::formatter<std::string>::format(aabb.ToString(), ctx);
+	}
+};
\ No newline at end of file
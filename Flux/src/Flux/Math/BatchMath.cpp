@@ -0,0 +1,522 @@
+#include "FluxPCH.h"
+
+#include "BatchMath.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define FLUX_SIMD_X86
+
+	#include <immintrin.h>
+
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+// INFO: MSVC Allows AVX Intrinsics Anywhere, GCC and Clang Need the Functions Using them Compiled for AVX2
+#if defined(__GNUC__) || defined(__clang__)
+	#define FLUX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define FLUX_TARGET_AVX2
+#endif
+
+namespace Flux::BatchMath
+{
+	namespace
+	{
+		SIMDLevel DetectSIMDLevel()
+		{
+#if defined(FLUX_SIMD_X86) && defined(_MSC_VER)
+			int info[4] = {};
+			__cpuid(info, 1);
+
+			// INFO: The OS has to Save the YMM Registers on Context Switches (OSXSAVE and XCR0 Bits 1-2), not Just the CPU Support AVX
+			const bool isAVXEnabled = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+			__cpuidex(info, 7, 0);
+			return isAVXEnabled && (info[1] & (1 << 5)) != 0 ? SIMDLevel::AVX2 : SIMDLevel::SSE2;
+#elif defined(FLUX_SIMD_X86)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") ? SIMDLevel::AVX2 : SIMDLevel::SSE2;
+#else
+			return SIMDLevel::Scalar;
+#endif
+		}
+
+		std::atomic<SIMDLevel>& GetActiveSIMDLevel()
+		{
+			static std::atomic<SIMDLevel> level = GetSupportedSIMDLevel();
+			return level;
+		}
+
+#pragma region Scalar
+
+		// INFO: Scalar Kernels Also Finish the Tail Left Over by the Vector Kernels
+		void TransformPointsScalar(const Matrix3x3& matrix, const float* x, const float* y, float* outX, float* outY, size_t begin, size_t count)
+		{
+			const float a00 = matrix(0, 0), a01 = matrix(0, 1), a02 = matrix(0, 2);
+			const float a10 = matrix(1, 0), a11 = matrix(1, 1), a12 = matrix(1, 2);
+
+			for (size_t i = begin; i < count; ++i)
+			{
+				const float pointX = x[i];
+				const float pointY = y[i];
+				outX[i] = a00 * pointX + a01 * pointY + a02;
+				outY[i] = a10 * pointX + a11 * pointY + a12;
+			}
+		}
+
+		void DotScalar(const float* ax, const float* ay, const float* bx, const float* by, float* out, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; ++i) { out[i] = ax[i] * bx[i] + ay[i] * by[i]; }
+		}
+
+		void LengthScalar(const float* x, const float* y, float* out, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; ++i) { out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]); }
+		}
+
+		void MergeScalar(AABB& result, const float* minX, const float* minY, const float* maxX, const float* maxY, size_t begin, size_t count)
+		{
+			// INFO: Same Operand Order as minps/maxps (The Second Operand Wins Ties and NaNs), not std::min/std::max
+			for (size_t i = begin; i < count; ++i)
+			{
+				result.min.x = result.min.x < minX[i] ? result.min.x : minX[i];
+				result.min.y = result.min.y < minY[i] ? result.min.y : minY[i];
+				result.max.x = result.max.x > maxX[i] ? result.max.x : maxX[i];
+				result.max.y = result.max.y > maxY[i] ? result.max.y : maxY[i];
+			}
+		}
+
+		size_t CullScalar(const AABB& bounds, const float* minX, const float* minY, const float* maxX, const float* maxY, uint32_t* outIndices, size_t visibleCount, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; ++i)
+			{
+				const bool overlaps = minX[i] <= bounds.max.x && maxX[i] >= bounds.min.x && minY[i] <= bounds.max.y && maxY[i] >= bounds.min.y;
+
+				// INFO: Branchless, the Index is Always Written but only Kept if Visible
+				outIndices[visibleCount] = static_cast<uint32_t>(i);
+				visibleCount += overlaps ? 1 : 0;
+			}
+
+			return visibleCount;
+		}
+
+		void IntegrateScalar(float* x, float* y, float* velocityX, float* velocityY, float accelerationX, float accelerationY, float damping, float deltaTime, size_t begin, size_t count)
+		{
+			const float deltaX = accelerationX * deltaTime;
+			const float deltaY = accelerationY * deltaTime;
+
+			for (size_t i = begin; i < count; ++i)
+			{
+				velocityX[i] = (velocityX[i] + deltaX) * damping;
+				velocityY[i] = (velocityY[i] + deltaY) * damping;
+				x[i] = x[i] + velocityX[i] * deltaTime;
+				y[i] = y[i] + velocityY[i] * deltaTime;
+			}
+		}
+
+		size_t AgeScalar(float* remaining, float amount, size_t expiredCount, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; ++i)
+			{
+				remaining[i] -= amount;
+				expiredCount += remaining[i] <= 0.0f ? 1 : 0;
+			}
+
+			return expiredCount;
+		}
+
+#pragma endregion
+
+#ifdef FLUX_SIMD_X86
+
+#pragma region SSE2
+
+		void TransformPointsSSE2(const Matrix3x3& matrix, const float* x, const float* y, float* outX, float* outY, size_t count)
+		{
+			const __m128 a00 = _mm_set1_ps(matrix(0, 0)), a01 = _mm_set1_ps(matrix(0, 1)), a02 = _mm_set1_ps(matrix(0, 2));
+			const __m128 a10 = _mm_set1_ps(matrix(1, 0)), a11 = _mm_set1_ps(matrix(1, 1)), a12 = _mm_set1_ps(matrix(1, 2));
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 pointX = _mm_loadu_ps(x + i);
+				const __m128 pointY = _mm_loadu_ps(y + i);
+				_mm_storeu_ps(outX + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a00, pointX), _mm_mul_ps(a01, pointY)), a02));
+				_mm_storeu_ps(outY + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a10, pointX), _mm_mul_ps(a11, pointY)), a12));
+			}
+
+			TransformPointsScalar(matrix, x, y, outX, outY, i, count);
+		}
+
+		void DotSSE2(const float* ax, const float* ay, const float* bx, const float* by, float* out, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)), _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i))));
+			}
+
+			DotScalar(ax, ay, bx, by, out, i, count);
+		}
+
+		void LengthSSE2(const float* x, const float* y, float* out, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 vectorX = _mm_loadu_ps(x + i);
+				const __m128 vectorY = _mm_loadu_ps(y + i);
+				_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vectorX, vectorX), _mm_mul_ps(vectorY, vectorY))));
+			}
+
+			LengthScalar(x, y, out, i, count);
+		}
+
+		float HorizontalMin(__m128 value)
+		{
+			value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+			value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_cvtss_f32(value);
+		}
+
+		float HorizontalMax(__m128 value)
+		{
+			value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+			value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_cvtss_f32(value);
+		}
+
+		void MergeSSE2(AABB& result, const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count)
+		{
+			__m128 resultMinX = _mm_set1_ps(result.min.x), resultMinY = _mm_set1_ps(result.min.y);
+			__m128 resultMaxX = _mm_set1_ps(result.max.x), resultMaxY = _mm_set1_ps(result.max.y);
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				resultMinX = _mm_min_ps(resultMinX, _mm_loadu_ps(minX + i));
+				resultMinY = _mm_min_ps(resultMinY, _mm_loadu_ps(minY + i));
+				resultMaxX = _mm_max_ps(resultMaxX, _mm_loadu_ps(maxX + i));
+				resultMaxY = _mm_max_ps(resultMaxY, _mm_loadu_ps(maxY + i));
+			}
+
+			result = AABB(Vector2F(HorizontalMin(resultMinX), HorizontalMin(resultMinY)), Vector2F(HorizontalMax(resultMaxX), HorizontalMax(resultMaxY)));
+			MergeScalar(result, minX, minY, maxX, maxY, i, count);
+		}
+
+		size_t CullSSE2(const AABB& bounds, const float* minX, const float* minY, const float* maxX, const float* maxY, uint32_t* outIndices, size_t count)
+		{
+			const __m128 boundsMinX = _mm_set1_ps(bounds.min.x), boundsMinY = _mm_set1_ps(bounds.min.y);
+			const __m128 boundsMaxX = _mm_set1_ps(bounds.max.x), boundsMaxY = _mm_set1_ps(bounds.max.y);
+
+			size_t visibleCount = 0;
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 overlapsX = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minX + i), boundsMaxX), _mm_cmpge_ps(_mm_loadu_ps(maxX + i), boundsMinX));
+				const __m128 overlapsY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minY + i), boundsMaxY), _mm_cmpge_ps(_mm_loadu_ps(maxY + i), boundsMinY));
+				uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(overlapsX, overlapsY)));
+
+				while (mask != 0)
+				{
+					outIndices[visibleCount++] = static_cast<uint32_t>(i) + std::countr_zero(mask);
+					mask &= mask - 1;
+				}
+			}
+
+			return CullScalar(bounds, minX, minY, maxX, maxY, outIndices, visibleCount, i, count);
+		}
+
+		void IntegrateSSE2(float* x, float* y, float* velocityX, float* velocityY, float accelerationX, float accelerationY, float damping, float deltaTime, size_t count)
+		{
+			const __m128 deltaX = _mm_set1_ps(accelerationX * deltaTime), deltaY = _mm_set1_ps(accelerationY * deltaTime);
+			const __m128 dampingFactor = _mm_set1_ps(damping), timestep = _mm_set1_ps(deltaTime);
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 newVelocityX = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocityX + i), deltaX), dampingFactor);
+				const __m128 newVelocityY = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocityY + i), deltaY), dampingFactor);
+				_mm_storeu_ps(velocityX + i, newVelocityX);
+				_mm_storeu_ps(velocityY + i, newVelocityY);
+				_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(newVelocityX, timestep)));
+				_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(newVelocityY, timestep)));
+			}
+
+			IntegrateScalar(x, y, velocityX, velocityY, accelerationX, accelerationY, damping, deltaTime, i, count);
+		}
+
+		size_t AgeSSE2(float* remaining, float amount, size_t count)
+		{
+			const __m128 step = _mm_set1_ps(amount);
+			const __m128 zero = _mm_setzero_ps();
+
+			size_t expiredCount = 0;
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 aged = _mm_sub_ps(_mm_loadu_ps(remaining + i), step);
+				_mm_storeu_ps(remaining + i, aged);
+				expiredCount += std::popcount(static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(aged, zero))));
+			}
+
+			return AgeScalar(remaining, amount, expiredCount, i, count);
+		}
+
+#pragma endregion
+
+#pragma region AVX2
+
+		FLUX_TARGET_AVX2 void TransformPointsAVX2(const Matrix3x3& matrix, const float* x, const float* y, float* outX, float* outY, size_t count)
+		{
+			const __m256 a00 = _mm256_set1_ps(matrix(0, 0)), a01 = _mm256_set1_ps(matrix(0, 1)), a02 = _mm256_set1_ps(matrix(0, 2));
+			const __m256 a10 = _mm256_set1_ps(matrix(1, 0)), a11 = _mm256_set1_ps(matrix(1, 1)), a12 = _mm256_set1_ps(matrix(1, 2));
+
+			// INFO: Separate Multiplies and Adds rather than FMA, so Results Match the Other Levels Exactly
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 pointX = _mm256_loadu_ps(x + i);
+				const __m256 pointY = _mm256_loadu_ps(y + i);
+				_mm256_storeu_ps(outX + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a00, pointX), _mm256_mul_ps(a01, pointY)), a02));
+				_mm256_storeu_ps(outY + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a10, pointX), _mm256_mul_ps(a11, pointY)), a12));
+			}
+
+			TransformPointsScalar(matrix, x, y, outX, outY, i, count);
+		}
+
+		FLUX_TARGET_AVX2 void DotAVX2(const float* ax, const float* ay, const float* bx, const float* by, float* out, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(ax + i), _mm256_loadu_ps(bx + i)), _mm256_mul_ps(_mm256_loadu_ps(ay + i), _mm256_loadu_ps(by + i))));
+			}
+
+			DotScalar(ax, ay, bx, by, out, i, count);
+		}
+
+		FLUX_TARGET_AVX2 void LengthAVX2(const float* x, const float* y, float* out, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 vectorX = _mm256_loadu_ps(x + i);
+				const __m256 vectorY = _mm256_loadu_ps(y + i);
+				_mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vectorX, vectorX), _mm256_mul_ps(vectorY, vectorY))));
+			}
+
+			LengthScalar(x, y, out, i, count);
+		}
+
+		FLUX_TARGET_AVX2 void MergeAVX2(AABB& result, const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count)
+		{
+			__m256 resultMinX = _mm256_set1_ps(result.min.x), resultMinY = _mm256_set1_ps(result.min.y);
+			__m256 resultMaxX = _mm256_set1_ps(result.max.x), resultMaxY = _mm256_set1_ps(result.max.y);
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				resultMinX = _mm256_min_ps(resultMinX, _mm256_loadu_ps(minX + i));
+				resultMinY = _mm256_min_ps(resultMinY, _mm256_loadu_ps(minY + i));
+				resultMaxX = _mm256_max_ps(resultMaxX, _mm256_loadu_ps(maxX + i));
+				resultMaxY = _mm256_max_ps(resultMaxY, _mm256_loadu_ps(maxY + i));
+			}
+
+			// INFO: Fold the Upper Halves onto the Lower, then Finish with the SSE Reduction
+			const float mergedMinX = HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(resultMinX), _mm256_extractf128_ps(resultMinX, 1)));
+			const float mergedMinY = HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(resultMinY), _mm256_extractf128_ps(resultMinY, 1)));
+			const float mergedMaxX = HorizontalMax(_mm_max_ps(_mm256_castps256_ps128(resultMaxX), _mm256_extractf128_ps(resultMaxX, 1)));
+			const float mergedMaxY = HorizontalMax(_mm_max_ps(_mm256_castps256_ps128(resultMaxY), _mm256_extractf128_ps(resultMaxY, 1)));
+
+			result = AABB(Vector2F(mergedMinX, mergedMinY), Vector2F(mergedMaxX, mergedMaxY));
+			MergeScalar(result, minX, minY, maxX, maxY, i, count);
+		}
+
+		FLUX_TARGET_AVX2 size_t CullAVX2(const AABB& bounds, const float* minX, const float* minY, const float* maxX, const float* maxY, uint32_t* outIndices, size_t count)
+		{
+			const __m256 boundsMinX = _mm256_set1_ps(bounds.min.x), boundsMinY = _mm256_set1_ps(bounds.min.y);
+			const __m256 boundsMaxX = _mm256_set1_ps(bounds.max.x), boundsMaxY = _mm256_set1_ps(bounds.max.y);
+
+			size_t visibleCount = 0;
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 overlapsX = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minX + i), boundsMaxX, _CMP_LE_OQ), _mm256_cmp_ps(_mm256_loadu_ps(maxX + i), boundsMinX, _CMP_GE_OQ));
+				const __m256 overlapsY = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minY + i), boundsMaxY, _CMP_LE_OQ), _mm256_cmp_ps(_mm256_loadu_ps(maxY + i), boundsMinY, _CMP_GE_OQ));
+				uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(overlapsX, overlapsY)));
+
+				while (mask != 0)
+				{
+					outIndices[visibleCount++] = static_cast<uint32_t>(i) + std::countr_zero(mask);
+					mask &= mask - 1;
+				}
+			}
+
+			return CullScalar(bounds, minX, minY, maxX, maxY, outIndices, visibleCount, i, count);
+		}
+
+		FLUX_TARGET_AVX2 void IntegrateAVX2(float* x, float* y, float* velocityX, float* velocityY, float accelerationX, float accelerationY, float damping, float deltaTime, size_t count)
+		{
+			const __m256 deltaX = _mm256_set1_ps(accelerationX * deltaTime), deltaY = _mm256_set1_ps(accelerationY * deltaTime);
+			const __m256 dampingFactor = _mm256_set1_ps(damping), timestep = _mm256_set1_ps(deltaTime);
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 newVelocityX = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(velocityX + i), deltaX), dampingFactor);
+				const __m256 newVelocityY = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(velocityY + i), deltaY), dampingFactor);
+				_mm256_storeu_ps(velocityX + i, newVelocityX);
+				_mm256_storeu_ps(velocityY + i, newVelocityY);
+				_mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(newVelocityX, timestep)));
+				_mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(newVelocityY, timestep)));
+			}
+
+			IntegrateScalar(x, y, velocityX, velocityY, accelerationX, accelerationY, damping, deltaTime, i, count);
+		}
+
+		FLUX_TARGET_AVX2 size_t AgeAVX2(float* remaining, float amount, size_t count)
+		{
+			const __m256 step = _mm256_set1_ps(amount);
+			const __m256 zero = _mm256_setzero_ps();
+
+			size_t expiredCount = 0;
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 aged = _mm256_sub_ps(_mm256_loadu_ps(remaining + i), step);
+				_mm256_storeu_ps(remaining + i, aged);
+				expiredCount += std::popcount(static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(aged, zero, _CMP_LE_OQ))));
+			}
+
+			return AgeScalar(remaining, amount, expiredCount, i, count);
+		}
+
+#pragma endregion
+
+#endif
+	}
+
+	SIMDLevel GetSupportedSIMDLevel()
+	{
+		static const SIMDLevel supportedLevel = DetectSIMDLevel();
+		return supportedLevel;
+	}
+
+	SIMDLevel GetSIMDLevel()
+	{
+		return GetActiveSIMDLevel().load(std::memory_order_relaxed);
+	}
+
+	void SetSIMDLevel(SIMDLevel level)
+	{
+		GetActiveSIMDLevel().store(std::min(level, GetSupportedSIMDLevel()), std::memory_order_relaxed);
+	}
+
+	const char* SIMDLevelToString(SIMDLevel level)
+	{
+		switch (level)
+		{
+			case SIMDLevel::Scalar: return "Scalar";
+			case SIMDLevel::SSE2: return "SSE2";
+			case SIMDLevel::AVX2: return "AVX2";
+			default: return "Unknown";
+		}
+	}
+
+	void TransformPoints(const Matrix3x3& matrix, const float* x, const float* y, float* outX, float* outY, size_t count)
+	{
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: TransformPointsAVX2(matrix, x, y, outX, outY, count); break;
+			case SIMDLevel::SSE2: TransformPointsSSE2(matrix, x, y, outX, outY, count); break;
+#endif
+			default: TransformPointsScalar(matrix, x, y, outX, outY, 0, count); break;
+		}
+	}
+
+	void Dot(const float* ax, const float* ay, const float* bx, const float* by, float* out, size_t count)
+	{
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: DotAVX2(ax, ay, bx, by, out, count); break;
+			case SIMDLevel::SSE2: DotSSE2(ax, ay, bx, by, out, count); break;
+#endif
+			default: DotScalar(ax, ay, bx, by, out, 0, count); break;
+		}
+	}
+
+	void Length(const float* x, const float* y, float* out, size_t count)
+	{
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: LengthAVX2(x, y, out, count); break;
+			case SIMDLevel::SSE2: LengthSSE2(x, y, out, count); break;
+#endif
+			default: LengthScalar(x, y, out, 0, count); break;
+		}
+	}
+
+	AABB Merge(const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count)
+	{
+		constexpr float Infinity = std::numeric_limits<float>::infinity();
+		AABB result(Vector2F(Infinity, Infinity), Vector2F(-Infinity, -Infinity));
+
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: MergeAVX2(result, minX, minY, maxX, maxY, count); break;
+			case SIMDLevel::SSE2: MergeSSE2(result, minX, minY, maxX, maxY, count); break;
+#endif
+			default: MergeScalar(result, minX, minY, maxX, maxY, 0, count); break;
+		}
+
+		return result;
+	}
+
+	size_t Cull(const AABB& bounds, const float* minX, const float* minY, const float* maxX, const float* maxY, uint32_t* outIndices, size_t count)
+	{
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: return CullAVX2(bounds, minX, minY, maxX, maxY, outIndices, count);
+			case SIMDLevel::SSE2: return CullSSE2(bounds, minX, minY, maxX, maxY, outIndices, count);
+#endif
+			default: return CullScalar(bounds, minX, minY, maxX, maxY, outIndices, 0, 0, count);
+		}
+	}
+
+	void Integrate(float* x, float* y, float* velocityX, float* velocityY, float accelerationX, float accelerationY, float damping, float deltaTime, size_t count)
+	{
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: IntegrateAVX2(x, y, velocityX, velocityY, accelerationX, accelerationY, damping, deltaTime, count); break;
+			case SIMDLevel::SSE2: IntegrateSSE2(x, y, velocityX, velocityY, accelerationX, accelerationY, damping, deltaTime, count); break;
+#endif
+			default: IntegrateScalar(x, y, velocityX, velocityY, accelerationX, accelerationY, damping, deltaTime, 0, count); break;
+		}
+	}
+
+	size_t Age(float* remaining, float amount, size_t count)
+	{
+		switch (GetSIMDLevel())
+		{
+#ifdef FLUX_SIMD_X86
+			case SIMDLevel::AVX2: return AgeAVX2(remaining, amount, count);
+			case SIMDLevel::SSE2: return AgeSSE2(remaining, amount, count);
+#endif
+			default: return AgeScalar(remaining, amount, 0, 0, count);
+		}
+	}
+}
\ No newline at end of file
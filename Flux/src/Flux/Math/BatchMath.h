@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "AABB.h"
+#include "Matrix3x3.h"
+
+namespace Flux
+{
+	enum class SIMDLevel : uint8_t
+	{
+		Scalar = 0,
+		SSE2,
+		AVX2
+	};
+
+	/// <summary>
+	/// Kernels over structure-of-arrays data (Separate x and y arrays rather than an array of Vector2F), vectorised with SSE2 or AVX2
+	/// depending on the CPU, with a scalar fallback on other platforms. Every level produces the same results for finite inputs (No FMA contraction).
+	/// Output arrays may alias the matching input arrays, unaligned pointers are fine.
+	/// </summary>
+	namespace BatchMath
+	{
+		/// <summary>
+		/// Highest level the CPU and OS support, detected once
+		/// </summary>
+		SIMDLevel GetSupportedSIMDLevel();
+
+		SIMDLevel GetSIMDLevel();
+
+		/// <summary>
+		/// Forces a lower level (e.g. to benchmark or compare against the scalar path), clamped to what is supported
+		/// </summary>
+		void SetSIMDLevel(SIMDLevel level);
+
+		const char* SIMDLevelToString(SIMDLevel level);
+
+		/// <summary>
+		/// outX[i], outY[i] = matrix.TransformPoint(x[i], y[i])
+		/// </summary>
+		void TransformPoints(const Matrix3x3& matrix, const float* x, const float* y, float* outX, float* outY, size_t count);
+
+		/// <summary>
+		/// out[i] = (ax[i], ay[i]).Dot(bx[i], by[i])
+		/// </summary>
+		void Dot(const float* ax, const float* ay, const float* bx, const float* by, float* out, size_t count);
+
+		/// <summary>
+		/// out[i] = (x[i], y[i]).Length()
+		/// </summary>
+		void Length(const float* x, const float* y, float* out, size_t count);
+
+		/// <summary>
+		/// Box around every box, an empty batch returns an inverted box (min = +infinity, max = -infinity) that any Union replaces
+		/// </summary>
+		AABB Merge(const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count);
+
+		/// <summary>
+		/// Writes the index of every box overlapping bounds (As AABB::Overlaps) to outIndices in ascending order, returns how many.
+		/// outIndices needs room for count indices.
+		/// </summary>
+		size_t Cull(const AABB& bounds, const float* minX, const float* minY, const float* maxX, const float* maxY, uint32_t* outIndices, size_t count);
+
+		/// <summary>
+		/// Semi-implicit Euler step in place, velocity = (velocity + acceleration * deltaTime) * damping, then position += velocity * deltaTime
+		/// </summary>
+		void Integrate(float* x, float* y, float* velocityX, float* velocityY, float accelerationX, float accelerationY, float damping, float deltaTime, size_t count);
+
+		/// <summary>
+		/// remaining[i] -= amount in place, returns how many are left at or below zero (e.g. expired lifetimes)
+		/// </summary>
+		size_t Age(float* remaining, float amount, size_t count);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <cmath>
+#include <format>
+#include <numbers>
+#include <sfml/Graphics/Transform.hpp>
+#include <string>
+
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// 2D affine transform (Bottom row 0, 0, 1 unless built by hand), same conventions as sf::Transform: column vectors,
+	/// clockwise rotation in degrees in SFML's y-down coordinates, and a * b applies b first.
+	/// Stored column-major, elements are accessed as (row, column).
+	/// </summary>
+	struct Matrix3x3
+	{
+		std::array<float, 9> elements = { 1.0f, 0.0f, 0.0f,
+										  0.0f, 1.0f, 0.0f,
+										  0.0f, 0.0f, 1.0f };
+
+		constexpr Matrix3x3() = default;
+
+		/// <summary>
+		/// Elements in row order, as they are written on paper (and as sf::Transform takes them)
+		/// </summary>
+		constexpr Matrix3x3(float a00, float a01, float a02, float a10, float a11, float a12, float a20, float a21, float a22)
+			: elements{ a00, a10, a20, a01, a11, a21, a02, a12, a22 } {}
+
+		constexpr Matrix3x3(const sf::Transform& transform)
+		{
+			const float* matrix = transform.getMatrix();
+			elements = { matrix[0], matrix[1], matrix[3], matrix[4], matrix[5], matrix[7], matrix[12], matrix[13], matrix[15] };
+		}
+
+		constexpr operator sf::Transform() const
+		{
+			return sf::Transform((*this)(0, 0), (*this)(0, 1), (*this)(0, 2), (*this)(1, 0), (*this)(1, 1), (*this)(1, 2), (*this)(2, 0), (*this)(2, 1), (*this)(2, 2));
+		}
+
+		static constexpr Matrix3x3 Identity() { return Matrix3x3(); }
+
+		static constexpr Matrix3x3 Translation(const Vector2F& offset)
+		{
+			return Matrix3x3(1.0f, 0.0f, offset.x, 0.0f, 1.0f, offset.y, 0.0f, 0.0f, 1.0f);
+		}
+
+		static Matrix3x3 Rotation(float degrees)
+		{
+			const float radians = degrees * (std::numbers::pi_v<float> / 180.0f);
+			const float cosine = std::cos(radians);
+			const float sine = std::sin(radians);
+			return Matrix3x3(cosine, -sine, 0.0f, sine, cosine, 0.0f, 0.0f, 0.0f, 1.0f);
+		}
+
+		static constexpr Matrix3x3 Scale(const Vector2F& scale)
+		{
+			return Matrix3x3(scale.x, 0.0f, 0.0f, 0.0f, scale.y, 0.0f, 0.0f, 0.0f, 1.0f);
+		}
+
+		/// <summary>
+		/// Scales, then rotates, then translates, about origin (Matches sf::Transformable::getTransform)
+		/// </summary>
+		static Matrix3x3 FromTransform(const Vector2F& position, float rotation, const Vector2F& scale = Vector2F(1.0f, 1.0f), const Vector2F& origin = Vector2F())
+		{
+			const float radians = rotation * (std::numbers::pi_v<float> / 180.0f);
+			const float cosine = std::cos(radians);
+			const float sine = std::sin(radians);
+
+			const float a00 = cosine * scale.x;
+			const float a01 = -sine * scale.y;
+			const float a10 = sine * scale.x;
+			const float a11 = cosine * scale.y;
+
+			return Matrix3x3(a00, a01, position.x - origin.x * a00 - origin.y * a01,
+							 a10, a11, position.y - origin.x * a10 - origin.y * a11,
+							 0.0f, 0.0f, 1.0f);
+		}
+
+		constexpr float& operator()(int row, int column) { return elements[column * 3 + row]; }
+		constexpr float operator()(int row, int column) const { return elements[column * 3 + row]; }
+
+		constexpr const float* GetData() const { return elements.data(); }
+
+		constexpr Vector2F TransformPoint(const Vector2F& point) const
+		{
+			return Vector2F(elements[0] * point.x + elements[3] * point.y + elements[6], elements[1] * point.x + elements[4] * point.y + elements[7]);
+		}
+
+		/// <summary>
+		/// Ignores translation, for directions and offsets
+		/// </summary>
+		constexpr Vector2F TransformVector(const Vector2F& vector) const
+		{
+			return Vector2F(elements[0] * vector.x + elements[3] * vector.y, elements[1] * vector.x + elements[4] * vector.y);
+		}
+
+		constexpr Vector3F operator*(const Vector3F& vector) const
+		{
+			return Vector3F(elements[0] * vector.x + elements[3] * vector.y + elements[6] * vector.z,
+							elements[1] * vector.x + elements[4] * vector.y + elements[7] * vector.z,
+							elements[2] * vector.x + elements[5] * vector.y + elements[8] * vector.z);
+		}
+
+		constexpr Matrix3x3 operator*(const Matrix3x3& other) const
+		{
+			Matrix3x3 result;
+			for (int column = 0; column < 3; ++column)
+			{
+				for (int row = 0; row < 3; ++row)
+				{
+					result(row, column) = (*this)(row, 0) * other(0, column) + (*this)(row, 1) * other(1, column) + (*this)(row, 2) * other(2, column);
+				}
+			}
+			return result;
+		}
+
+		constexpr Matrix3x3& operator*=(const Matrix3x3& other) { return *this = *this * other; }
+
+		constexpr bool operator==(const Matrix3x3& other) const = default;
+
+		constexpr float GetDeterminant() const
+		{
+			const Matrix3x3& m = *this;
+			return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+		}
+
+		/// <summary>
+		/// Returns the identity if the matrix can't be inverted (Same as sf::Transform::getInverse)
+		/// </summary>
+		constexpr Matrix3x3 GetInverse() const
+		{
+			const float determinant = GetDeterminant();
+			if (determinant == 0.0f) { return Identity(); }
+
+			const Matrix3x3& m = *this;
+			const float inverse = 1.0f / determinant;
+			return Matrix3x3((m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) * inverse, (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * inverse, (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * inverse,
+							 (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) * inverse, (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * inverse, (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * inverse,
+							 (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0)) * inverse, (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * inverse, (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * inverse);
+		}
+
+		std::string ToString() const
+		{
+			const Matrix3x3& m = *this;
+			return std::format("[{0}, {1}, {2} | {3}, {4}, {5} | {6}, {7}, {8}]", m(0, 0), m(0, 1), m(0, 2), m(1, 0), m(1, 1), m(1, 2), m(2, 0), m(2, 1), m(2, 2));
+		}
+	};
+}
+
+// INFO: Specialization for Logging Matrix3x3
+template<typename CharT>
+struct std::formatter<Flux::Matrix3x3, CharT> : std::formatter<std::string>
+{
+	template <typename FormatContext>
+	FormatContext::iterator format(const Flux::Matrix3x3& matrix, FormatContext& ctx) const
+	{
+		return std::formatter<std::string>::format(matrix.ToString(), ctx);
+	}
+};
\ No newline at end of file
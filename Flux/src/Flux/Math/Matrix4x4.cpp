@@ -0,0 +1,86 @@
+#include "FluxPCH.h"
+
+#include "Matrix4x4.h"
+
+namespace Flux
+{
+	Vector3F Matrix4x4::TransformPoint(const Vector3F& point) const
+	{
+		const Vector4F result = *this * Vector4F(point, 1.0f);
+		return result.w != 0.0f && result.w != 1.0f ? result.GetXYZ() / result.w : result.GetXYZ();
+	}
+
+	float Matrix4x4::GetDeterminant() const
+	{
+		const Matrix4x4& m = *this;
+
+		// INFO: Laplace Expansion Along the First Row, Using 2x2 Minors of the Bottom Two Rows
+		const float s0 = m(2, 0) * m(3, 1) - m(2, 1) * m(3, 0);
+		const float s1 = m(2, 0) * m(3, 2) - m(2, 2) * m(3, 0);
+		const float s2 = m(2, 0) * m(3, 3) - m(2, 3) * m(3, 0);
+		const float s3 = m(2, 1) * m(3, 2) - m(2, 2) * m(3, 1);
+		const float s4 = m(2, 1) * m(3, 3) - m(2, 3) * m(3, 1);
+		const float s5 = m(2, 2) * m(3, 3) - m(2, 3) * m(3, 2);
+
+		return m(0, 0) * (m(1, 1) * s5 - m(1, 2) * s4 + m(1, 3) * s3)
+			 - m(0, 1) * (m(1, 0) * s5 - m(1, 2) * s2 + m(1, 3) * s1)
+			 + m(0, 2) * (m(1, 0) * s4 - m(1, 1) * s2 + m(1, 3) * s0)
+			 - m(0, 3) * (m(1, 0) * s3 - m(1, 1) * s1 + m(1, 2) * s0);
+	}
+
+	Matrix4x4 Matrix4x4::GetInverse() const
+	{
+		const Matrix4x4& m = *this;
+
+		// INFO: Adjugate from 2x2 Minors of the Top (s) and Bottom (c) Row Pairs
+		const float s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+		const float s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+		const float s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+		const float s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+		const float s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+		const float s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+
+		const float c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+		const float c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+		const float c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+		const float c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+		const float c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+		const float c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+
+		const float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		if (determinant == 0.0f) { return Identity(); }
+
+		const float inverse = 1.0f / determinant;
+
+		Matrix4x4 result;
+		result(0, 0) = ( m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3) * inverse;
+		result(0, 1) = (-m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3) * inverse;
+		result(0, 2) = ( m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3) * inverse;
+		result(0, 3) = (-m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3) * inverse;
+
+		result(1, 0) = (-m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1) * inverse;
+		result(1, 1) = ( m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1) * inverse;
+		result(1, 2) = (-m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1) * inverse;
+		result(1, 3) = ( m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1) * inverse;
+
+		result(2, 0) = ( m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0) * inverse;
+		result(2, 1) = (-m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0) * inverse;
+		result(2, 2) = ( m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0) * inverse;
+		result(2, 3) = (-m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0) * inverse;
+
+		result(3, 0) = (-m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0) * inverse;
+		result(3, 1) = ( m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0) * inverse;
+		result(3, 2) = (-m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0) * inverse;
+		result(3, 3) = ( m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0) * inverse;
+
+		return result;
+	}
+
+	std::string Matrix4x4::ToString() const
+	{
+		const Matrix4x4& m = *this;
+		return std::format("[{0}, {1}, {2}, {3} | {4}, {5}, {6}, {7} | {8}, {9}, {10}, {11} | {12}, {13}, {14}, {15}]",
+						   m(0, 0), m(0, 1), m(0, 2), m(0, 3), m(1, 0), m(1, 1), m(1, 2), m(1, 3),
+						   m(2, 0), m(2, 1), m(2, 2), m(2, 3), m(3, 0), m(3, 1), m(3, 2), m(3, 3));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <format>
+#include <sfml/Graphics/Transform.hpp>
+#include <string>
+
+#include "Matrix3x3.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// 4x4 matrix for shaders and cameras, column-major like OpenGL (and sf::Transform::getMatrix) so GetData can be uploaded directly.
+	/// Column vectors, a * b applies b first, elements are accessed as (row, column).
+	/// </summary>
+	struct Matrix4x4
+	{
+		std::array<float, 16> elements = { 1.0f, 0.0f, 0.0f, 0.0f,
+										   0.0f, 1.0f, 0.0f, 0.0f,
+										   0.0f, 0.0f, 1.0f, 0.0f,
+										   0.0f, 0.0f, 0.0f, 1.0f };
+
+		constexpr Matrix4x4() = default;
+
+		/// <summary>
+		/// Embeds a 2D affine transform, z passes through unchanged
+		/// </summary>
+		constexpr explicit Matrix4x4(const Matrix3x3& matrix)
+			: elements{ matrix(0, 0), matrix(1, 0), 0.0f, matrix(2, 0),
+						matrix(0, 1), matrix(1, 1), 0.0f, matrix(2, 1),
+						0.0f, 0.0f, 1.0f, 0.0f,
+						matrix(0, 2), matrix(1, 2), 0.0f, matrix(2, 2) } {}
+
+		constexpr Matrix4x4(const sf::Transform& transform)
+		{
+			const float* matrix = transform.getMatrix();
+			for (size_t i = 0; i < elements.size(); ++i) { elements[i] = matrix[i]; }
+		}
+
+		static constexpr Matrix4x4 Identity() { return Matrix4x4(); }
+		static constexpr Matrix4x4 Translation(const Vector3F& offset);
+		static constexpr Matrix4x4 Scale(const Vector3F& scale);
+
+		/// <summary>
+		/// Clockwise in degrees in SFML's y-down coordinates, the only rotation a 2D engine needs
+		/// </summary>
+		static Matrix4x4 RotationZ(float degrees) { return Matrix4x4(Matrix3x3::Rotation(degrees)); }
+
+		/// <summary>
+		/// Maps the box to OpenGL clip space ([-1, 1] on every axis), pass top < bottom for SFML's y-down screen space
+		/// </summary>
+		static constexpr Matrix4x4 Orthographic(float left, float right, float bottom, float top, float nearPlane = -1.0f, float farPlane = 1.0f);
+
+		constexpr float& operator()(int row, int column) { return elements[column * 4 + row]; }
+		constexpr float operator()(int row, int column) const { return elements[column * 4 + row]; }
+
+		constexpr const float* GetData() const { return elements.data(); }
+
+		/// <summary>
+		/// Drops the z row and column, exact for matrices built from 2D transforms
+		/// </summary>
+		constexpr Matrix3x3 ToMatrix3x3() const
+		{
+			const Matrix4x4& m = *this;
+			return Matrix3x3(m(0, 0), m(0, 1), m(0, 3), m(1, 0), m(1, 1), m(1, 3), m(3, 0), m(3, 1), m(3, 3));
+		}
+
+		constexpr Vector4F operator*(const Vector4F& vector) const
+		{
+			const Matrix4x4& m = *this;
+			return Vector4F(m(0, 0) * vector.x + m(0, 1) * vector.y + m(0, 2) * vector.z + m(0, 3) * vector.w,
+							m(1, 0) * vector.x + m(1, 1) * vector.y + m(1, 2) * vector.z + m(1, 3) * vector.w,
+							m(2, 0) * vector.x + m(2, 1) * vector.y + m(2, 2) * vector.z + m(2, 3) * vector.w,
+							m(3, 0) * vector.x + m(3, 1) * vector.y + m(3, 2) * vector.z + m(3, 3) * vector.w);
+		}
+
+		/// <summary>
+		/// Treats the point as w = 1 and divides by the resulting w (A no-op for affine matrices)
+		/// </summary>
+		Vector3F TransformPoint(const Vector3F& point) const;
+
+		constexpr Matrix4x4 operator*(const Matrix4x4& other) const
+		{
+			Matrix4x4 result;
+			for (int column = 0; column < 4; ++column)
+			{
+				for (int row = 0; row < 4; ++row)
+				{
+					result(row, column) = (*this)(row, 0) * other(0, column) + (*this)(row, 1) * other(1, column) + (*this)(row, 2) * other(2, column) + (*this)(row, 3) * other(3, column);
+				}
+			}
+			return result;
+		}
+
+		constexpr Matrix4x4& operator*=(const Matrix4x4& other) { return *this = *this * other; }
+
+		constexpr bool operator==(const Matrix4x4& other) const = default;
+
+		constexpr Matrix4x4 GetTransposed() const
+		{
+			Matrix4x4 result;
+			for (int column = 0; column < 4; ++column)
+			{
+				for (int row = 0; row < 4; ++row) { result(row, column) = (*this)(column, row); }
+			}
+			return result;
+		}
+
+		float GetDeterminant() const;
+
+		/// <summary>
+		/// Returns the identity if the matrix can't be inverted
+		/// </summary>
+		Matrix4x4 GetInverse() const;
+
+		std::string ToString() const;
+	};
+
+	constexpr Matrix4x4 Matrix4x4::Translation(const Vector3F& offset)
+	{
+		Matrix4x4 result;
+		result(0, 3) = offset.x;
+		result(1, 3) = offset.y;
+		result(2, 3) = offset.z;
+		return result;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::Scale(const Vector3F& scale)
+	{
+		Matrix4x4 result;
+		result(0, 0) = scale.x;
+		result(1, 1) = scale.y;
+		result(2, 2) = scale.z;
+		return result;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane)
+	{
+		Matrix4x4 result;
+		result(0, 0) = 2.0f / (right - left);
+		result(1, 1) = 2.0f / (top - bottom);
+		result(2, 2) = -2.0f / (farPlane - nearPlane);
+		result(0, 3) = -(right + left) / (right - left);
+		result(1, 3) = -(top + bottom) / (top - bottom);
+		result(2, 3) = -(farPlane + nearPlane) / (farPlane - nearPlane);
+		return result;
+	}
+}
+
+// INFO: Specialization for Logging Matrix4x4
+template<typename CharT>
+struct std::formatter<Flux::Matrix4x4, CharT> : std::formatter<std::string>
+{
+	template <typename FormatContext>
+	FormatContext::iterator format(const Flux::Matrix4x4& matrix, FormatContext& ctx) const
+	{
+		return std::formatter<std::string>::format(matrix.ToString(), ctx);
+	}
+};
\ No newline at end of file
@@ -2,35 +2,68 @@
 
 #include "Flux/Core.h"
 
+#include <cmath>
+#include <format>
 #include <sfml/System/Vector2.hpp>
 #include <string>
 
 namespace Flux
 {
 	/// <summary>
-	/// Wrapper class for Vector2 provided by SFML
+	/// 2D vector, layout compatible with sf::Vector2 and implicitly convertible to and from it
 	/// </summary>
 	template <typename T>
-	class Vector2 : public sf::Vector2<T>
+	struct Vector2
 	{
-	public:
-		Vector2() : sf::Vector2<T>() {}
-		Vector2(T x, T y) : sf::Vector2<T>(x, y) {}
-		Vector2(const sf::Vector2<T>& vector) : sf::Vector2<T>(vector) {}
+		T x = T();
+		T y = T();
 
-		std::string ToString() const
+		constexpr Vector2() = default;
+		constexpr Vector2(T x, T y) : x(x), y(y) {}
+		constexpr Vector2(const sf::Vector2<T>& vector) : x(vector.x), y(vector.y) {}
+
+		template<typename U>
+		constexpr explicit Vector2(const Vector2<U>& vector) : x(static_cast<T>(vector.x)), y(static_cast<T>(vector.y)) {}
+
+		constexpr operator sf::Vector2<T>() const { return sf::Vector2<T>(x, y); }
+
+		constexpr T Dot(const Vector2& other) const { return x * other.x + y * other.y; }
+
+		/// <summary>
+		/// Z component of the 3D cross product, positive when other is clockwise of this in SFML's y-down coordinates
+		/// </summary>
+		constexpr T Cross(const Vector2& other) const { return x * other.y - y * other.x; }
+
+		constexpr T LengthSquared() const { return x * x + y * y; }
+		T Length() const { return static_cast<T>(std::sqrt(LengthSquared())); }
+
+		/// <summary>
+		/// Returns the zero vector rather than dividing by zero
+		/// </summary>
+		Vector2 Normalised() const
 		{
-			return std::format("({0}, {1})", this->x, this->y);
+			const T length = Length();
+			return length != T() ? Vector2(x / length, y / length) : Vector2();
 		}
 
-		Vector2<T>& operator=(const sf::Vector2<T>& other)
+		std::string ToString() const
 		{
-			if (this == &other) { return *this; }
-
-			this->x = other.x;
-			this->y = other.y;
-			return *this;
+			return std::format("({0}, {1})", x, y);
 		}
+
+		constexpr Vector2& operator+=(const Vector2& other) { x += other.x; y += other.y; return *this; }
+		constexpr Vector2& operator-=(const Vector2& other) { x -= other.x; y -= other.y; return *this; }
+		constexpr Vector2& operator*=(T scalar) { x *= scalar; y *= scalar; return *this; }
+		constexpr Vector2& operator/=(T scalar) { x /= scalar; y /= scalar; return *this; }
+
+		// INFO: Hidden Friends, so sf::Vector2 Operands Convert Implicitly without Clashing with SFML's Operator Templates
+		friend constexpr Vector2 operator+(const Vector2& a, const Vector2& b) { return Vector2(a.x + b.x, a.y + b.y); }
+		friend constexpr Vector2 operator-(const Vector2& a, const Vector2& b) { return Vector2(a.x - b.x, a.y - b.y); }
+		friend constexpr Vector2 operator-(const Vector2& vector) { return Vector2(-vector.x, -vector.y); }
+		friend constexpr Vector2 operator*(const Vector2& vector, T scalar) { return Vector2(vector.x * scalar, vector.y * scalar); }
+		friend constexpr Vector2 operator*(T scalar, const Vector2& vector) { return Vector2(vector.x * scalar, vector.y * scalar); }
+		friend constexpr Vector2 operator/(const Vector2& vector, T scalar) { return Vector2(vector.x / scalar, vector.y / scalar); }
+		friend constexpr bool operator==(const Vector2& a, const Vector2& b) { return a.x == b.x && a.y == b.y; }
 	};
 
 	using Vector2I = Vector2<int>;
@@ -45,7 +78,7 @@ std::ostream& operator<<(std::ostream& os, const Flux::Vector2<T>& vector)
 	return os;
 }
 
-// INFO: Specialization for Logging Vector2 Wrapper
+// INFO: Specialization for Logging Vector2
 template<typename T, typename CharT>
 struct std::formatter<Flux::Vector2<T>, CharT> : std::formatter<std::string>
 {
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cmath>
+#include <format>
+#include <sfml/System/Vector3.hpp>
+#include <string>
+
+#include "Vector2.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// 3D vector, layout compatible with sf::Vector3 and implicitly convertible to and from it
+	/// </summary>
+	template <typename T>
+	struct Vector3
+	{
+		T x = T();
+		T y = T();
+		T z = T();
+
+		constexpr Vector3() = default;
+		constexpr Vector3(T x, T y, T z) : x(x), y(y), z(z) {}
+		constexpr Vector3(const Vector2<T>& vector, T z) : x(vector.x), y(vector.y), z(z) {}
+		constexpr Vector3(const sf::Vector3<T>& vector) : x(vector.x), y(vector.y), z(vector.z) {}
+
+		template<typename U>
+		constexpr explicit Vector3(const Vector3<U>& vector) : x(static_cast<T>(vector.x)), y(static_cast<T>(vector.y)), z(static_cast<T>(vector.z)) {}
+
+		constexpr operator sf::Vector3<T>() const { return sf::Vector3<T>(x, y, z); }
+
+		constexpr Vector2<T> GetXY() const { return Vector2<T>(x, y); }
+
+		constexpr T Dot(const Vector3& other) const { return x * other.x + y * other.y + z * other.z; }
+		constexpr Vector3 Cross(const Vector3& other) const { return Vector3(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x); }
+
+		constexpr T LengthSquared() const { return Dot(*this); }
+		T Length() const { return static_cast<T>(std::sqrt(LengthSquared())); }
+
+		/// <summary>
+		/// Returns the zero vector rather than dividing by zero
+		/// </summary>
+		Vector3 Normalised() const
+		{
+			const T length = Length();
+			return length != T() ? Vector3(x / length, y / length, z / length) : Vector3();
+		}
+
+		std::string ToString() const
+		{
+			return std::format("({0}, {1}, {2})", x, y, z);
+		}
+
+		constexpr Vector3& operator+=(const Vector3& other) { x += other.x; y += other.y; z += other.z; return *this; }
+		constexpr Vector3& operator-=(const Vector3& other) { x -= other.x; y -= other.y; z -= other.z; return *this; }
+		constexpr Vector3& operator*=(T scalar) { x *= scalar; y *= scalar; z *= scalar; return *this; }
+		constexpr Vector3& operator/=(T scalar) { x /= scalar; y /= scalar; z /= scalar; return *this; }
+
+		friend constexpr Vector3 operator+(const Vector3& a, const Vector3& b) { return Vector3(a.x + b.x, a.y + b.y, a.z + b.z); }
+		friend constexpr Vector3 operator-(const Vector3& a, const Vector3& b) { return Vector3(a.x - b.x, a.y - b.y, a.z - b.z); }
+		friend constexpr Vector3 operator-(const Vector3& vector) { return Vector3(-vector.x, -vector.y, -vector.z); }
+		friend constexpr Vector3 operator*(const Vector3& vector, T scalar) { return Vector3(vector.x * scalar, vector.y * scalar, vector.z * scalar); }
+		friend constexpr Vector3 operator*(T scalar, const Vector3& vector) { return Vector3(vector.x * scalar, vector.y * scalar, vector.z * scalar); }
+		friend constexpr Vector3 operator/(const Vector3& vector, T scalar) { return Vector3(vector.x / scalar, vector.y / scalar, vector.z / scalar); }
+		friend constexpr bool operator==(const Vector3& a, const Vector3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+	};
+
+	using Vector3I = Vector3<int>;
+	using Vector3F = Vector3<float>;
+}
+
+// INFO: Specialization for Logging Vector3
+template<typename T, typename CharT>
+struct std::formatter<Flux::Vector3<T>, CharT> : std::formatter<std::string>
+{
+	template <typename FormatContext>
+	FormatContext::iterator format(const Flux::Vector3<T>& vector, FormatContext& ctx) const
+	{
+		return std::formatter<std::string>::format(vector.ToString(), ctx);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <sfml/Graphics/Color.hpp>
+#include <string>
+
+#include "Vector3.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// 4D vector, homogeneous coordinates for Matrix4x4 and normalised colours (SFML has no 4D vector to convert to)
+	/// </summary>
+	template <typename T>
+	struct Vector4
+	{
+		T x = T();
+		T y = T();
+		T z = T();
+		T w = T();
+
+		constexpr Vector4() = default;
+		constexpr Vector4(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
+		constexpr Vector4(const Vector3<T>& vector, T w) : x(vector.x), y(vector.y), z(vector.z), w(w) {}
+
+		template<typename U>
+		constexpr explicit Vector4(const Vector4<U>& vector) : x(static_cast<T>(vector.x)), y(static_cast<T>(vector.y)), z(static_cast<T>(vector.z)), w(static_cast<T>(vector.w)) {}
+
+		/// <summary>
+		/// Colour channels mapped from 0-255 to 0-1 (x = red, w = alpha)
+		/// </summary>
+		static constexpr Vector4 FromColor(sf::Color color)
+		{
+			return Vector4(static_cast<T>(color.r) / T(255), static_cast<T>(color.g) / T(255), static_cast<T>(color.b) / T(255), static_cast<T>(color.a) / T(255));
+		}
+
+		sf::Color ToColor() const
+		{
+			auto toChannel = [](T value) { return static_cast<std::uint8_t>(std::lround(std::clamp(static_cast<double>(value), 0.0, 1.0) * 255.0)); };
+			return sf::Color(toChannel(x), toChannel(y), toChannel(z), toChannel(w));
+		}
+
+		constexpr Vector3<T> GetXYZ() const { return Vector3<T>(x, y, z); }
+
+		constexpr T Dot(const Vector4& other) const { return x * other.x + y * other.y + z * other.z + w * other.w; }
+
+		constexpr T LengthSquared() const { return Dot(*this); }
+		T Length() const { return static_cast<T>(std::sqrt(LengthSquared())); }
+
+		std::string ToString() const
+		{
+			return std::format("({0}, {1}, {2}, {3})", x, y, z, w);
+		}
+
+		constexpr Vector4& operator+=(const Vector4& other) { x += other.x; y += other.y; z += other.z; w += other.w; return *this; }
+		constexpr Vector4& operator-=(const Vector4& other) { x -= other.x; y -= other.y; z -= other.z; w -= other.w; return *this; }
+		constexpr Vector4& operator*=(T scalar) { x *= scalar; y *= scalar; z *= scalar; w *= scalar; return *this; }
+
+		friend constexpr Vector4 operator+(const Vector4& a, const Vector4& b) { return Vector4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+		friend constexpr Vector4 operator-(const Vector4& a, const Vector4& b) { return Vector4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+		friend constexpr Vector4 operator-(const Vector4& vector) { return Vector4(-vector.x, -vector.y, -vector.z, -vector.w); }
+		friend constexpr Vector4 operator*(const Vector4& vector, T scalar) { return Vector4(vector.x * scalar, vector.y * scalar, vector.z * scalar, vector.w * scalar); }
+		friend constexpr Vector4 operator*(T scalar, const Vector4& vector) { return vector * scalar; }
+		friend constexpr bool operator==(const Vector4& a, const Vector4& b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+	};
+
+	using Vector4F = Vector4<float>;
+}
+
+// INFO: Specialization for Logging Vector4
+template<typename T, typename CharT>
+struct std::formatter<Flux::Vector4<T>, CharT> : std::formatter<std::string>
+{
+	template <typename FormatContext>
+	FormatContext::iterator format(const Flux::Vector4<T>& vector, FormatContext& ctx) const
+	{
+		return std::formatter<std::string>::format(vector.ToString(), ctx);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "FluxPCH.h"
+
+#include "LinearArena.h"
+
+namespace Flux
+{
+	LinearArena::LinearArena(size_t capacity, std::pmr::memory_resource* upstream) : upstream(upstream), blockCapacity(capacity)
+	{
+		FLUX_CORE_ASSERT(upstream != nullptr, "LinearArena requires an upstream memory resource!");
+
+		if (blockCapacity > 0) { AllocateBlock(blockCapacity); }
+	}
+
+	LinearArena::~LinearArena()
+	{
+		while (current != nullptr)
+		{
+			Block* previous = current->previous;
+			FreeBlock(current);
+			current = previous;
+		}
+	}
+
+	void* LinearArena::Allocate(size_t size, size_t alignment)
+	{
+		FLUX_CORE_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "LinearArena alignment must be a power of two!");
+
+		if (current != nullptr)
+		{
+			const uintptr_t base = reinterpret_cast<uintptr_t>(current->GetData());
+			const uintptr_t aligned = (base + offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+
+			if (aligned + size <= base + current->capacity)
+			{
+				offset = aligned + size - base;
+				peak = std::max(peak, usedBefore + offset);
+				return reinterpret_cast<void*>(aligned);
+			}
+		}
+
+		// INFO: The Rest of the Current Block is Wasted Until Reset, Blocks Double so this Happens Rarely
+		AllocateBlock(size + alignment);
+		return Allocate(size, alignment);
+	}
+
+	void LinearArena::Rewind(const Marker& marker)
+	{
+		while (current != marker.block)
+		{
+			FLUX_CORE_ASSERT(current != nullptr, "LinearArena marker is from a different arena or was already rewound past!");
+
+			Block* previous = current->previous;
+			FreeBlock(current);
+			current = previous;
+		}
+
+		offset = marker.offset;
+		usedBefore = marker.usedBefore;
+	}
+
+	void LinearArena::Reset()
+	{
+		// INFO: Ran Over into Extra Blocks, Swap them All for One Block that Fits Everything Next Time
+		if (current != nullptr && current->previous != nullptr)
+		{
+			const size_t totalCapacity = capacity;
+
+			while (current != nullptr)
+			{
+				Block* previous = current->previous;
+				FreeBlock(current);
+				current = previous;
+			}
+
+			blockCapacity = totalCapacity;
+			AllocateBlock(blockCapacity);
+		}
+
+		offset = 0;
+		usedBefore = 0;
+	}
+
+	void LinearArena::AllocateBlock(size_t minimumCapacity)
+	{
+		const size_t newCapacity = std::max({ minimumCapacity, blockCapacity, current != nullptr ? current->capacity * 2 : 0 });
+
+		Block* block = static_cast<Block*>(upstream->allocate(sizeof(Block) + newCapacity, alignof(Block)));
+		block->previous = current;
+		block->capacity = newCapacity;
+
+		if (current != nullptr) { usedBefore += current->capacity; }
+
+		current = block;
+		offset = 0;
+		capacity += newCapacity;
+	}
+
+	void LinearArena::FreeBlock(Block* block)
+	{
+		capacity -= block->capacity;
+		upstream->deallocate(block, sizeof(Block) + block->capacity, alignof(Block));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Flux
+{
+	/// <summary>
+	/// Bump allocator, allocations are a pointer increment and are only freed all at once by Reset (or Rewind).
+	/// Runs over into extra blocks when full, Reset then replaces them with a single block large enough for the peak.
+	/// Also a std::pmr::memory_resource, so std::pmr containers can allocate from it (Their deallocations are no-ops).
+	/// Not thread-safe, see Memory for the per-thread scratch arenas.
+	/// </summary>
+	class LinearArena : public std::pmr::memory_resource
+	{
+	public:
+		/// <summary>
+		/// Position to Rewind back to, everything allocated after it is freed
+		/// </summary>
+		struct Marker
+		{
+			void* block = nullptr;
+			size_t offset = 0;
+			size_t usedBefore = 0;
+		};
+
+		LinearArena(size_t capacity = 64 * 1024, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+		virtual ~LinearArena() override;
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		T* AllocateArray(size_t count) { return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))); }
+
+		/// <summary>
+		/// Constructs an object in the arena, its destructor is never run so only trivially destructible types are allowed
+		/// </summary>
+		template<typename T, typename... Args>
+		T* New(Args&&... args)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "LinearArena never runs destructors, use a std::pmr container or a Pool instead!");
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		Marker GetMarker() const { return { current, offset, usedBefore }; }
+		void Rewind(const Marker& marker);
+
+		void Reset();
+
+		size_t GetUsed() const { return usedBefore + offset; }
+		size_t GetPeak() const { return peak; }
+		size_t GetCapacity() const { return capacity; }
+
+	protected:
+		virtual void* do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+		virtual void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {}
+		virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+	private:
+		struct alignas(std::max_align_t) Block
+		{
+			Block* previous;
+			size_t capacity;
+
+			std::byte* GetData() { return reinterpret_cast<std::byte*>(this + 1); }
+		};
+
+		void AllocateBlock(size_t minimumCapacity);
+		void FreeBlock(Block* block);
+
+	private:
+		std::pmr::memory_resource* upstream;
+		size_t blockCapacity;
+
+		Block* current = nullptr;
+		size_t offset = 0;		// Bytes used in the current block
+		size_t usedBefore = 0;	// Bytes used in the blocks before it (Including what they left unused at their ends)
+
+		size_t capacity = 0;
+		size_t peak = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "FluxPCH.h"
+
+#include "Memory.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Flux
+{
+	namespace
+	{
+		struct MemoryData
+		{
+			std::mutex lifetimeMutex; // Guards Initialise/Shutdown
+			uint32_t referenceCount = 0;
+
+			std::atomic<size_t> scratchArenaCapacity = MemorySpecification().scratchArenaCapacity;
+		};
+
+		MemoryData& GetMemoryData()
+		{
+			static MemoryData data;
+			return data;
+		}
+	}
+
+	void Memory::Initialise(const MemorySpecification& specification)
+	{
+		MemoryData& data = GetMemoryData();
+		std::scoped_lock lock(data.lifetimeMutex);
+
+		if (data.referenceCount++ > 0) { return; }
+
+		data.scratchArenaCapacity.store(specification.scratchArenaCapacity, std::memory_order_relaxed);
+	}
+
+	void Memory::Shutdown()
+	{
+		MemoryData& data = GetMemoryData();
+		std::scoped_lock lock(data.lifetimeMutex);
+
+		FLUX_CORE_ASSERT(data.referenceCount > 0, "Memory was shut down more times than it was initialised!");
+		if (data.referenceCount > 0) { --data.referenceCount; }
+	}
+
+	bool Memory::IsInitialised()
+	{
+		MemoryData& data = GetMemoryData();
+		std::scoped_lock lock(data.lifetimeMutex);
+
+		return data.referenceCount > 0;
+	}
+
+	LinearArena& Memory::GetScratchArena()
+	{
+		thread_local LinearArena scratchArena(GetMemoryData().scratchArenaCapacity.load(std::memory_order_relaxed));
+		return scratchArena;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "LinearArena.h"
+
+namespace Flux
+{
+	struct MemorySpecification
+	{
+		size_t scratchArenaCapacity = 256 * 1024; // Per thread, created on the thread's first GetScratchArena
+	};
+
+	/// <summary>
+	/// Engine owned arenas for transient data so it stays off the global heap.
+	/// Scratch arenas are one per thread for data that dies within a function (Use a ScratchScope).
+	/// </summary>
+	class Memory
+	{
+	public:
+		Memory() = delete;
+		Memory(const Memory&) = delete;
+		Memory(Memory&&) = delete;
+		Memory& operator=(const Memory&) = delete;
+		~Memory() = delete;
+
+		/// <summary>
+		/// Reference counted, only the first call sets the scratch capacity (Threads keep the capacity their arena was created with)
+		/// </summary>
+		static void Initialise(const MemorySpecification& specification = MemorySpecification());
+		static void Shutdown();
+		static bool IsInitialised();
+
+		/// <summary>
+		/// The calling thread's arena, prefer a ScratchScope so allocations are rewound when it ends
+		/// </summary>
+		static LinearArena& GetScratchArena();
+	};
+
+	/// <summary>
+	/// Frees everything allocated from the thread's scratch arena during its lifetime.
+	/// Scopes nest, but memory from an inner scope must not escape it.
+	/// </summary>
+	class ScratchScope
+	{
+	public:
+		ScratchScope() : arena(Memory::GetScratchArena()), marker(arena.GetMarker()) {}
+		~ScratchScope() { arena.Rewind(marker); }
+
+		ScratchScope(const ScratchScope&) = delete;
+		ScratchScope& operator=(const ScratchScope&) = delete;
+
+		LinearArena& GetArena() { return arena; }
+		std::pmr::memory_resource* GetResource() { return &arena; }
+
+	private:
+		LinearArena& arena;
+		LinearArena::Marker marker;
+	};
+}
\ No newline at end of file
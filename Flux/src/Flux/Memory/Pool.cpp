@@ -0,0 +1,83 @@
+#include "FluxPCH.h"
+
+#include "Pool.h"
+
+namespace Flux
+{
+	PoolResource::PoolResource(size_t blockSize, size_t blockAlignment, size_t blocksPerChunk, std::pmr::memory_resource* upstream)
+		: upstream(upstream), blockAlignment(std::max(blockAlignment, alignof(FreeBlock))), blocksPerChunk(std::max<size_t>(blocksPerChunk, 1))
+	{
+		FLUX_CORE_ASSERT(upstream != nullptr, "PoolResource requires an upstream memory resource!");
+		FLUX_CORE_ASSERT((this->blockAlignment & (this->blockAlignment - 1)) == 0, "PoolResource alignment must be a power of two!");
+
+		// INFO: Blocks Hold a Free List Link while Free, and Every Block in a Chunk has to Stay Aligned
+		this->blockSize = (std::max(blockSize, sizeof(FreeBlock)) + this->blockAlignment - 1) & ~(this->blockAlignment - 1);
+		chunkHeaderSize = (sizeof(Chunk) + this->blockAlignment - 1) & ~(this->blockAlignment - 1);
+	}
+
+	PoolResource::~PoolResource()
+	{
+		FLUX_CORE_ASSERT(allocatedCount == 0, "PoolResource destroyed with blocks still allocated!");
+
+		const size_t chunkSize = chunkHeaderSize + blockSize * blocksPerChunk;
+		while (chunks != nullptr)
+		{
+			Chunk* next = chunks->next;
+			upstream->deallocate(chunks, chunkSize, blockAlignment);
+			chunks = next;
+		}
+	}
+
+	void* PoolResource::Allocate()
+	{
+		if (freeList == nullptr) { AllocateChunk(); }
+
+		FreeBlock* block = freeList;
+		freeList = block->next;
+		++allocatedCount;
+
+		return block;
+	}
+
+	void PoolResource::Deallocate(void* block)
+	{
+		FLUX_CORE_ASSERT(allocatedCount > 0, "PoolResource freed more blocks than it allocated!");
+
+		FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+		freeBlock->next = freeList;
+		freeList = freeBlock;
+		--allocatedCount;
+	}
+
+	void* PoolResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		if (bytes <= blockSize && alignment <= blockAlignment) { return Allocate(); }
+		return upstream->allocate(bytes, alignment);
+	}
+
+	void PoolResource::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+	{
+		if (bytes <= blockSize && alignment <= blockAlignment) { Deallocate(pointer); }
+		else { upstream->deallocate(pointer, bytes, alignment); }
+	}
+
+	void PoolResource::AllocateChunk()
+	{
+		std::byte* memory = static_cast<std::byte*>(upstream->allocate(chunkHeaderSize + blockSize * blocksPerChunk, blockAlignment));
+
+		Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+		chunk->next = chunks;
+		chunks = chunk;
+
+		// INFO: Link Back to Front so Blocks are Handed Out in Address Order
+		std::byte* blocks = memory + chunkHeaderSize;
+		for (size_t i = blocksPerChunk; i-- > 0;)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + i * blockSize);
+			block->next = freeList;
+			freeList = block;
+		}
+
+		capacity += blocksPerChunk;
+	}
+}
\ No newline at end of file
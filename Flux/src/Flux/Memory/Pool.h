@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace Flux
+{
+	/// <summary>
+	/// Fixed size block allocator, blocks are carved from chunks and recycled through an intrusive free list so allocating and
+	/// freeing are a couple of pointer swaps. As a std::pmr::memory_resource, requests that don't fit a block go upstream.
+	/// Not thread-safe.
+	/// </summary>
+	class PoolResource : public std::pmr::memory_resource
+	{
+	public:
+		PoolResource(size_t blockSize, size_t blockAlignment = alignof(std::max_align_t), size_t blocksPerChunk = 64,
+					 std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+		virtual ~PoolResource() override;
+
+		PoolResource(const PoolResource&) = delete;
+		PoolResource& operator=(const PoolResource&) = delete;
+
+		void* Allocate();
+		void Deallocate(void* block);
+
+		size_t GetBlockSize() const { return blockSize; }
+		size_t GetAllocatedCount() const { return allocatedCount; }
+		size_t GetCapacity() const { return capacity; }
+
+	protected:
+		virtual void* do_allocate(size_t bytes, size_t alignment) override;
+		virtual void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+		virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		struct Chunk
+		{
+			Chunk* next;
+		};
+
+		void AllocateChunk();
+
+	private:
+		std::pmr::memory_resource* upstream;
+
+		size_t blockSize;
+		size_t blockAlignment;
+		size_t blocksPerChunk;
+		size_t chunkHeaderSize; // Chunk header rounded up so the first block stays aligned
+
+		Chunk* chunks = nullptr;
+		FreeBlock* freeList = nullptr;
+
+		size_t allocatedCount = 0;
+		size_t capacity = 0;
+	};
+
+	/// <summary>
+	/// Typed object pool, for objects created and destroyed often (e.g. per-entity or per-request bookkeeping)
+	/// </summary>
+	template<typename T>
+	class Pool
+	{
+	public:
+		Pool(size_t objectsPerChunk = 64, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+			: resource(std::max(sizeof(T), sizeof(void*)), std::max(alignof(T), alignof(void*)), objectsPerChunk, upstream) {}
+
+		template<typename... Args>
+		T* New(Args&&... args) { return new (resource.Allocate()) T(std::forward<Args>(args)...); }
+
+		void Delete(T* object)
+		{
+			if (object == nullptr) { return; }
+
+			object->~T();
+			resource.Deallocate(object);
+		}
+
+		size_t GetCount() const { return resource.GetAllocatedCount(); }
+		size_t GetCapacity() const { return resource.GetCapacity(); }
+
+		PoolResource& GetResource() { return resource; }
+
+	private:
+		PoolResource resource;
+	};
+}
\ No newline at end of file
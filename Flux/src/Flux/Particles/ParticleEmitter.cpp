@@ -0,0 +1,183 @@
+#include "FluxPCH.h"
+
+#include "ParticleEmitter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <sfml/Graphics/Vertex.hpp>
+
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Math/BatchMath.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	namespace
+	{
+		constexpr uint32_t VerticesPerParticle = 6;
+
+		// INFO: Large Enough to Keep the Kernels Streaming, Small Enough for a Million Particles to Spread Over Every Worker
+		constexpr uint32_t ChunkSize = 16384;
+		constexpr uint32_t VertexGenerationBatchSize = 4096;
+
+		uint8_t LerpChannel(uint8_t from, uint8_t to, float t)
+		{
+			return static_cast<uint8_t>(static_cast<float>(from) + (static_cast<float>(to) - static_cast<float>(from)) * t + 0.5f);
+		}
+	}
+
+	ParticleEmitter::ParticleEmitter(const ParticleEmitterProperties& properties, uint32_t seed) : properties(properties), random(seed)
+	{
+		const uint32_t capacity = properties.maxParticles;
+
+		positionX.resize(capacity);
+		positionY.resize(capacity);
+		velocityX.resize(capacity);
+		velocityY.resize(capacity);
+		colors.resize(capacity);
+		life.resize(capacity);
+		inverseLifetime.resize(capacity);
+	}
+
+	void ParticleEmitter::Update(Timestep deltaTime)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		const float seconds = deltaTime.GetSeconds();
+
+		if (particleCount > 0)
+		{
+			const float damping = std::pow(properties.damping, seconds);
+			const uint32_t chunkCount = (particleCount + ChunkSize - 1) / ChunkSize;
+			expiredCounts.resize(chunkCount);
+
+			// INFO: Chunks Don't Overlap, so Each Batch Owns its Slice of Every Array
+			JobSystem::ParallelFor(chunkCount, [this, seconds, damping](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t chunk = begin; chunk < end; ++chunk)
+				{
+					const uint32_t first = chunk * ChunkSize;
+					const uint32_t count = std::min(ChunkSize, particleCount - first);
+
+					BatchMath::Integrate(positionX.data() + first, positionY.data() + first, velocityX.data() + first, velocityY.data() + first,
+										 properties.acceleration.x, properties.acceleration.y, damping, seconds, count);
+					expiredCounts[chunk] = static_cast<uint32_t>(BatchMath::Age(life.data() + first, seconds, count));
+				}
+			});
+
+			RemoveExpired(chunkCount);
+		}
+
+		if (isEmitting && properties.emissionRate > 0.0f)
+		{
+			emissionAccumulator += properties.emissionRate * seconds;
+
+			const uint32_t spawnCount = static_cast<uint32_t>(emissionAccumulator);
+			emissionAccumulator -= static_cast<float>(spawnCount);
+			Emit(spawnCount);
+		}
+	}
+
+	uint32_t ParticleEmitter::Emit(uint32_t count)
+	{
+		count = std::min(count, GetCapacity() - particleCount);
+
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		const auto between = [&](float min, float max) { return min + (max - min) * unit(random); };
+
+		for (uint32_t i = particleCount; i < particleCount + count; ++i)
+		{
+			positionX[i] = properties.position.x + between(-properties.positionVariance.x, properties.positionVariance.x);
+			positionY[i] = properties.position.y + between(-properties.positionVariance.y, properties.positionVariance.y);
+			velocityX[i] = between(properties.minVelocity.x, properties.maxVelocity.x);
+			velocityY[i] = between(properties.minVelocity.y, properties.maxVelocity.y);
+
+			const float brightness = 1.0f - properties.colorVariation * unit(random);
+			const sf::Color& color = properties.startColor;
+			colors[i] = sf::Color(LerpChannel(0, color.r, brightness), LerpChannel(0, color.g, brightness), LerpChannel(0, color.b, brightness), color.a);
+
+			const float lifetime = std::max(between(properties.minLifetime, properties.maxLifetime), 1.0e-4f);
+			life[i] = lifetime;
+			inverseLifetime[i] = 1.0f / lifetime;
+		}
+
+		particleCount += count;
+		return count;
+	}
+
+	void ParticleEmitter::WriteVertices(sf::Vertex* vertices) const
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		const float u0 = properties.textureRect.position.x;
+		const float v0 = properties.textureRect.position.y;
+		const float u1 = u0 + properties.textureRect.size.x;
+		const float v1 = v0 + properties.textureRect.size.y;
+
+		// INFO: Each Particle Owns a Fixed Slice of the Vertices, so Generation Splits Across the Job System Freely
+		JobSystem::ParallelFor(particleCount, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				const float age = std::clamp(1.0f - life[i] * inverseLifetime[i], 0.0f, 1.0f);
+				const float halfSize = (properties.startSize + (properties.endSize - properties.startSize) * age) * 0.5f;
+
+				// INFO: 8-Bit Fixed Point Fade, Float Conversions per Channel Cost More than the Quad's Stores
+				const int fade = static_cast<int>(age * 256.0f);
+				const sf::Color& from = colors[i];
+				const sf::Color& to = properties.endColor;
+				const auto channel = [fade](uint8_t start, uint8_t end) { return static_cast<uint8_t>(start + (((end - start) * fade) >> 8)); };
+				const sf::Color color(channel(from.r, to.r), channel(from.g, to.g), channel(from.b, to.b), channel(from.a, to.a));
+
+				const float left = positionX[i] - halfSize;
+				const float top = positionY[i] - halfSize;
+				const float right = positionX[i] + halfSize;
+				const float bottom = positionY[i] + halfSize;
+
+				sf::Vertex* quad = vertices + static_cast<size_t>(i) * VerticesPerParticle;
+				quad[0] = { { left, top }, color, { u0, v0 } };
+				quad[1] = { { right, top }, color, { u1, v0 } };
+				quad[2] = { { left, bottom }, color, { u0, v1 } };
+				quad[3] = { { left, bottom }, color, { u0, v1 } };
+				quad[4] = { { right, top }, color, { u1, v0 } };
+				quad[5] = { { right, bottom }, color, { u1, v1 } };
+			}
+		}, VertexGenerationBatchSize);
+	}
+
+	size_t ParticleEmitter::GetVertexCount() const
+	{
+		return static_cast<size_t>(particleCount) * VerticesPerParticle;
+	}
+
+	void ParticleEmitter::RemoveExpired(uint32_t chunkCount)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: Particles Only Move from the Tail into the Chunk being Compacted, so a Chunk Skipped for Having None Never Gains One
+		for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			if (expiredCounts[chunk] == 0) { continue; }
+
+			const uint32_t end = (chunk + 1) * ChunkSize;
+			for (uint32_t i = chunk * ChunkSize; i < std::min(end, particleCount);)
+			{
+				// INFO: The Particle Swapped in Might have Expired too, so the Slot is Checked Again
+				if (life[i] <= 0.0f) { MoveParticle(--particleCount, i); }
+				else { ++i; }
+			}
+		}
+	}
+
+	void ParticleEmitter::MoveParticle(uint32_t from, uint32_t to)
+	{
+		positionX[to] = positionX[from];
+		positionY[to] = positionY[from];
+		velocityX[to] = velocityX[from];
+		velocityY[to] = velocityY[from];
+		colors[to] = colors[from];
+		life[to] = life[from];
+		inverseLifetime[to] = inverseLifetime[from];
+	}
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <sfml/Graphics/Color.hpp>
+#include <sfml/Graphics/Rect.hpp>
+
+#include "Flux/Math/Vector2.h"
+#include "Flux/Time/Timestep.h"
+
+namespace sf { struct Vertex; }
+
+namespace Flux
+{
+	struct ParticleEmitterProperties
+	{
+		Vector2F position;
+		Vector2F positionVariance;					// Half size of the box around the position particles spawn in
+		Vector2F minVelocity;						// Pixels per second, each axis is picked between the min and max
+		Vector2F maxVelocity;
+		Vector2F acceleration;						// Pixels per second squared (e.g. Gravity)
+		float damping = 1.0f;						// Fraction of the velocity kept after a second
+
+		float minLifetime = 1.0f;					// Seconds
+		float maxLifetime = 1.0f;
+
+		float startSize = 4.0f;						// Pixels, quads grow or shrink linearly over their lifetime
+		float endSize = 4.0f;
+		sf::Color startColor = sf::Color::White;	// Faded to the end color over the lifetime
+		sf::Color endColor = sf::Color::Transparent;
+		float colorVariation = 0.0f;				// Particles spawn up to this fraction darker than the start color
+		sf::FloatRect textureRect;					// Pixels, the part of the system's texture every quad shows
+
+		float emissionRate = 0.0f;					// Particles per second while emitting, Emit adds bursts on top
+		uint32_t maxParticles = 10000;				// Fixed at construction, emission stops while the emitter is full
+	};
+
+	/// <summary>
+	/// Particles stored as separate arrays per attribute (Position, Velocity, Color, Lifetime). Updates integrate and age fixed size
+	/// chunks of them with the BatchMath kernels across the job system, then swap-remove the expired particles from the chunks that had any.
+	/// Particle order isn't kept, quads draw in whatever order the arrays are in.
+	/// </summary>
+	class ParticleEmitter
+	{
+	public:
+		ParticleEmitter(const ParticleEmitterProperties& properties, uint32_t seed = 1337);
+		~ParticleEmitter() = default;
+
+		ParticleEmitter(const ParticleEmitter&) = delete;
+		ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+		/// <summary>
+		/// Steps every live particle, removes the expired ones and spawns the emission rate's share of the timestep
+		/// </summary>
+		void Update(Timestep deltaTime);
+
+		/// <summary>
+		/// Spawns up to count particles straight away, returns how many there was room for
+		/// </summary>
+		uint32_t Emit(uint32_t count);
+
+		void Clear() { particleCount = 0; }
+
+		/// <summary>
+		/// Writes two triangles (6 vertices) per live particle, vertices needs room for GetVertexCount()
+		/// </summary>
+		void WriteVertices(sf::Vertex* vertices) const;
+
+		void SetEmitting(bool emitting) { isEmitting = emitting; }
+		bool IsEmitting() const { return isEmitting; }
+
+		/// <summary>
+		/// Takes effect from the next Update or Emit (maxParticles excluded)
+		/// </summary>
+		ParticleEmitterProperties& GetProperties() { return properties; }
+		const ParticleEmitterProperties& GetProperties() const { return properties; }
+
+		uint32_t GetParticleCount() const { return particleCount; }
+		uint32_t GetCapacity() const { return static_cast<uint32_t>(life.size()); }
+		size_t GetVertexCount() const;
+
+	private:
+		void RemoveExpired(uint32_t chunkCount);
+		void MoveParticle(uint32_t from, uint32_t to);
+
+	private:
+		ParticleEmitterProperties properties;
+		bool isEmitting = true;
+		float emissionAccumulator = 0.0f;
+		std::minstd_rand random;
+
+		uint32_t particleCount = 0;
+
+		std::vector<float> positionX;
+		std::vector<float> positionY;
+		std::vector<float> velocityX;
+		std::vector<float> velocityY;
+		std::vector<sf::Color> colors;				// Spawn colors, before fading
+		std::vector<float> life;					// Seconds remaining
+		std::vector<float> inverseLifetime;			// 1 / Seconds lived in total, turns the remaining life into an age
+
+		// INFO: Expired Particles per Chunk in the Last Update, Compaction Skips the Chunks with None
+		std::vector<uint32_t> expiredCounts;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "FluxPCH.h"
+
+#include "ParticleSystem.h"
+
+#include <algorithm>
+
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Renderer/Renderer2D.h"
+
+namespace Flux
+{
+	ParticleSystem::ParticleSystem()
+	{
+		for (sf::VertexArray& vertexArray : vertexArrays) { vertexArray.setPrimitiveType(sf::PrimitiveType::Triangles); }
+	}
+
+	ParticleEmitter& ParticleSystem::AddEmitter(const ParticleEmitterProperties& properties)
+	{
+		// INFO: Each Emitter Gets its Own Seed so Identical Emitters Don't Spawn Identical Particles
+		emitters.push_back(std::make_unique<ParticleEmitter>(properties, 1337 + static_cast<uint32_t>(emitters.size())));
+		return *emitters.back();
+	}
+
+	void ParticleSystem::RemoveEmitter(const ParticleEmitter& emitter)
+	{
+		std::erase_if(emitters, [&emitter](const std::unique_ptr<ParticleEmitter>& candidate) { return candidate.get() == &emitter; });
+	}
+
+	void ParticleSystem::Update(Timestep deltaTime)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: Each Emitter Spreads its Own Chunks Across the Job System
+		for (const std::unique_ptr<ParticleEmitter>& emitter : emitters) { emitter->Update(deltaTime); }
+	}
+
+	void ParticleSystem::Render(Renderer2D& renderer, uint8_t layer, float depth)
+	{
+		renderer.SubmitVertices(WriteVertices(), texture, layer, depth, blendMode);
+	}
+
+	const sf::VertexArray& ParticleSystem::WriteVertices()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		vertexArrayIndex ^= 1;
+		sf::VertexArray& vertexArray = vertexArrays[vertexArrayIndex];
+
+		size_t vertexCount = 0;
+		for (const std::unique_ptr<ParticleEmitter>& emitter : emitters) { vertexCount += emitter->GetVertexCount(); }
+
+		// INFO: Shrinking Keeps the Storage, so Only Growth Past the Largest Frame so Far Allocates
+		vertexArray.resize(vertexCount);
+
+		size_t firstVertex = 0;
+		for (const std::unique_ptr<ParticleEmitter>& emitter : emitters)
+		{
+			if (emitter->GetParticleCount() == 0) { continue; }
+
+			emitter->WriteVertices(&vertexArray[firstVertex]);
+			firstVertex += emitter->GetVertexCount();
+		}
+
+		return vertexArray;
+	}
+
+	uint32_t ParticleSystem::GetParticleCount() const
+	{
+		uint32_t particleCount = 0;
+		for (const std::unique_ptr<ParticleEmitter>& emitter : emitters) { particleCount += emitter->GetParticleCount(); }
+		return particleCount;
+	}
+}
\ No newline at end of file
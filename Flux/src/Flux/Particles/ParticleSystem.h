@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <sfml/Graphics/VertexArray.hpp>
+
+#include "Flux/Renderer/RenderBackend.h"
+#include "Flux/Time/Timestep.h"
+#include "ParticleEmitter.h"
+
+namespace Flux
+{
+	class Renderer2D;
+
+	/// <summary>
+	/// Emitters sharing a texture and blend mode, their quads are written straight into one shared sf::VertexArray and drawn as a single batch.
+	/// The array is double-buffered, so the one the renderer is still reading (e.g. on its render thread) isn't rewritten while in flight.
+	/// </summary>
+	class ParticleSystem
+	{
+	public:
+		ParticleSystem();
+		~ParticleSystem() = default;
+
+		ParticleSystem(const ParticleSystem&) = delete;
+		ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+		ParticleEmitter& AddEmitter(const ParticleEmitterProperties& properties);
+		void RemoveEmitter(const ParticleEmitter& emitter);
+
+		void Update(Timestep deltaTime);
+
+		/// <summary>
+		/// Writes every emitter's quads into the next vertex array and submits it to the renderer
+		/// </summary>
+		void Render(Renderer2D& renderer, uint8_t layer = 0, float depth = 0.0f);
+
+		/// <summary>
+		/// Writes every emitter's quads into the next vertex array (Alternating each call) and returns it, for drawing without a Renderer2D
+		/// </summary>
+		const sf::VertexArray& WriteVertices();
+
+		void SetTexture(const sf::Texture* texture) { this->texture = texture; }
+		const sf::Texture* GetTexture() const { return texture; }
+
+		void SetBlendMode(BlendMode blendMode) { this->blendMode = blendMode; }
+		BlendMode GetBlendMode() const { return blendMode; }
+
+		const std::vector<std::unique_ptr<ParticleEmitter>>& GetEmitters() const { return emitters; }
+		uint32_t GetParticleCount() const;
+
+	private:
+		std::vector<std::unique_ptr<ParticleEmitter>> emitters;
+
+		const sf::Texture* texture = nullptr;
+		BlendMode blendMode = BlendMode::Additive;
+
+		std::array<sf::VertexArray, 2> vertexArrays;
+		uint32_t vertexArrayIndex = 0;
+	};
+}
\ No newline at end of file
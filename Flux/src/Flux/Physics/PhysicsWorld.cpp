@@ -0,0 +1,370 @@
+#include "FluxPCH.h"
+
+#include "PhysicsWorld.h"
+
+#include <bit>
+#include <numbers>
+#include <thread>
+
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Scene/Components.h"
+#include "Flux/Scene/Scene.h"
+
+namespace Flux
+{
+	namespace
+	{
+		constexpr float DegreesToRadians = std::numbers::pi_v<float> / 180.0f;
+		constexpr float RadiansToDegrees = 180.0f / std::numbers::pi_v<float>;
+
+		b2BodyType ToBox2D(RigidbodyType type)
+		{
+			switch (type)
+			{
+			case RigidbodyType::Static: return b2_staticBody;
+			case RigidbodyType::Kinematic: return b2_kinematicBody;
+			case RigidbodyType::Dynamic: return b2_dynamicBody;
+			}
+
+			FLUX_CORE_ASSERT(false, "Unknown rigidbody type!");
+			return b2_staticBody;
+		}
+
+		void* ToUserData(entt::entity entity) { return reinterpret_cast<void*>(static_cast<uintptr_t>(entt::to_integral(entity))); }
+		entt::entity FromUserData(void* userData) { return static_cast<entt::entity>(reinterpret_cast<uintptr_t>(userData)); }
+	}
+
+	PhysicsWorld::PhysicsWorld(Scene& scene, const PhysicsSpecification& specification) : scene(scene), specification(specification),
+		workerCount(1), freeWorkerSlots(0), tasks(std::make_unique<std::array<PhysicsTask, MaxTasksPerStep>>()), taskCount(0), heldTaskBegin(0), heldTaskCount(0)
+	{
+		b2WorldDef worldDef = b2DefaultWorldDef();
+		worldDef.gravity = { specification.gravity.x, specification.gravity.y };
+		worldDef.enableSleep = specification.enableSleep;
+
+		// INFO: Without Worker Threads there is Nobody to Share the Solver with, box2d's Serial Path is Cheaper.
+		// Steps Run Inside a Job Use One Solver Worker Regardless, see SubmitHeldTasks
+		if (JobSystem::GetWorkerThreadCount() > 0)
+		{
+			workerCount = std::min(JobSystem::GetThreadCount(), MaxWorkerCount);
+
+			worldDef.workerCount = static_cast<int>(workerCount);
+			worldDef.enqueueTask = &PhysicsWorld::EnqueueTask;
+			worldDef.finishTask = &PhysicsWorld::FinishTask;
+			worldDef.userTaskContext = this;
+		}
+
+		freeWorkerSlots.store(workerCount == 64 ? ~0ull : (1ull << workerCount) - 1, std::memory_order_relaxed);
+		worldId = b2CreateWorld(&worldDef);
+
+		entt::registry& registry = scene.GetRegistry();
+		registry.on_construct<RigidbodyComponent>().connect<&PhysicsWorld::OnRigidbodyConstruct>(*this);
+		registry.on_destroy<RigidbodyComponent>().connect<&PhysicsWorld::OnRigidbodyDestroy>(*this);
+		registry.on_construct<ColliderComponent>().connect<&PhysicsWorld::OnColliderConstruct>(*this);
+		registry.on_destroy<ColliderComponent>().connect<&PhysicsWorld::OnColliderDestroy>(*this);
+
+		// INFO: Entities Given Rigidbodies before Physics was Enabled
+		for (entt::entity entity : registry.view<RigidbodyComponent>()) { CreateBody(entity); }
+	}
+
+	PhysicsWorld::~PhysicsWorld()
+	{
+		entt::registry& registry = scene.GetRegistry();
+		registry.on_construct<RigidbodyComponent>().disconnect(this);
+		registry.on_destroy<RigidbodyComponent>().disconnect(this);
+		registry.on_construct<ColliderComponent>().disconnect(this);
+		registry.on_destroy<ColliderComponent>().disconnect(this);
+
+		for (auto [entity, rigidbody] : registry.view<RigidbodyComponent>().each()) { rigidbody.body = b2_nullBodyId; }
+		for (auto [entity, collider] : registry.view<ColliderComponent>().each()) { collider.shapeId = b2_nullShapeId; }
+
+		b2DestroyWorld(worldId);
+	}
+
+	void PhysicsWorld::Step(Timestep fixedTimestep)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		SyncToPhysics(fixedTimestep.GetSeconds());
+
+		taskCount = 0;
+		heldTaskCount = 0;
+		b2World_Step(worldId, fixedTimestep.GetSeconds(), specification.subStepCount);
+
+		SyncFromPhysics();
+	}
+
+	void PhysicsWorld::Teleport(entt::entity entity, const Vector2F& position, float rotation)
+	{
+		std::scoped_lock lock(teleportMutex);
+		pendingTeleports.push_back({ entity, position, rotation });
+	}
+
+	void PhysicsWorld::SetGravity(const Vector2F& gravity)
+	{
+		specification.gravity = gravity;
+		b2World_SetGravity(worldId, { gravity.x, gravity.y });
+	}
+
+	void* PhysicsWorld::EnqueueTask(b2TaskCallback* callback, int itemCount, int minRange, void* taskContext, void* userContext)
+	{
+		PhysicsWorld& world = *static_cast<PhysicsWorld*>(userContext);
+
+		// INFO: Out of Task Slots, Run it Here (box2d Skips FinishTask when Given Nullptr)
+		if (world.taskCount == MaxTasksPerStep)
+		{
+			world.SubmitHeldTasks();
+
+			const uint32_t slot = world.AcquireWorkerSlot();
+			callback(0, itemCount, slot, taskContext);
+			world.ReleaseWorkerSlot(slot);
+			return nullptr;
+		}
+
+		PhysicsTask& task = (*world.tasks)[world.taskCount++];
+		task.callback = callback;
+		task.context = taskContext;
+
+		// INFO: The Solver Enqueues One Single Item Task per Worker Back to Back (Worker 0 First), Hold them until box2d Moves On to Tell the Group Apart
+		if (itemCount == 1)
+		{
+			if (world.heldTaskCount == 0 || (*world.tasks)[world.heldTaskBegin].callback != callback)
+			{
+				world.SubmitHeldTasks();
+				world.heldTaskBegin = world.taskCount - 1;
+			}
+
+			++world.heldTaskCount;
+			return &task;
+		}
+
+		world.SubmitHeldTasks();
+
+		const uint32_t count = static_cast<uint32_t>(itemCount);
+		const uint32_t batchSize = JobSystem::GetBatchSize(count, static_cast<uint32_t>(minRange));
+
+		for (uint32_t begin = 0; begin < count; begin += batchSize) { world.QueueTask(task, begin, std::min(begin + batchSize, count)); }
+
+		return &task;
+	}
+
+	void PhysicsWorld::FinishTask(void* userTask, void* userContext)
+	{
+		static_cast<PhysicsWorld*>(userContext)->SubmitHeldTasks();
+		JobSystem::Wait(static_cast<PhysicsTask*>(userTask)->counter);
+	}
+
+	void PhysicsWorld::SubmitHeldTasks()
+	{
+		if (heldTaskCount == 0) { return; }
+
+		PhysicsTask* group = tasks->data() + heldTaskBegin;
+		const uint32_t groupSize = heldTaskCount;
+		heldTaskCount = 0;
+
+		if (groupSize == 1)
+		{
+			QueueTask(group[0], 0, 1);
+			return;
+		}
+
+		// INFO: Solver Workers Above 0 Spin until Worker 0 Starts Each Stage, so Worker 0 Runs Here rather than Queued Behind them where a Wait could Pick
+		// One Up First. Inside a Job (e.g. a Hosted Instance) the Other Threads are Busy with their Own Work, so Worker 0 Solves Alone and the Rest,
+		// Started Afterwards, Return Straight Away
+		const bool isInsideJob = JobSystem::IsWorkerThread();
+
+		if (!isInsideJob)
+		{
+			for (uint32_t i = 1; i < groupSize; ++i) { QueueTask(group[i], 0, 1); }
+		}
+
+		RunTask(group[0], 0, 1);
+
+		if (isInsideJob)
+		{
+			for (uint32_t i = 1; i < groupSize; ++i) { RunTask(group[i], 0, 1); }
+		}
+	}
+
+	void PhysicsWorld::QueueTask(PhysicsTask& task, uint32_t begin, uint32_t end)
+	{
+		JobSystem::Run([this, &task, begin, end]() { RunTask(task, begin, end); }, &task.counter);
+	}
+
+	void PhysicsWorld::RunTask(PhysicsTask& task, uint32_t begin, uint32_t end)
+	{
+		const uint32_t slot = AcquireWorkerSlot();
+		task.callback(static_cast<int>(begin), static_cast<int>(end), slot, task.context);
+		ReleaseWorkerSlot(slot);
+	}
+
+	uint32_t PhysicsWorld::AcquireWorkerSlot()
+	{
+		uint64_t slots = freeWorkerSlots.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			// INFO: Only Happens if Threads Outside the Pool Help Out, a Slot Frees Up as Soon as a Task Finishes
+			if (slots == 0)
+			{
+				std::this_thread::yield();
+				slots = freeWorkerSlots.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			const uint32_t slot = static_cast<uint32_t>(std::countr_zero(slots));
+			if (freeWorkerSlots.compare_exchange_weak(slots, slots & ~(1ull << slot), std::memory_order_acquire, std::memory_order_relaxed)) { return slot; }
+		}
+	}
+
+	void PhysicsWorld::ReleaseWorkerSlot(uint32_t slot)
+	{
+		freeWorkerSlots.fetch_or(1ull << slot, std::memory_order_release);
+	}
+
+	void PhysicsWorld::SyncToPhysics(float timeStep)
+	{
+		entt::registry& registry = scene.GetRegistry();
+
+		{
+			std::scoped_lock lock(teleportMutex);
+
+			for (const PendingTeleport& teleport : pendingTeleports)
+			{
+				if (!registry.valid(teleport.entity) || !registry.all_of<RigidbodyComponent, TransformComponent>(teleport.entity)) { continue; }
+
+				const RigidbodyComponent& rigidbody = registry.get<RigidbodyComponent>(teleport.entity);
+				b2Body_SetTransform(rigidbody.body, ToPhysics(teleport.position), b2MakeRot(teleport.rotation * DegreesToRadians));
+
+				scene.SetTransform(teleport.entity, TransformComponent(teleport.position, teleport.rotation));
+			}
+
+			pendingTeleports.clear();
+		}
+
+		// INFO: Kinematic Bodies Follow their Transforms by Velocity, so Dynamic Bodies they Push React Correctly
+		for (auto [entity, transform, rigidbody] : registry.view<const TransformComponent, const RigidbodyComponent>().each())
+		{
+			if (rigidbody.type != RigidbodyType::Kinematic) { continue; }
+
+			const b2Transform target = { ToPhysics(transform.position), b2MakeRot(transform.rotation * DegreesToRadians) };
+			b2Body_SetTargetTransform(rigidbody.body, target, timeStep);
+		}
+	}
+
+	void PhysicsWorld::SyncFromPhysics()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: box2d Lists Every Body that Moved this Step in One Contiguous Array, Sleeping Bodies Cost Nothing
+		const b2BodyEvents events = b2World_GetBodyEvents(worldId);
+
+		// INFO: Storages Fetched Up Front, Looking them Up Inside the Jobs could Create them Concurrently
+		entt::registry& registry = scene.GetRegistry();
+		const auto& bounds = registry.storage<BoundsComponent>();
+
+		JobSystem::ParallelFor(static_cast<uint32_t>(events.moveCount), [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				const b2BodyMoveEvent& event = events.moveEvents[i];
+				const entt::entity entity = FromUserData(event.userData);
+
+				scene.SetTransform(entity, TransformComponent(FromPhysics(event.transform.p), b2Rot_GetAngle(event.transform.q) * RadiansToDegrees));
+
+				if (bounds.contains(entity))
+				{
+					const b2AABB aabb = b2Body_ComputeAABB(event.bodyId);
+					scene.SetBounds(entity, AABB(FromPhysics(aabb.lowerBound), FromPhysics(aabb.upperBound)));
+				}
+			}
+		}, 256);
+	}
+
+	void PhysicsWorld::CreateBody(entt::entity entity)
+	{
+		entt::registry& registry = scene.GetRegistry();
+		RigidbodyComponent& rigidbody = registry.get<RigidbodyComponent>(entity);
+
+		FLUX_CORE_ASSERT(registry.all_of<TransformComponent>(entity), "Rigidbody requires a TransformComponent!");
+
+		b2BodyDef bodyDef = b2DefaultBodyDef();
+		bodyDef.type = ToBox2D(rigidbody.type);
+		bodyDef.linearDamping = rigidbody.linearDamping;
+		bodyDef.angularDamping = rigidbody.angularDamping;
+		bodyDef.gravityScale = rigidbody.gravityScale;
+		bodyDef.fixedRotation = rigidbody.fixedRotation;
+		bodyDef.isBullet = rigidbody.isBullet;
+		bodyDef.userData = ToUserData(entity);
+
+		if (const TransformComponent* transform = registry.try_get<TransformComponent>(entity))
+		{
+			bodyDef.position = ToPhysics(transform->position);
+			bodyDef.rotation = b2MakeRot(transform->rotation * DegreesToRadians);
+		}
+
+		rigidbody.body = b2CreateBody(worldId, &bodyDef);
+
+		if (registry.all_of<ColliderComponent>(entity)) { CreateShape(entity, rigidbody.body); }
+	}
+
+	void PhysicsWorld::CreateShape(entt::entity entity, b2BodyId body)
+	{
+		ColliderComponent& collider = scene.GetRegistry().get<ColliderComponent>(entity);
+
+		b2ShapeDef shapeDef = b2DefaultShapeDef();
+		shapeDef.density = collider.density;
+		shapeDef.material.friction = collider.friction;
+		shapeDef.material.restitution = collider.restitution;
+		shapeDef.isSensor = collider.isSensor;
+		shapeDef.enableSensorEvents = collider.isSensor;
+
+		const float halfWidth = collider.size.x * 0.5f / specification.pixelsPerMeter;
+		const float halfHeight = collider.size.y * 0.5f / specification.pixelsPerMeter;
+
+		switch (collider.shape)
+		{
+		case ColliderShape::Box:
+		{
+			const b2Polygon box = b2MakeOffsetBox(halfWidth, halfHeight, ToPhysics(collider.offset), b2Rot_identity);
+			collider.shapeId = b2CreatePolygonShape(body, &shapeDef, &box);
+			break;
+		}
+		case ColliderShape::Circle:
+		{
+			const b2Circle circle = { ToPhysics(collider.offset), halfWidth };
+			collider.shapeId = b2CreateCircleShape(body, &shapeDef, &circle);
+			break;
+		}
+		}
+	}
+
+	void PhysicsWorld::OnRigidbodyConstruct(entt::registry& registry, entt::entity entity)
+	{
+		CreateBody(entity);
+	}
+
+	void PhysicsWorld::OnRigidbodyDestroy(entt::registry& registry, entt::entity entity)
+	{
+		RigidbodyComponent& rigidbody = registry.get<RigidbodyComponent>(entity);
+		if (b2Body_IsValid(rigidbody.body)) { b2DestroyBody(rigidbody.body); }
+		rigidbody.body = b2_nullBodyId;
+
+		// INFO: Destroying the Body Took its Shapes with it
+		if (ColliderComponent* collider = registry.try_get<ColliderComponent>(entity)) { collider->shapeId = b2_nullShapeId; }
+	}
+
+	void PhysicsWorld::OnColliderConstruct(entt::registry& registry, entt::entity entity)
+	{
+		if (const RigidbodyComponent* rigidbody = registry.try_get<RigidbodyComponent>(entity))
+		{
+			CreateShape(entity, rigidbody->body);
+		}
+	}
+
+	void PhysicsWorld::OnColliderDestroy(entt::registry& registry, entt::entity entity)
+	{
+		ColliderComponent& collider = registry.get<ColliderComponent>(entity);
+		if (b2Shape_IsValid(collider.shapeId)) { b2DestroyShape(collider.shapeId, true); }
+		collider.shapeId = b2_nullShapeId;
+	}
+}
\ No newline at end of file
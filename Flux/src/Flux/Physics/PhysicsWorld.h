@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <box2d/box2d.h>
+#include <entt/entt.hpp>
+
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Math/Vector2.h"
+#include "Flux/Time/Timestep.h"
+
+namespace Flux
+{
+	class Scene;
+
+	struct PhysicsSpecification
+	{
+		Vector2F gravity = Vector2F(0.0f, 9.81f);	// Metres per second squared, +Y is down as on screen
+		float pixelsPerMeter = 32.0f;				// Engine transforms are in pixels, box2d is tuned for metres
+		int subStepCount = 4;
+		bool enableSleep = true;
+	};
+
+	/// <summary>
+	/// Owns the box2d world of a scene and steps it at the fixed rate. Bodies are created for entities with a
+	/// RigidbodyComponent (and TransformComponent), box2d's solver runs its tasks on the shared JobSystem.
+	/// </summary>
+	class PhysicsWorld
+	{
+	public:
+		PhysicsWorld(Scene& scene, const PhysicsSpecification& specification = PhysicsSpecification());
+		~PhysicsWorld();
+
+		PhysicsWorld(const PhysicsWorld&) = delete;
+		PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+		/// <summary>
+		/// Pushes kinematic and teleported transforms into box2d, steps it and writes the transforms (and bounds) of the
+		/// bodies that moved back to their entities
+		/// </summary>
+		void Step(Timestep fixedTimestep);
+
+		/// <summary>
+		/// Moves a body without simulating the path in between, safe to call from systems running in parallel
+		/// (Applied at the start of the next step)
+		/// </summary>
+		void Teleport(entt::entity entity, const Vector2F& position, float rotation);
+
+		void SetGravity(const Vector2F& gravity);
+
+		b2Vec2 ToPhysics(const Vector2F& position) const { return { position.x / specification.pixelsPerMeter, position.y / specification.pixelsPerMeter }; }
+		Vector2F FromPhysics(b2Vec2 position) const { return Vector2F(position.x * specification.pixelsPerMeter, position.y * specification.pixelsPerMeter); }
+
+		b2WorldId GetWorldId() const { return worldId; }
+		const PhysicsSpecification& GetSpecification() const { return specification; }
+
+		int GetAwakeBodyCount() const { return b2World_GetAwakeBodyCount(worldId); }
+		uint32_t GetWorkerCount() const { return workerCount; }
+
+	private:
+		struct PhysicsTask
+		{
+			b2TaskCallback* callback = nullptr;
+			void* context = nullptr;
+			JobCounter counter;
+		};
+
+		struct PendingTeleport
+		{
+			entt::entity entity;
+			Vector2F position;
+			float rotation;
+		};
+
+		static void* EnqueueTask(b2TaskCallback* callback, int itemCount, int minRange, void* taskContext, void* userContext);
+		static void FinishTask(void* userTask, void* userContext);
+
+		/// <summary>
+		/// Queues the single item tasks held back since the last call, see EnqueueTask
+		/// </summary>
+		void SubmitHeldTasks();
+		void QueueTask(PhysicsTask& task, uint32_t begin, uint32_t end);
+		void RunTask(PhysicsTask& task, uint32_t begin, uint32_t end);
+
+		/// <summary>
+		/// box2d keeps scratch data per worker index, a slot is held for the duration of a task so no two tasks share one
+		/// </summary>
+		uint32_t AcquireWorkerSlot();
+		void ReleaseWorkerSlot(uint32_t slot);
+
+		void SyncToPhysics(float timeStep);
+		void SyncFromPhysics();
+
+		void CreateBody(entt::entity entity);
+		void CreateShape(entt::entity entity, b2BodyId body);
+
+		void OnRigidbodyConstruct(entt::registry& registry, entt::entity entity);
+		void OnRigidbodyDestroy(entt::registry& registry, entt::entity entity);
+		void OnColliderConstruct(entt::registry& registry, entt::entity entity);
+		void OnColliderDestroy(entt::registry& registry, entt::entity entity);
+
+	private:
+		static constexpr uint32_t MaxTasksPerStep = 128;
+		static constexpr uint32_t MaxWorkerCount = 64;
+
+		Scene& scene;
+		PhysicsSpecification specification;
+
+		b2WorldId worldId;
+
+		uint32_t workerCount;
+		std::atomic<uint64_t> freeWorkerSlots;
+
+		std::unique_ptr<std::array<PhysicsTask, MaxTasksPerStep>> tasks;
+		uint32_t taskCount;
+		uint32_t heldTaskBegin;
+		uint32_t heldTaskCount; // Consecutive single item tasks with the same callback, not queued yet
+
+		std::mutex teleportMutex;
+		std::vector<PendingTeleport> pendingTeleports;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+#include "FluxPCH.h"
+
+#include "Profiler.h"
+
+#include <atomic>
+#include <format>
+#include <mutex>
+
+namespace Flux
+{
+	namespace
+	{
+		struct StringHash
+		{
+			using is_transparent = void;
+
+			size_t operator()(std::string_view string) const { return std::hash<std::string_view>()(string); }
+		};
+
+		/// <summary>
+		/// Single producer (owning thread), single consumer (EndFrame) ring of finished scopes
+		/// </summary>
+		struct ThreadBuffer
+		{
+			static constexpr uint64_t Capacity = 1 << 16;
+			static constexpr uint64_t Mask = Capacity - 1;
+
+			std::unique_ptr<ProfileRecord[]> records = std::make_unique<ProfileRecord[]>(Capacity);
+			std::atomic<uint64_t> writeIndex = 0;
+			std::atomic<uint64_t> readIndex = 0;
+			std::atomic<uint64_t> droppedCount = 0;
+
+			uint32_t threadID = 0;
+			uint32_t depth = 0;
+
+			// INFO: Owning Thread Only, Never Cleared as Records Still in the Ring can Point into it
+			std::unordered_set<std::string, StringHash, std::equal_to<>> scopeNames;
+		};
+
+		struct ProfilerData
+		{
+			std::atomic<bool> sessionActive = false;
+
+			std::mutex mutex; // Guards everything below (Never taken on the scope recording path)
+			std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+
+			std::string sessionName;
+			std::ofstream traceFile;
+			bool firstTraceEvent = true;
+			uint64_t sessionStart = 0;
+
+			uint64_t frameIndex = 0;
+			uint64_t frameStart = 0;
+			std::deque<ProfileFrame> frameHistory;
+			size_t frameHistorySize = 120;
+
+			std::unordered_set<std::string> internedNames;
+			std::unordered_map<const char*, const char*> internedRecordNames; // Recorded names never change behind a pointer, so the lookup skips hashing the text
+			std::vector<ProfileRecord> collectBuffer;
+		};
+
+		ProfilerData& GetProfilerData()
+		{
+			static ProfilerData data;
+			return data;
+		}
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			// INFO: Buffers are Owned by the Profiler so Records Outlive Short-Lived Threads until Collected
+			static thread_local ThreadBuffer* threadBuffer = []()
+			{
+				ProfilerData& data = GetProfilerData();
+				std::scoped_lock lock(data.mutex);
+
+				auto& buffer = data.threadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+				buffer->threadID = static_cast<uint32_t>(data.threadBuffers.size() - 1);
+				return buffer.get();
+			}();
+
+			return *threadBuffer;
+		}
+
+		const char* InternName(ProfilerData& data, std::string_view name)
+		{
+			return data.internedNames.emplace(name).first->c_str();
+		}
+
+		const char* InternRecordName(ProfilerData& data, const char* name)
+		{
+			auto [iterator, isNew] = data.internedRecordNames.try_emplace(name, nullptr);
+			if (isNew) { iterator->second = InternName(data, name); }
+
+			return iterator->second;
+		}
+
+		void WriteTraceEvent(ProfilerData& data, const ProfileRecord& record)
+		{
+			if (!data.traceFile.is_open()) { return; }
+
+			std::string escapedName;
+			escapedName.reserve(std::char_traits<char>::length(record.name));
+			for (const char* c = record.name; *c != '\0'; ++c)
+			{
+				if (*c == '"' || *c == '\\') { escapedName += '\\'; }
+				escapedName += *c;
+			}
+
+			// INFO: Complete Event ("X"), Timestamps in Microseconds as Chrome Trace Expects
+			data.traceFile << (data.firstTraceEvent ? "" : ",\n")
+				<< std::format("{{\"cat\":\"function\",\"name\":\"{0}\",\"ph\":\"X\",\"pid\":0,\"tid\":{1},\"ts\":{2:.3f},\"dur\":{3:.3f}}}",
+							   escapedName, record.threadID, record.start / 1000.0, record.duration / 1000.0);
+
+			data.firstTraceEvent = false;
+		}
+
+		void CollectThreadBuffers(ProfilerData& data)
+		{
+			data.collectBuffer.clear();
+
+			for (auto& buffer : data.threadBuffers)
+			{
+				uint64_t readIndex = buffer->readIndex.load(std::memory_order_relaxed);
+				const uint64_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+
+				for (; readIndex != writeIndex; ++readIndex)
+				{
+					ProfileRecord record = buffer->records[readIndex & ThreadBuffer::Mask];
+					record.name = InternRecordName(data, record.name);
+					record.start = record.start > data.sessionStart ? record.start - data.sessionStart : 0;
+					data.collectBuffer.push_back(record);
+				}
+
+				buffer->readIndex.store(readIndex, std::memory_order_release);
+
+				if (uint64_t dropped = buffer->droppedCount.exchange(0, std::memory_order_relaxed); dropped > 0)
+				{
+					FLUX_CORE_WARN("Profiler dropped {0} scopes on thread {1}, buffer is full!", dropped, buffer->threadID);
+				}
+			}
+		}
+	}
+
+	void Profiler::BeginSession(const std::string& name, const std::filesystem::path& filepath)
+	{
+		ProfilerData& data = GetProfilerData();
+		std::scoped_lock lock(data.mutex);
+
+		if (data.sessionActive.load(std::memory_order_relaxed))
+		{
+			FLUX_CORE_WARN("Profiler session '{0}' is already active, ignoring BeginSession for '{1}'!", data.sessionName, name);
+			return;
+		}
+
+		data.traceFile.open(filepath);
+		FLUX_CORE_VERIFY(data.traceFile.is_open(), std::format("Failed to open profiler trace file: {0}", filepath.string()));
+
+		data.traceFile << "{\"otherData\":{},\"traceEvents\":[\n";
+		data.firstTraceEvent = true;
+
+		// INFO: Discard Anything Recorded Before the Session Began
+		for (auto& buffer : data.threadBuffers)
+		{
+			buffer->readIndex.store(buffer->writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+		}
+
+		data.sessionName = name;
+		data.sessionStart = Now();
+		data.frameIndex = 0;
+		data.frameStart = data.sessionStart;
+		data.frameHistory.clear();
+
+		data.sessionActive.store(true, std::memory_order_release);
+	}
+
+	void Profiler::EndSession()
+	{
+		if (!IsSessionActive()) { return; }
+
+		// INFO: Flush Scopes Recorded since the Last Frame
+		EndFrame();
+
+		ProfilerData& data = GetProfilerData();
+		std::scoped_lock lock(data.mutex);
+
+		data.sessionActive.store(false, std::memory_order_release);
+
+		if (data.traceFile.is_open())
+		{
+			data.traceFile << "\n]}\n";
+			data.traceFile.close();
+		}
+
+		// INFO: History Records Point into the Interned Names, so they are Released Together
+		data.frameHistory.clear();
+		data.internedNames.clear();
+		data.internedRecordNames.clear();
+		data.sessionName.clear();
+	}
+
+	bool Profiler::IsSessionActive()
+	{
+		return GetProfilerData().sessionActive.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::EndFrame()
+	{
+		ProfilerData& data = GetProfilerData();
+		if (!data.sessionActive.load(std::memory_order_acquire)) { return; }
+
+		std::scoped_lock lock(data.mutex);
+
+		const uint64_t frameEnd = Now();
+		CollectThreadBuffers(data);
+
+		ProfileFrame frame;
+		frame.frameIndex = data.frameIndex++;
+		frame.start = data.frameStart - data.sessionStart;
+		frame.duration = frameEnd - data.frameStart;
+		frame.records = data.collectBuffer;
+
+		// INFO: Frame Marker on the Main Thread Track, Makes Frame Boundaries Visible in the Trace Viewer
+		WriteTraceEvent(data, { InternName(data, std::format("Frame {0}", frame.frameIndex)), frame.start, frame.duration, 0, 0 });
+		for (const ProfileRecord& record : frame.records)
+		{
+			WriteTraceEvent(data, record);
+		}
+
+		data.frameHistory.emplace_back(std::move(frame));
+		while (data.frameHistory.size() > data.frameHistorySize)
+		{
+			data.frameHistory.pop_front();
+		}
+
+		data.frameStart = frameEnd;
+	}
+
+	const std::deque<ProfileFrame>& Profiler::GetFrameHistory()
+	{
+		return GetProfilerData().frameHistory;
+	}
+
+	void Profiler::SetFrameHistorySize(size_t frameCount)
+	{
+		ProfilerData& data = GetProfilerData();
+		std::scoped_lock lock(data.mutex);
+
+		data.frameHistorySize = frameCount;
+		while (data.frameHistory.size() > data.frameHistorySize)
+		{
+			data.frameHistory.pop_front();
+		}
+	}
+
+	const char* Profiler::InternScopeName(std::string_view name)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+
+		auto iterator = buffer.scopeNames.find(name);
+		if (iterator == buffer.scopeNames.end()) { iterator = buffer.scopeNames.emplace(name).first; }
+
+		return iterator->c_str();
+	}
+
+	uint32_t Profiler::BeginScope()
+	{
+		return GetThreadBuffer().depth++;
+	}
+
+	void Profiler::EndScope(const char* name, uint64_t start, uint64_t end, uint32_t depth)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+		buffer.depth = depth;
+
+		const uint64_t writeIndex = buffer.writeIndex.load(std::memory_order_relaxed);
+		if (writeIndex - buffer.readIndex.load(std::memory_order_acquire) >= ThreadBuffer::Capacity)
+		{
+			buffer.droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		buffer.records[writeIndex & ThreadBuffer::Mask] = { name, start, end - start, buffer.threadID, depth };
+		buffer.writeIndex.store(writeIndex + 1, std::memory_order_release);
+	}
+}
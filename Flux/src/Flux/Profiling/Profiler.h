@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Flux
+{
+	struct ProfileRecord
+	{
+		const char* name;	// Interned, valid until the profiler session ends
+		uint64_t start;		// Nanoseconds since the session began
+		uint64_t duration;	// Nanoseconds
+		uint32_t threadID;
+		uint32_t depth;		// Nesting level on the recording thread (0 = outermost scope)
+	};
+
+	struct ProfileFrame
+	{
+		uint64_t frameIndex;
+		uint64_t start;
+		uint64_t duration;
+		std::vector<ProfileRecord> records;
+	};
+
+	/// <summary>
+	/// Hierarchical CPU profiler, scopes are recorded into per-thread lock-free buffers and collected once per frame
+	/// into a Chrome Trace/Perfetto JSON file and a rolling in-memory frame history
+	/// </summary>
+	class Profiler
+	{
+	public:
+		Profiler() = delete;
+		Profiler(const Profiler&) = delete;
+		Profiler(Profiler&&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+		~Profiler() = delete;
+
+		static void BeginSession(const std::string& name, const std::filesystem::path& filepath);
+		static void EndSession();
+		static bool IsSessionActive();
+
+		/// <summary>
+		/// Collects every thread's recorded scopes into the trace file and frame history, call once per frame from the main thread
+		/// </summary>
+		static void EndFrame();
+
+		/// <summary>
+		/// Rolling history of the most recently collected frames (Main Thread Only)
+		/// </summary>
+		static const std::deque<ProfileFrame>& GetFrameHistory();
+		static void SetFrameHistorySize(size_t frameCount);
+
+		static uint64_t Now()
+		{
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		// INFO: Used by ProfileScope
+		static const char* InternScopeName(std::string_view name);
+		static uint32_t BeginScope();
+		static void EndScope(const char* name, uint64_t start, uint64_t end, uint32_t depth);
+	};
+
+	class ProfileScope
+	{
+	public:
+		/// <summary>
+		/// The name is only read when the frame is collected, so it must outlive the program (String literals, function signatures)
+		/// </summary>
+		ProfileScope(const char* name) : name(nullptr), start(0), depth(0)
+		{
+			if (Profiler::IsSessionActive())
+			{
+				this->name = name;
+				depth = Profiler::BeginScope();
+				start = Profiler::Now();
+			}
+		}
+
+		/// <summary>
+		/// Copies the name when the scope begins (Once per thread for each distinct name), for names owned by something that can be destroyed
+		/// </summary>
+		ProfileScope(std::string_view name) : name(nullptr), start(0), depth(0)
+		{
+			if (Profiler::IsSessionActive())
+			{
+				this->name = Profiler::InternScopeName(name);
+				depth = Profiler::BeginScope();
+				start = Profiler::Now();
+			}
+		}
+
+		~ProfileScope()
+		{
+			if (name != nullptr) { Profiler::EndScope(name, start, Profiler::Now(), depth); }
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* name;
+		uint64_t start;
+		uint32_t depth;
+	};
+}
+
+#define FLUX_PROFILE_CONCATENATE_IMPL(a, b) a##b
+#define FLUX_PROFILE_CONCATENATE(a, b) FLUX_PROFILE_CONCATENATE_IMPL(a, b)
+
+#if defined(_MSC_VER)
+	#define FLUX_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+	#define FLUX_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
+#ifdef FLUX_PROFILING_ENABLED
+	#define FLUX_PROFILE_BEGIN_SESSION(name, filepath)	::Flux::Profiler::BeginSession(name, filepath)
+	#define FLUX_PROFILE_END_SESSION()					::Flux::Profiler::EndSession()
+	#define FLUX_PROFILE_END_FRAME()					::Flux::Profiler::EndFrame()
+	#define FLUX_PROFILE_SCOPE_IMPL(name)				::Flux::ProfileScope FLUX_PROFILE_CONCATENATE(profileScope, __LINE__)(name)
+	#define FLUX_PROFILE_SCOPE(name)					FLUX_PROFILE_SCOPE_IMPL("" name) // INFO: String Literals Only, Concatenating Fails to Compile for Anything Else
+	#define FLUX_PROFILE_SCOPE_DYNAMIC(name)			FLUX_PROFILE_SCOPE_IMPL(::std::string_view{ name })
+	#define FLUX_PROFILE_FUNCTION()						FLUX_PROFILE_SCOPE_IMPL(FLUX_FUNCTION_SIGNATURE)
+#else // INFO: Profiling Macros Scraped in Release Builds
+	#define FLUX_PROFILE_BEGIN_SESSION(name, filepath)	((void)0)
+	#define FLUX_PROFILE_END_SESSION()					((void)0)
+	#define FLUX_PROFILE_END_FRAME()					((void)0)
+	#define FLUX_PROFILE_SCOPE(name)					((void)0)
+	#define FLUX_PROFILE_SCOPE_DYNAMIC(name)			((void)0)
+	#define FLUX_PROFILE_FUNCTION()						((void)0)
+#endif
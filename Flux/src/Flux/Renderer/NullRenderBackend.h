@@ -0,0 +1,37 @@
+#pragma once
+
+#include "RenderBackend.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Discards every batch, keeps the CPU side of rendering (submission, sorting, vertex generation) runnable without a GPU
+	/// </summary>
+	class NullRenderBackend : public RenderBackend
+	{
+	public:
+		NullRenderBackend() = default;
+		virtual ~NullRenderBackend() override = default;
+
+		virtual void BeginFrame(const sf::Color& clearColor) override
+		{
+			drawCallCount = 0;
+			vertexCount = 0;
+		}
+
+		virtual void DrawBatch(const sf::Vertex* vertices, size_t vertexCount, const sf::Texture* texture, BlendMode blendMode) override
+		{
+			++drawCallCount;
+			this->vertexCount += vertexCount;
+		}
+
+		virtual void EndFrame() override {}
+
+		uint32_t GetDrawCallCount() const { return drawCallCount; }
+		size_t GetVertexCount() const { return vertexCount; }
+
+	private:
+		uint32_t drawCallCount = 0;
+		size_t vertexCount = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfml/Graphics/Color.hpp>
+
+namespace sf
+{
+	class Texture;
+	struct Vertex;
+}
+
+namespace Flux
+{
+	enum class BlendMode : uint8_t
+	{
+		Alpha = 0,
+		Additive,
+		Multiply,
+		None
+	};
+
+	/// <summary>
+	/// Where the Renderer2D sends its batches, one DrawBatch per texture/blend mode run of triangles
+	/// </summary>
+	class RenderBackend
+	{
+	public:
+		virtual ~RenderBackend() = default;
+
+		virtual void BeginFrame(const sf::Color& clearColor) = 0;
+		virtual void DrawBatch(const sf::Vertex* vertices, size_t vertexCount, const sf::Texture* texture, BlendMode blendMode) = 0;
+		virtual void EndFrame() = 0;
+
+		/// <summary>
+		/// Called on a thread before it starts (Attach) and after it stops (Detach) making the calls above, for backends whose
+		/// context can only be current on one thread at a time (e.g. OpenGL). The renderer detaches from the main thread before
+		/// handing the backend to its render thread and attaches back once that thread has stopped.
+		/// </summary>
+		virtual void AttachToCurrentThread() {}
+		virtual void DetachFromCurrentThread() {}
+	};
+}
\ No newline at end of file
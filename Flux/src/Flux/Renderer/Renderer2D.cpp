@@ -0,0 +1,351 @@
+#include "FluxPCH.h"
+
+#include "Renderer2D.h"
+
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+#include <sfml/Graphics/Sprite.hpp>
+#include <sfml/Graphics/Texture.hpp>
+#include <sfml/Graphics/VertexArray.hpp>
+
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Utility/RadixSort.h"
+
+namespace Flux
+{
+	namespace
+	{
+		constexpr uint32_t VerticesPerSprite = 6;
+		constexpr uint32_t VertexGenerationBatchSize = 2048;
+		constexpr uint32_t TextureIDMask = (1u << 30) - 1;
+
+		// INFO: Set on a Command's Index when it Refers to a Vertex Submission Rather than a Sprite
+		constexpr uint32_t VertexSubmissionBit = 1u << 31;
+
+		void WriteSpriteVertices(const Sprite2D& sprite, sf::Vertex* vertices)
+		{
+			// INFO: Corners Relative to the Origin
+			const float left = -sprite.origin.x;
+			const float top = -sprite.origin.y;
+			const float right = left + sprite.size.x;
+			const float bottom = top + sprite.size.y;
+
+			sf::Vector2f topLeft(left, top);
+			sf::Vector2f topRight(right, top);
+			sf::Vector2f bottomLeft(left, bottom);
+			sf::Vector2f bottomRight(right, bottom);
+
+			if (sprite.rotation != 0.0f)
+			{
+				const float radians = sprite.rotation * (std::numbers::pi_v<float> / 180.0f);
+				const float cosine = std::cos(radians);
+				const float sine = std::sin(radians);
+
+				auto rotate = [cosine, sine](sf::Vector2f& point) { point = sf::Vector2f(point.x * cosine - point.y * sine, point.x * sine + point.y * cosine); };
+				rotate(topLeft);
+				rotate(topRight);
+				rotate(bottomLeft);
+				rotate(bottomRight);
+			}
+
+			const sf::Vector2f position = sprite.position;
+			topLeft += position;
+			topRight += position;
+			bottomLeft += position;
+			bottomRight += position;
+
+			// INFO: Texture Coordinates in Pixels (SFML's Default Coordinate Type)
+			sf::FloatRect textureRect(sf::Vector2f(sprite.textureRect.position), sf::Vector2f(sprite.textureRect.size));
+			if (sprite.textureRect.size.x == 0 && sprite.textureRect.size.y == 0 && sprite.texture != nullptr)
+			{
+				textureRect = sf::FloatRect({ 0.0f, 0.0f }, sf::Vector2f(sprite.texture->getSize()));
+			}
+
+			const float u0 = textureRect.position.x;
+			const float v0 = textureRect.position.y;
+			const float u1 = u0 + textureRect.size.x;
+			const float v1 = v0 + textureRect.size.y;
+
+			vertices[0] = { topLeft, sprite.color, { u0, v0 } };
+			vertices[1] = { topRight, sprite.color, { u1, v0 } };
+			vertices[2] = { bottomLeft, sprite.color, { u0, v1 } };
+			vertices[3] = { bottomLeft, sprite.color, { u0, v1 } };
+			vertices[4] = { topRight, sprite.color, { u1, v0 } };
+			vertices[5] = { bottomRight, sprite.color, { u1, v1 } };
+		}
+	}
+
+	Renderer2D::Renderer2D(std::unique_ptr<RenderBackend> backend) : backend(std::move(backend))
+	{
+		FLUX_CORE_ASSERT(this->backend != nullptr, "Renderer2D requires a render backend!");
+	}
+
+	Renderer2D::~Renderer2D()
+	{
+		SetRenderThreadEnabled(false);
+	}
+
+	void Renderer2D::BeginFrame()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: Never the Packet in Flight, EndFrame Waited for the One Recorded into Before it
+		FramePacket& packet = packets[recordIndex];
+		packet.sprites.clear();
+		packet.vertexSubmissions.clear();
+		packet.commands.clear();
+	}
+
+	void Renderer2D::Submit(const Sprite2D& sprite)
+	{
+		FramePacket& packet = packets[recordIndex];
+
+		const uint32_t spriteIndex = static_cast<uint32_t>(packet.sprites.size());
+		packet.sprites.push_back(sprite);
+		packet.commands.push_back({ MakeSortKey(sprite.layer, sprite.depth, sprite.blendMode, GetTextureID(sprite.texture)), spriteIndex });
+	}
+
+	void Renderer2D::DrawSprite(const sf::Sprite& sprite, uint8_t layer, float depth, BlendMode blendMode)
+	{
+		const sf::Vector2f scale = sprite.getScale();
+		const sf::IntRect& textureRect = sprite.getTextureRect();
+
+		Sprite2D sprite2D;
+		sprite2D.position = sprite.getPosition();
+		sprite2D.size = Vector2F(std::abs(static_cast<float>(textureRect.size.x)) * scale.x, std::abs(static_cast<float>(textureRect.size.y)) * scale.y);
+		sprite2D.origin = Vector2F(sprite.getOrigin().x * scale.x, sprite.getOrigin().y * scale.y);
+		sprite2D.rotation = sprite.getRotation().asDegrees();
+		sprite2D.texture = &sprite.getTexture();
+		sprite2D.textureRect = textureRect;
+		sprite2D.color = sprite.getColor();
+		sprite2D.blendMode = blendMode;
+		sprite2D.layer = layer;
+		sprite2D.depth = depth;
+
+		Submit(sprite2D);
+	}
+
+	void Renderer2D::SubmitVertices(const sf::Vertex* vertices, size_t vertexCount, const sf::Texture* texture, uint8_t layer, float depth, BlendMode blendMode)
+	{
+		if (vertexCount == 0) { return; }
+
+		FramePacket& packet = packets[recordIndex];
+
+		const uint32_t submissionIndex = static_cast<uint32_t>(packet.vertexSubmissions.size());
+		packet.vertexSubmissions.push_back({ vertices, vertexCount, texture, blendMode });
+		packet.commands.push_back({ MakeSortKey(layer, depth, blendMode, GetTextureID(texture)), submissionIndex | VertexSubmissionBit });
+	}
+
+	void Renderer2D::SubmitVertices(const sf::VertexArray& vertexArray, const sf::Texture* texture, uint8_t layer, float depth, BlendMode blendMode)
+	{
+		if (vertexArray.getVertexCount() == 0) { return; }
+
+		FLUX_CORE_ASSERT(vertexArray.getPrimitiveType() == sf::PrimitiveType::Triangles, "Renderer2D only draws vertex arrays of triangles!");
+		SubmitVertices(&vertexArray[0], vertexArray.getVertexCount(), texture, layer, depth, blendMode);
+	}
+
+	void Renderer2D::EndFrame()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		FramePacket& packet = packets[recordIndex];
+		packet.clearColor = clearColor;
+
+		if (!IsRenderThreadEnabled())
+		{
+			statistics = Execute(packet);
+			return;
+		}
+
+		{
+			// INFO: Waiting for the Previous Packet Bounds Latency to One Frame and Frees its Buffers for Recording the Next
+			std::unique_lock lock(renderMutex);
+			renderCondition.wait(lock, [this] { return !isPacketPending; });
+
+			statistics = pendingStatistics;
+			pendingIndex = recordIndex;
+			isPacketPending = true;
+		}
+
+		renderCondition.notify_all();
+		recordIndex ^= 1;
+	}
+
+	void Renderer2D::SetRenderThreadEnabled(bool enabled)
+	{
+		if (enabled == IsRenderThreadEnabled()) { return; }
+
+		if (enabled)
+		{
+			isPacketPending = false;
+			isStopRequested = false;
+			pendingStatistics = statistics;
+
+			backend->DetachFromCurrentThread();
+			renderThread = std::thread(&Renderer2D::RenderThreadLoop, this);
+			return;
+		}
+
+		{
+			std::lock_guard lock(renderMutex);
+			isStopRequested = true;
+		}
+
+		// INFO: The Render Thread Presents a Pending Packet Before Stopping, so No Recorded Frame is Dropped
+		renderCondition.notify_all();
+		renderThread.join();
+
+		statistics = pendingStatistics;
+		backend->AttachToCurrentThread();
+	}
+
+	void Renderer2D::Flush()
+	{
+		if (!IsRenderThreadEnabled()) { return; }
+
+		std::unique_lock lock(renderMutex);
+		renderCondition.wait(lock, [this] { return !isPacketPending; });
+
+		statistics = pendingStatistics;
+	}
+
+	uint64_t Renderer2D::MakeSortKey(uint8_t layer, float depth, BlendMode blendMode, uint32_t textureID)
+	{
+		// INFO: Flip the Float's Bits so Unsigned Integer Order Matches Float Order (Negatives Included), Keep the Top 24
+		uint32_t depthBits = std::bit_cast<uint32_t>(depth);
+		depthBits = (depthBits & 0x80000000u) ? ~depthBits : (depthBits | 0x80000000u);
+
+		return (static_cast<uint64_t>(layer) << 56) |
+			   (static_cast<uint64_t>(depthBits >> 8) << 32) |
+			   (static_cast<uint64_t>(blendMode) << 30) |
+			   static_cast<uint64_t>(textureID & TextureIDMask);
+	}
+
+	uint32_t Renderer2D::GetTextureID(const sf::Texture* texture)
+	{
+		if (texture == nullptr) { return 0; }
+
+		// INFO: Consecutive Submissions Usually Share a Texture, Skip the Lookup for those
+		if (texture == lastTexture) { return lastTextureID; }
+
+		auto [it, inserted] = textureIDs.try_emplace(texture, static_cast<uint32_t>(textureIDs.size() + 1));
+		lastTexture = texture;
+		lastTextureID = it->second;
+		return lastTextureID;
+	}
+
+	Renderer2DStatistics Renderer2D::Execute(FramePacket& packet)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		backend->BeginFrame(packet.clearColor);
+
+		SortCommands(packet);
+		GenerateVertices(packet);
+		BuildBatches(packet);
+
+		Renderer2DStatistics frameStatistics;
+
+		{
+			FLUX_PROFILE_SCOPE("Renderer2D::DrawBatches");
+
+			for (const RenderBatch& batch : batches)
+			{
+				backend->DrawBatch(batch.vertices, batch.vertexCount, batch.texture, batch.blendMode);
+				frameStatistics.vertexCount += static_cast<uint32_t>(batch.vertexCount);
+			}
+		}
+
+		backend->EndFrame();
+
+		frameStatistics.spriteCount = static_cast<uint32_t>(packet.sprites.size());
+		frameStatistics.drawCallCount = static_cast<uint32_t>(batches.size());
+		return frameStatistics;
+	}
+
+	void Renderer2D::SortCommands(FramePacket& packet)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		RadixSort(packet.commands, sortScratch, [](const RenderCommand& command) { return command.sortKey; });
+	}
+
+	void Renderer2D::GenerateVertices(const FramePacket& packet)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		vertices.resize(packet.commands.size() * VerticesPerSprite);
+
+		// INFO: Each Command Owns a Fixed Slice of the Vertex Buffer, so Generation Splits Across the Job System Freely (Vertex Submissions Leave theirs Unused)
+		JobSystem::ParallelFor(static_cast<uint32_t>(packet.commands.size()), [this, &packet](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				const uint32_t spriteIndex = packet.commands[i].spriteIndex;
+				if ((spriteIndex & VertexSubmissionBit) == 0) { WriteSpriteVertices(packet.sprites[spriteIndex], vertices.data() + static_cast<size_t>(i) * VerticesPerSprite); }
+			}
+		}, VertexGenerationBatchSize);
+	}
+
+	void Renderer2D::BuildBatches(const FramePacket& packet)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		batches.clear();
+
+		// INFO: Only Runs of Consecutive Sprites Share a Batch, their Slices of the Vertex Buffer are Contiguous
+		bool isSpriteBatch = false;
+
+		for (uint32_t i = 0; i < packet.commands.size(); ++i)
+		{
+			const uint32_t spriteIndex = packet.commands[i].spriteIndex;
+
+			if (spriteIndex & VertexSubmissionBit)
+			{
+				const VertexSubmission& submission = packet.vertexSubmissions[spriteIndex & ~VertexSubmissionBit];
+				batches.push_back({ submission.texture, submission.blendMode, submission.vertices, submission.vertexCount });
+				isSpriteBatch = false;
+				continue;
+			}
+
+			const Sprite2D& sprite = packet.sprites[spriteIndex];
+
+			if (!isSpriteBatch || batches.back().texture != sprite.texture || batches.back().blendMode != sprite.blendMode)
+			{
+				batches.push_back({ sprite.texture, sprite.blendMode, vertices.data() + static_cast<size_t>(i) * VerticesPerSprite, 0 });
+				isSpriteBatch = true;
+			}
+
+			batches.back().vertexCount += VerticesPerSprite;
+		}
+	}
+
+	void Renderer2D::RenderThreadLoop()
+	{
+		backend->AttachToCurrentThread();
+
+		std::unique_lock lock(renderMutex);
+
+		while (true)
+		{
+			renderCondition.wait(lock, [this] { return isPacketPending || isStopRequested; });
+			if (!isPacketPending) { break; }
+
+			// INFO: The Main Thread Only Touches the Other Packet until this One is Released, so it's Executed Unlocked
+			FramePacket& packet = packets[pendingIndex];
+			lock.unlock();
+			const Renderer2DStatistics frameStatistics = Execute(packet);
+			lock.lock();
+
+			pendingStatistics = frameStatistics;
+			isPacketPending = false;
+			renderCondition.notify_all();
+		}
+
+		lock.unlock();
+		backend->DetachFromCurrentThread();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sfml/Graphics/Color.hpp>
+#include <sfml/Graphics/Rect.hpp>
+#include <sfml/Graphics/Vertex.hpp>
+
+#include "Flux/Math/Vector2.h"
+#include "RenderBackend.h"
+
+namespace sf
+{
+	class Sprite;
+	class VertexArray;
+}
+
+namespace Flux
+{
+	struct Sprite2D
+	{
+		Vector2F position;
+		Vector2F size = Vector2F(1.0f, 1.0f);	// World size of the quad (Negative flips)
+		Vector2F origin;						// Pivot for position and rotation, relative to the top-left corner
+		float rotation = 0.0f;					// Degrees, clockwise
+
+		const sf::Texture* texture = nullptr;
+		sf::IntRect textureRect;				// Zero size uses the whole texture
+		sf::Color color = sf::Color::White;
+		BlendMode blendMode = BlendMode::Alpha;
+
+		uint8_t layer = 0;						// Layers draw in ascending order
+		float depth = 0.0f;						// Within a layer, lower depths draw first
+	};
+
+	struct Renderer2DStatistics
+	{
+		uint32_t spriteCount = 0;
+		uint32_t drawCallCount = 0;
+		uint32_t vertexCount = 0;
+	};
+
+	/// <summary>
+	/// Batched sprite renderer, submissions are recorded as commands with 64-bit sort keys (Layer, Depth, Blend Mode, Texture),
+	/// radix sorted at the end of the frame and drawn as one triangle batch per run of matching texture and blend mode.
+	/// Each frame's commands are recorded into one of two frame packets, with the render thread enabled the previous packet is
+	/// sorted, drawn and presented on a dedicated thread while the next one is recorded.
+	/// </summary>
+	class Renderer2D
+	{
+	public:
+		Renderer2D(std::unique_ptr<RenderBackend> backend);
+		~Renderer2D();
+
+		Renderer2D(const Renderer2D&) = delete;
+		Renderer2D& operator=(const Renderer2D&) = delete;
+
+		void BeginFrame();
+
+		void Submit(const Sprite2D& sprite);
+
+		/// <summary>
+		/// Submits an sf::Sprite using its transform, texture rect and color
+		/// </summary>
+		void DrawSprite(const sf::Sprite& sprite, uint8_t layer = 0, float depth = 0.0f, BlendMode blendMode = BlendMode::Alpha);
+
+		/// <summary>
+		/// Submits already generated triangles (e.g. particles), drawn as one batch in sort order with the sprites.
+		/// The vertices are read when the frame executes, not copied, so they must stay unchanged until the next EndFrame returns.
+		/// </summary>
+		void SubmitVertices(const sf::Vertex* vertices, size_t vertexCount, const sf::Texture* texture, uint8_t layer = 0, float depth = 0.0f, BlendMode blendMode = BlendMode::Alpha);
+		void SubmitVertices(const sf::VertexArray& vertexArray, const sf::Texture* texture, uint8_t layer = 0, float depth = 0.0f, BlendMode blendMode = BlendMode::Alpha);
+
+		/// <summary>
+		/// Sorts the frame's submissions, generates their vertices, draws the batches and presents.
+		/// With the render thread enabled it waits for the previous frame to be presented, then hands this one over and returns.
+		/// </summary>
+		void EndFrame();
+
+		/// <summary>
+		/// Moves sorting, vertex generation, drawing and presenting onto a dedicated thread that owns the backend (and its context).
+		/// At most one frame is in flight, so presents trail recording by a frame and a slow render thread holds the main one back.
+		/// Textures submitted in a frame must stay alive until the next EndFrame returns. Call between frames, from the main thread.
+		/// </summary>
+		void SetRenderThreadEnabled(bool enabled);
+		bool IsRenderThreadEnabled() const { return renderThread.joinable(); }
+
+		/// <summary>
+		/// Blocks until the frame handed to the render thread has been presented, returns straight away without one
+		/// </summary>
+		void Flush();
+
+		void SetClearColor(const sf::Color& color) { clearColor = color; }
+		const sf::Color& GetClearColor() const { return clearColor; }
+
+		/// <summary>
+		/// Of the most recently presented frame, a frame behind the one being recorded with the render thread enabled
+		/// </summary>
+		const Renderer2DStatistics& GetStatistics() const { return statistics; }
+
+		RenderBackend& GetBackend() { return *backend; }
+
+		/// <summary>
+		/// [63-56] Layer, [55-32] Depth, [31-30] Blend Mode, [29-0] Texture
+		/// </summary>
+		static uint64_t MakeSortKey(uint8_t layer, float depth, BlendMode blendMode, uint32_t textureID);
+
+	private:
+		struct RenderCommand
+		{
+			uint64_t sortKey;
+			uint32_t spriteIndex;
+		};
+
+		struct RenderBatch
+		{
+			const sf::Texture* texture;
+			BlendMode blendMode;
+			const sf::Vertex* vertices;
+			size_t vertexCount;
+		};
+
+		struct VertexSubmission
+		{
+			const sf::Vertex* vertices;
+			size_t vertexCount;
+			const sf::Texture* texture;
+			BlendMode blendMode;
+		};
+
+		// INFO: Everything Recorded for One Frame, Owned by the Recording Thread until Handed to the Render Thread
+		struct FramePacket
+		{
+			sf::Color clearColor;
+			std::vector<Sprite2D> sprites;
+			std::vector<VertexSubmission> vertexSubmissions;
+			std::vector<RenderCommand> commands;
+		};
+
+		uint32_t GetTextureID(const sf::Texture* texture);
+
+		/// <summary>
+		/// Sorts, draws and presents a packet, on the render thread when enabled (the only place the backend is used from)
+		/// </summary>
+		Renderer2DStatistics Execute(FramePacket& packet);
+
+		void SortCommands(FramePacket& packet);
+		void GenerateVertices(const FramePacket& packet);
+		void BuildBatches(const FramePacket& packet);
+
+		void RenderThreadLoop();
+
+	private:
+		std::unique_ptr<RenderBackend> backend;
+		sf::Color clearColor = sf::Color::Black;
+
+		std::array<FramePacket, 2> packets;
+		uint32_t recordIndex = 0;
+
+		// INFO: Execute's Working Buffers, Reused Every Frame
+		std::vector<RenderCommand> sortScratch;
+		std::vector<sf::Vertex> vertices;
+		std::vector<RenderBatch> batches;
+
+		std::unordered_map<const sf::Texture*, uint32_t> textureIDs;
+		const sf::Texture* lastTexture = nullptr;
+		uint32_t lastTextureID = 0;
+
+		Renderer2DStatistics statistics;
+
+		// INFO: Hand-off to the Render Thread, isPacketPending is Set by EndFrame and Cleared Once the Packet is Presented
+		std::thread renderThread;
+		std::mutex renderMutex;
+		std::condition_variable renderCondition;
+		bool isPacketPending = false;
+		bool isStopRequested = false;
+		uint32_t pendingIndex = 0;
+		Renderer2DStatistics pendingStatistics;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "FluxPCH.h"
+
+#include "SFMLRenderBackend.h"
+
+#include <sfml/Graphics/RenderWindow.hpp>
+
+namespace Flux
+{
+	namespace
+	{
+		const sf::BlendMode& ToSFMLBlendMode(BlendMode blendMode)
+		{
+			switch (blendMode)
+			{
+				case BlendMode::Additive: return sf::BlendAdd;
+				case BlendMode::Multiply: return sf::BlendMultiply;
+				case BlendMode::None: return sf::BlendNone;
+				case BlendMode::Alpha:
+				default: return sf::BlendAlpha;
+			}
+		}
+	}
+
+	void SFMLRenderBackend::BeginFrame(const sf::Color& clearColor)
+	{
+		window.clear(clearColor);
+	}
+
+	void SFMLRenderBackend::DrawBatch(const sf::Vertex* vertices, size_t vertexCount, const sf::Texture* texture, BlendMode blendMode)
+	{
+		sf::RenderStates states(ToSFMLBlendMode(blendMode));
+		states.texture = texture;
+
+		window.draw(vertices, vertexCount, sf::PrimitiveType::Triangles, states);
+	}
+
+	void SFMLRenderBackend::EndFrame()
+	{
+		window.display();
+	}
+
+	void SFMLRenderBackend::AttachToCurrentThread()
+	{
+		FLUX_CORE_VERIFY(window.setActive(true), "Failed to activate the window's context on this thread!");
+	}
+
+	void SFMLRenderBackend::DetachFromCurrentThread()
+	{
+		FLUX_CORE_VERIFY(window.setActive(false), "Failed to deactivate the window's context on this thread!");
+	}
+}
\ No newline at end of file
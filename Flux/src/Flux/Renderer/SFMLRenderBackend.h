@@ -0,0 +1,28 @@
+#pragma once
+
+#include "RenderBackend.h"
+
+namespace sf { class RenderWindow; }
+
+namespace Flux
+{
+	/// <summary>
+	/// Draws batches into an sf::RenderWindow, clearing it at the start of the frame and displaying it at the end
+	/// </summary>
+	class SFMLRenderBackend : public RenderBackend
+	{
+	public:
+		SFMLRenderBackend(sf::RenderWindow& window) : window(window) {}
+		virtual ~SFMLRenderBackend() override = default;
+
+		virtual void BeginFrame(const sf::Color& clearColor) override;
+		virtual void DrawBatch(const sf::Vertex* vertices, size_t vertexCount, const sf::Texture* texture, BlendMode blendMode) override;
+		virtual void EndFrame() override;
+
+		virtual void AttachToCurrentThread() override;
+		virtual void DetachFromCurrentThread() override;
+
+	private:
+		sf::RenderWindow& window;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "FluxPCH.h"
+
+#include "SkylinePacker.h"
+
+#include <limits>
+
+namespace Flux
+{
+	SkylinePacker::SkylinePacker(sf::Vector2u size)
+	{
+		Reset(size);
+	}
+
+	void SkylinePacker::Reset(sf::Vector2u size)
+	{
+		this->size = size;
+		skyline.clear();
+		usedArea = 0;
+
+		if (size.x > 0) { skyline.push_back({ 0, 0, size.x }); }
+	}
+
+	std::optional<sf::Vector2u> SkylinePacker::Insert(sf::Vector2u rectangleSize)
+	{
+		if (rectangleSize.x == 0 || rectangleSize.y == 0) { return std::nullopt; }
+
+		size_t bestIndex = skyline.size();
+		uint32_t bestBottom = std::numeric_limits<uint32_t>::max();
+		uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+		uint32_t bestY = 0;
+
+		for (size_t i = 0; i < skyline.size(); ++i)
+		{
+			uint32_t y = 0;
+			if (!Fits(i, rectangleSize, y)) { continue; }
+
+			const uint32_t bottom = y + rectangleSize.y;
+			if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth))
+			{
+				bestIndex = i;
+				bestBottom = bottom;
+				bestWidth = skyline[i].width;
+				bestY = y;
+			}
+		}
+
+		if (bestIndex == skyline.size()) { return std::nullopt; }
+
+		const sf::Vector2u position(skyline[bestIndex].x, bestY);
+		skyline.insert(skyline.begin() + bestIndex, { position.x, bestBottom, rectangleSize.x });
+
+		// INFO: Trim the Segments the New One Now Covers
+		const uint32_t right = position.x + rectangleSize.x;
+		for (size_t i = bestIndex + 1; i < skyline.size();)
+		{
+			Segment& segment = skyline[i];
+			if (segment.x >= right) { break; }
+
+			const uint32_t overlap = right - segment.x;
+			if (overlap >= segment.width)
+			{
+				skyline.erase(skyline.begin() + i);
+				continue;
+			}
+
+			segment.x += overlap;
+			segment.width -= overlap;
+			break;
+		}
+
+		MergeSegments();
+		usedArea += static_cast<uint64_t>(rectangleSize.x) * rectangleSize.y;
+
+		return position;
+	}
+
+	void SkylinePacker::Grow(sf::Vector2u newSize)
+	{
+		FLUX_CORE_ASSERT(newSize.x >= size.x && newSize.y >= size.y, "SkylinePacker can't shrink!");
+
+		if (newSize.x > size.x)
+		{
+			skyline.push_back({ size.x, 0, newSize.x - size.x });
+			MergeSegments();
+		}
+
+		size = newSize;
+	}
+
+	bool SkylinePacker::Fits(size_t segmentIndex, sf::Vector2u rectangleSize, uint32_t& y) const
+	{
+		if (skyline[segmentIndex].x + rectangleSize.x > size.x) { return false; }
+
+		// INFO: The Rectangle Rests on the Highest Segment Underneath it
+		y = 0;
+		uint32_t remainingWidth = rectangleSize.x;
+		for (size_t i = segmentIndex; remainingWidth > 0; ++i)
+		{
+			y = std::max(y, skyline[i].y);
+			if (y + rectangleSize.y > size.y) { return false; }
+
+			remainingWidth -= std::min(remainingWidth, skyline[i].width);
+		}
+
+		return true;
+	}
+
+	void SkylinePacker::MergeSegments()
+	{
+		for (size_t i = 1; i < skyline.size();)
+		{
+			if (skyline[i - 1].y == skyline[i].y)
+			{
+				skyline[i - 1].width += skyline[i].width;
+				skyline.erase(skyline.begin() + i);
+			}
+			else { ++i; }
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <sfml/System/Vector2.hpp>
+
+namespace Flux
+{
+	/// <summary>
+	/// Rectangle packer tracking the top-most free row of every column span (the skyline) of a bin.
+	/// Rectangles go where their bottom edge ends up highest (Bottom-Left heuristic, Y grows downwards), ties go to the
+	/// narrowest span to leave wide spans for wide rectangles. Freed space is not reused, repack to reclaim it.
+	/// </summary>
+	class SkylinePacker
+	{
+	public:
+		SkylinePacker(sf::Vector2u size = sf::Vector2u());
+
+		void Reset(sf::Vector2u size);
+
+		/// <summary>
+		/// Returns the top-left corner of the placed rectangle, or nothing if it doesn't fit
+		/// </summary>
+		std::optional<sf::Vector2u> Insert(sf::Vector2u rectangleSize);
+
+		/// <summary>
+		/// Enlarges the bin while keeping every placement, the new columns start empty
+		/// </summary>
+		void Grow(sf::Vector2u newSize);
+
+		sf::Vector2u GetSize() const { return size; }
+		uint64_t GetUsedArea() const { return usedArea; }
+
+	private:
+		struct Segment
+		{
+			uint32_t x;
+			uint32_t y;	// First free row
+			uint32_t width;
+		};
+
+		/// <summary>
+		/// Finds the row a rectangle starting at the segment would rest on, false if it runs off the bin
+		/// </summary>
+		bool Fits(size_t segmentIndex, sf::Vector2u rectangleSize, uint32_t& y) const;
+
+		void MergeSegments();
+
+	private:
+		sf::Vector2u size;
+		std::vector<Segment> skyline;
+		uint64_t usedArea = 0;
+	};
+}
\ No newline at end of file
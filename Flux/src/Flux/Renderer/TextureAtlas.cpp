@@ -0,0 +1,266 @@
+#include "FluxPCH.h"
+
+#include "TextureAtlas.h"
+
+#include <sfml/Graphics/Font.hpp>
+#include <sfml/Graphics/Glyph.hpp>
+
+#include "Flux/Memory/Memory.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	TextureAtlas::TextureAtlas(const TextureAtlasSpecification& specification) : specification(specification)
+	{
+		this->specification.maxPageSize = std::min(this->specification.maxPageSize, sf::Texture::getMaximumSize());
+		this->specification.initialPageSize = std::min(this->specification.initialPageSize, this->specification.maxPageSize);
+	}
+
+	AtlasRegionID TextureAtlas::Add(const sf::Image& image, const sf::IntRect& sourceRect)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		const sf::IntRect rect = sourceRect.size == sf::Vector2i() ? sf::IntRect({ 0, 0 }, sf::Vector2i(image.getSize())) : sourceRect;
+		const sf::Vector2u size(rect.size);
+		if (size.x == 0 || size.y == 0) { return InvalidAtlasRegion; }
+
+		uint32_t pageIndex = 0;
+		sf::Vector2u position;
+		if (!Allocate(pages, size + sf::Vector2u(specification.padding, specification.padding), pageIndex, position))
+		{
+			FLUX_CORE_ERROR("Image is too large for the texture atlas: {0}x{1}", size.x, size.y);
+			return InvalidAtlasRegion;
+		}
+
+		Page& page = pages[pageIndex];
+		FLUX_CORE_VERIFY(page.image.copy(image, position, rect), "Texture atlas source rect is outside the image!");
+
+		if (page.texture == nullptr)
+		{
+			page.texture = std::make_unique<sf::Texture>();
+			UploadPage(page);
+		}
+		else
+		{
+			// INFO: Only the New Region Goes to the GPU, its Rows are Gathered from the Page Copy into One Contiguous Block
+			const size_t rowBytes = static_cast<size_t>(size.x) * 4;
+			const size_t pageRowBytes = static_cast<size_t>(page.image.getSize().x) * 4;
+			const std::uint8_t* source = page.image.getPixelsPtr() + position.y * pageRowBytes + position.x * 4;
+
+			uploadScratch.resize(rowBytes * size.y);
+			for (unsigned int row = 0; row < size.y; ++row)
+			{
+				std::copy_n(source + row * pageRowBytes, rowBytes, uploadScratch.data() + row * rowBytes);
+			}
+
+			page.texture->update(uploadScratch.data(), size, position);
+		}
+
+		page.usedArea += static_cast<uint64_t>(size.x) * size.y;
+		++page.regionCount;
+
+		AtlasRegionID region = static_cast<AtlasRegionID>(regions.size());
+		if (!freeRegions.empty())
+		{
+			region = freeRegions.back();
+			freeRegions.pop_back();
+		}
+		else { regions.emplace_back(); }
+
+		regions[region] = { pageIndex, sf::IntRect(sf::Vector2i(position), rect.size) };
+		++regionCount;
+
+		return region;
+	}
+
+	std::vector<AtlasRegionID> TextureAtlas::AddGlyphs(const sf::Font& font, unsigned int characterSize, std::u32string_view characters, bool isBold)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: Rasterise Everything First so the Font's Page is Read Back from the GPU Once
+		for (const char32_t character : characters) { (void)font.getGlyph(character, characterSize, isBold); }
+		const sf::Image fontImage = font.getTexture(characterSize).copyToImage();
+
+		std::vector<AtlasRegionID> result;
+		result.reserve(characters.size());
+
+		for (const char32_t character : characters)
+		{
+			// INFO: Whitespace has No Pixels and Gets No Region
+			const sf::Glyph& glyph = font.getGlyph(character, characterSize, isBold);
+			result.push_back(glyph.textureRect.size.x > 0 && glyph.textureRect.size.y > 0 ? Add(fontImage, glyph.textureRect) : InvalidAtlasRegion);
+		}
+
+		return result;
+	}
+
+	void TextureAtlas::Remove(AtlasRegionID region)
+	{
+		const AtlasRegion& atlasRegion = GetRegion(region);
+
+		Page& page = pages[atlasRegion.page];
+		page.usedArea -= static_cast<uint64_t>(atlasRegion.textureRect.size.x) * atlasRegion.textureRect.size.y;
+		--page.regionCount;
+
+		regions[region] = AtlasRegion();
+		freeRegions.push_back(region);
+		--regionCount;
+	}
+
+	void TextureAtlas::Defragment()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		ScratchScope scratch;
+		std::pmr::vector<AtlasRegionID> liveRegions(scratch.GetResource());
+		liveRegions.reserve(regionCount);
+		for (AtlasRegionID region = 0; region < regions.size(); ++region)
+		{
+			if (regions[region].textureRect.size != sf::Vector2i()) { liveRegions.push_back(region); }
+		}
+
+		// INFO: Tallest First Keeps the Skyline Flat, Leaving Fewer Gaps Underneath it
+		std::sort(liveRegions.begin(), liveRegions.end(), [this](AtlasRegionID a, AtlasRegionID b)
+		{
+			const sf::Vector2i& sizeA = regions[a].textureRect.size;
+			const sf::Vector2i& sizeB = regions[b].textureRect.size;
+			return sizeA.y != sizeB.y ? sizeA.y > sizeB.y : sizeA.x > sizeB.x;
+		});
+
+		std::vector<Page> packedPages;
+		std::vector<AtlasRegion> packedRegions = regions;
+
+		for (const AtlasRegionID region : liveRegions)
+		{
+			const AtlasRegion& atlasRegion = regions[region];
+			const sf::Vector2u size(atlasRegion.textureRect.size);
+
+			uint32_t pageIndex = 0;
+			sf::Vector2u position;
+			const bool isAllocated = Allocate(packedPages, size + sf::Vector2u(specification.padding, specification.padding), pageIndex, position);
+			FLUX_CORE_ASSERT(isAllocated, "Region no longer fits in the texture atlas!");
+
+			Page& page = packedPages[pageIndex];
+			FLUX_CORE_VERIFY(page.image.copy(pages[atlasRegion.page].image, position, atlasRegion.textureRect), "Failed to move texture atlas region!");
+			page.usedArea += static_cast<uint64_t>(size.x) * size.y;
+			++page.regionCount;
+
+			packedRegions[region] = { pageIndex, sf::IntRect(sf::Vector2i(position), atlasRegion.textureRect.size) };
+		}
+
+		// INFO: Surviving Pages Reuse their sf::Texture, so Pointers to them Stay Valid
+		for (size_t i = 0; i < packedPages.size(); ++i)
+		{
+			packedPages[i].texture = i < pages.size() ? std::move(pages[i].texture) : std::make_unique<sf::Texture>();
+			UploadPage(packedPages[i]);
+		}
+
+		FLUX_CORE_INFO("Defragmented texture atlas from {0} to {1} page(s)", pages.size(), packedPages.size());
+
+		pages = std::move(packedPages);
+		regions = std::move(packedRegions);
+	}
+
+	const AtlasRegion& TextureAtlas::GetRegion(AtlasRegionID region) const
+	{
+		FLUX_CORE_ASSERT(region < regions.size() && regions[region].textureRect.size != sf::Vector2i(), "Invalid texture atlas region!");
+		return regions[region];
+	}
+
+	void TextureAtlas::Apply(AtlasRegionID region, Sprite2D& sprite) const
+	{
+		const AtlasRegion& atlasRegion = GetRegion(region);
+		sprite.texture = pages[atlasRegion.page].texture.get();
+		sprite.textureRect = atlasRegion.textureRect;
+	}
+
+	AtlasPageStatistics TextureAtlas::GetPageStatistics(uint32_t page) const
+	{
+		const Page& atlasPage = pages[page];
+
+		AtlasPageStatistics statistics;
+		statistics.size = atlasPage.image.getSize();
+		statistics.regionCount = atlasPage.regionCount;
+		statistics.usedArea = atlasPage.usedArea;
+		statistics.packedArea = atlasPage.packer.GetUsedArea();
+		statistics.occupancy = static_cast<float>(static_cast<double>(atlasPage.usedArea) / (static_cast<double>(statistics.size.x) * statistics.size.y));
+
+		return statistics;
+	}
+
+	bool TextureAtlas::Allocate(std::vector<Page>& targetPages, sf::Vector2u size, uint32_t& page, sf::Vector2u& position) const
+	{
+		const uint32_t maxPageSize = specification.maxPageSize;
+		if (size.x > maxPageSize || size.y > maxPageSize) { return false; }
+
+		for (size_t i = 0; i < targetPages.size(); ++i)
+		{
+			if (const std::optional<sf::Vector2u> placement = targetPages[i].packer.Insert(size))
+			{
+				page = static_cast<uint32_t>(i);
+				position = *placement;
+				return true;
+			}
+		}
+
+		// INFO: Grow the Newest Page before Opening Another, Doubling the Shorter Side so it Stays Roughly Square
+		if (!targetPages.empty())
+		{
+			Page& lastPage = targetPages.back();
+
+			while (lastPage.packer.GetSize().x < maxPageSize || lastPage.packer.GetSize().y < maxPageSize)
+			{
+				sf::Vector2u newSize = lastPage.packer.GetSize();
+				if (newSize.x <= newSize.y) { newSize.x = std::min(newSize.x * 2, maxPageSize); }
+				else { newSize.y = std::min(newSize.y * 2, maxPageSize); }
+
+				GrowPage(lastPage, newSize);
+
+				if (const std::optional<sf::Vector2u> placement = lastPage.packer.Insert(size))
+				{
+					page = static_cast<uint32_t>(targetPages.size() - 1);
+					position = *placement;
+					return true;
+				}
+			}
+		}
+
+		sf::Vector2u pageSize(specification.initialPageSize, specification.initialPageSize);
+		while (pageSize.x < size.x) { pageSize.x = std::min(pageSize.x * 2, maxPageSize); }
+		while (pageSize.y < size.y) { pageSize.y = std::min(pageSize.y * 2, maxPageSize); }
+
+		Page& newPage = targetPages.emplace_back();
+		newPage.image.resize(pageSize, sf::Color::Transparent);
+		newPage.packer.Reset(pageSize);
+
+		page = static_cast<uint32_t>(targetPages.size() - 1);
+		position = *newPage.packer.Insert(size);
+		return true;
+	}
+
+	void TextureAtlas::GrowPage(Page& page, sf::Vector2u newSize) const
+	{
+		sf::Image image(newSize, sf::Color::Transparent);
+		FLUX_CORE_VERIFY(image.copy(page.image, { 0, 0 }), "Failed to grow texture atlas page!");
+
+		page.image = std::move(image);
+		page.packer.Grow(newSize);
+
+		// INFO: Pages being Built by Defragment have No Texture Yet, they are Uploaded Once at the End
+		if (page.texture != nullptr) { UploadPage(page); }
+	}
+
+	void TextureAtlas::UploadPage(Page& page) const
+	{
+		sf::Texture texture;
+		if (!texture.resize(page.image.getSize()))
+		{
+			FLUX_CORE_ERROR("Failed to create texture atlas page: {0}x{1}", page.image.getSize().x, page.image.getSize().y);
+			return;
+		}
+
+		texture.update(page.image);
+		texture.setSmooth(specification.isSmooth);
+		page.texture->swap(texture);
+	}
+}
\ No newline at end of file
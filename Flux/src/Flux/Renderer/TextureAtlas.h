@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <sfml/Graphics/Image.hpp>
+#include <sfml/Graphics/Rect.hpp>
+#include <sfml/Graphics/Texture.hpp>
+
+#include "Renderer2D.h"
+#include "SkylinePacker.h"
+
+namespace sf { class Font; }
+
+namespace Flux
+{
+	using AtlasRegionID = uint32_t;
+	static constexpr AtlasRegionID InvalidAtlasRegion = ~0u;
+
+	struct TextureAtlasSpecification
+	{
+		uint32_t initialPageSize = 512;	// Pages start this size and double until they reach the maximum
+		uint32_t maxPageSize = 4096;	// Clamped to the GPU's maximum texture size
+		uint32_t padding = 1;			// Transparent pixels kept between regions so smoothing doesn't bleed neighbours in
+		bool isSmooth = false;
+	};
+
+	struct AtlasRegion
+	{
+		uint32_t page = 0;
+		sf::IntRect textureRect;
+	};
+
+	struct AtlasPageStatistics
+	{
+		sf::Vector2u size;
+		uint32_t regionCount = 0;
+		uint64_t usedArea = 0;		// Pixels of live regions
+		uint64_t packedArea = 0;	// Pixels the packer has handed out, removed regions included until defragmented
+		float occupancy = 0.0f;		// usedArea over the page area
+	};
+
+	/// <summary>
+	/// Packs images (and font glyphs) added at runtime into a few large pages so sprites from different source images share a
+	/// texture and batch into one draw call. Pages grow up to the maximum size before a new one is opened, a CPU copy of each
+	/// page is kept so growing and defragmenting never read back from the GPU. Main thread only.
+	/// </summary>
+	class TextureAtlas
+	{
+	public:
+		TextureAtlas(const TextureAtlasSpecification& specification = TextureAtlasSpecification());
+
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+		/// <summary>
+		/// Copies the image (or the part inside sourceRect) into a page, returns InvalidAtlasRegion if it is larger than a page
+		/// </summary>
+		AtlasRegionID Add(const sf::Image& image, const sf::IntRect& sourceRect = sf::IntRect());
+
+		/// <summary>
+		/// Rasterises the characters with the font and adds each glyph, returned in the same order as the characters.
+		/// Glyph metrics (advance, bounds) still come from sf::Font::getGlyph.
+		/// </summary>
+		std::vector<AtlasRegionID> AddGlyphs(const sf::Font& font, unsigned int characterSize, std::u32string_view characters, bool isBold = false);
+
+		/// <summary>
+		/// Frees the region, its space is reclaimed by the next Defragment
+		/// </summary>
+		void Remove(AtlasRegionID region);
+
+		/// <summary>
+		/// Repacks every live region into as few (and as small) pages as possible, largest first.
+		/// Regions keep their IDs but move, re-read them (or re-Apply them to sprites) afterwards.
+		/// </summary>
+		void Defragment();
+
+		const AtlasRegion& GetRegion(AtlasRegionID region) const;
+		const sf::Texture& GetPageTexture(uint32_t page) const { return *pages[page].texture; }
+
+		/// <summary>
+		/// Points the sprite at the region's page and texture rect
+		/// </summary>
+		void Apply(AtlasRegionID region, Sprite2D& sprite) const;
+
+		uint32_t GetPageCount() const { return static_cast<uint32_t>(pages.size()); }
+		uint32_t GetRegionCount() const { return regionCount; }
+		AtlasPageStatistics GetPageStatistics(uint32_t page) const;
+
+		const TextureAtlasSpecification& GetSpecification() const { return specification; }
+
+	private:
+		struct Page
+		{
+			sf::Image image;
+			std::unique_ptr<sf::Texture> texture; // Heap allocated so sprites' texture pointers survive the pages vector growing
+			SkylinePacker packer;
+			uint64_t usedArea = 0;
+			uint32_t regionCount = 0;
+		};
+
+		/// <summary>
+		/// Finds space in an existing page, growing the last one or opening a new one if needed
+		/// </summary>
+		bool Allocate(std::vector<Page>& targetPages, sf::Vector2u size, uint32_t& page, sf::Vector2u& position) const;
+
+		void GrowPage(Page& page, sf::Vector2u newSize) const;
+		void UploadPage(Page& page) const;
+
+	private:
+		TextureAtlasSpecification specification;
+
+		std::vector<Page> pages;
+		std::vector<AtlasRegion> regions;
+		std::vector<AtlasRegionID> freeRegions;
+		uint32_t regionCount = 0;
+
+		std::vector<std::uint8_t> uploadScratch;
+	};
+}
\ No newline at end of file
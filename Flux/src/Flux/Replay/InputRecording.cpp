@@ -0,0 +1,312 @@
+#include "FluxPCH.h"
+
+#include "InputRecording.h"
+
+#include <bit>
+#include <cstring>
+
+namespace Flux
+{
+	namespace
+	{
+		constexpr size_t FlushThreshold = 64 * 1024;
+
+		void WriteVarint(std::vector<uint8_t>& buffer, uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				buffer.push_back(static_cast<uint8_t>(value | 0x80));
+				value >>= 7;
+			}
+			buffer.push_back(static_cast<uint8_t>(value));
+		}
+
+		void WriteSignedVarint(std::vector<uint8_t>& buffer, int64_t value)
+		{
+			// INFO: ZigZag Encoding, Keeps Small Negative Values Small
+			WriteVarint(buffer, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+		}
+
+		void WritePosition(std::vector<uint8_t>& buffer, const Vector2I& position)
+		{
+			WriteSignedVarint(buffer, position.x);
+			WriteSignedVarint(buffer, position.y);
+		}
+
+		void WriteFloat(std::vector<uint8_t>& buffer, float value)
+		{
+			uint32_t bits = std::bit_cast<uint32_t>(value);
+			for (int i = 0; i < 4; ++i) { buffer.push_back(static_cast<uint8_t>(bits >> (i * 8))); }
+		}
+
+		void WriteUInt(std::vector<uint8_t>& buffer, uint64_t value, int byteCount)
+		{
+			for (int i = 0; i < byteCount; ++i) { buffer.push_back(static_cast<uint8_t>(value >> (i * 8))); }
+		}
+	}
+
+#pragma region InputRecorder
+	InputRecorder::InputRecorder(const std::filesystem::path& filepath, unsigned int windowWidth, unsigned int windowHeight)
+		: previousFrameIndex(0), recordedEventCount(0)
+	{
+		file.open(filepath, std::ios::binary | std::ios::trunc);
+		FLUX_CORE_VERIFY(file.is_open(), std::format("Failed to open input recording file: {0}", filepath.string()));
+
+		buffer.reserve(FlushThreshold * 2);
+
+		buffer.insert(buffer.end(), std::begin(InputRecordingHeader::Magic), std::end(InputRecordingHeader::Magic));
+		WriteUInt(buffer, InputRecordingHeader::CurrentVersion, 2);
+		WriteUInt(buffer, 0, 2);
+		WriteUInt(buffer, windowWidth, 4);
+		WriteUInt(buffer, windowHeight, 4);
+
+		FLUX_CORE_INFO("Recording input to: {0}", filepath.string());
+	}
+
+	InputRecorder::~InputRecorder()
+	{
+		Finish(previousFrameIndex);
+	}
+
+	void InputRecorder::Record(uint64_t frameIndex, const Event& event)
+	{
+		if (!file.is_open()) { return; }
+
+		const EventType type = event.GetEventType();
+		WriteRecordHeader(frameIndex, type);
+
+		switch (type)
+		{
+			case EventType::WindowResize:
+			{
+				const auto& resizeEvent = static_cast<const WindowResizeEvent&>(event);
+				WriteVarint(buffer, resizeEvent.GetWidth());
+				WriteVarint(buffer, resizeEvent.GetHeight());
+				break;
+			}
+			case EventType::WindowMoved:
+			{
+				WritePosition(buffer, static_cast<const WindowMovedEvent&>(event).GetPosition());
+				break;
+			}
+			case EventType::KeyPressed:
+			{
+				const auto& keyEvent = static_cast<const KeyPressedEvent&>(event);
+				WriteSignedVarint(buffer, keyEvent.GetKeyCode());
+				WriteVarint(buffer, keyEvent.GetRepeatCount());
+				break;
+			}
+			case EventType::KeyReleased:
+			{
+				WriteSignedVarint(buffer, static_cast<const KeyReleasedEvent&>(event).GetKeyCode());
+				break;
+			}
+			case EventType::MouseButtonPressed:
+			case EventType::MouseButtonReleased:
+			{
+				const auto& buttonEvent = static_cast<const MouseButtonEvent&>(event);
+				WriteSignedVarint(buffer, buttonEvent.GetButtonCode());
+				WritePosition(buffer, buttonEvent.GetPosition());
+				break;
+			}
+			case EventType::MouseMoved:
+			{
+				WritePosition(buffer, static_cast<const MouseMovedEvent&>(event).GetPosition());
+				break;
+			}
+			case EventType::MouseWheelScrolled:
+			{
+				const auto& scrolledEvent = static_cast<const MouseScrolledEvent&>(event);
+				WriteSignedVarint(buffer, scrolledEvent.GetButtonCode());
+				WritePosition(buffer, scrolledEvent.GetPosition());
+				WriteFloat(buffer, scrolledEvent.GetDelta());
+				break;
+			}
+			default: // INFO: No Payload (Close, Focus, Lost Focus)
+				break;
+		}
+
+		++recordedEventCount;
+
+		if (buffer.size() >= FlushThreshold) { Flush(); }
+	}
+
+	void InputRecorder::Finish(uint64_t frameIndex)
+	{
+		if (!file.is_open()) { return; }
+
+		WriteRecordHeader(std::max(frameIndex, previousFrameIndex), EventType::None);
+		Flush();
+		file.close();
+
+		FLUX_CORE_INFO("Input recording finished, {0} events recorded", recordedEventCount);
+	}
+
+	void InputRecorder::WriteRecordHeader(uint64_t frameIndex, EventType type)
+	{
+		FLUX_CORE_ASSERT(frameIndex >= previousFrameIndex, "Input events must be recorded in frame order!");
+
+		WriteVarint(buffer, frameIndex - previousFrameIndex);
+		buffer.push_back(static_cast<uint8_t>(type));
+		previousFrameIndex = frameIndex;
+	}
+
+	void InputRecorder::Flush()
+	{
+		file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		buffer.clear();
+	}
+#pragma endregion InputRecorder
+
+#pragma region InputRecordingReader
+	InputRecordingReader::InputRecordingReader(const std::filesystem::path& filepath)
+		: readOffset(0), valid(false), nextFrameIndex(0), nextType(EventType::None)
+	{
+		std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+		{
+			FLUX_CORE_ERROR("Failed to open input recording: {0}", filepath.string());
+			return;
+		}
+
+		// INFO: Recordings are Small (a Few Bytes per Event), so Read the Whole File Up Front
+		data.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+		constexpr size_t HeaderSize = sizeof(InputRecordingHeader::Magic) + 2 + 2 + 4 + 4;
+		if (data.size() < HeaderSize || std::memcmp(data.data(), InputRecordingHeader::Magic, sizeof(InputRecordingHeader::Magic)) != 0)
+		{
+			FLUX_CORE_ERROR("File is not a Flux input recording: {0}", filepath.string());
+			return;
+		}
+
+		auto readUInt = [this](size_t offset, int byteCount)
+		{
+			uint64_t value = 0;
+			for (int i = 0; i < byteCount; ++i) { value |= static_cast<uint64_t>(data[offset + i]) << (i * 8); }
+			return value;
+		};
+
+		header.version = static_cast<uint16_t>(readUInt(4, 2));
+		header.windowWidth = static_cast<uint32_t>(readUInt(8, 4));
+		header.windowHeight = static_cast<uint32_t>(readUInt(12, 4));
+
+		if (header.version != InputRecordingHeader::CurrentVersion)
+		{
+			FLUX_CORE_ERROR("Unsupported input recording version {0} (Expected {1}, Record it again): {2}", header.version, InputRecordingHeader::CurrentVersion, filepath.string());
+			return;
+		}
+
+		readOffset = HeaderSize;
+		valid = true;
+
+		ReadRecordHeader();
+	}
+
+	std::optional<RecordedEvent> InputRecordingReader::ReadNext(uint64_t frameIndex)
+	{
+		if (IsFinished() || nextFrameIndex != frameIndex) { return std::nullopt; }
+
+		std::optional<RecordedEvent> event;
+
+		switch (nextType)
+		{
+			case EventType::WindowClose: event.emplace(std::in_place_type<WindowCloseEvent>); break;
+			case EventType::WindowFocus: event.emplace(std::in_place_type<WindowFocusEvent>); break;
+			case EventType::WindowLostFocus: event.emplace(std::in_place_type<WindowLostFocusEvent>); break;
+			case EventType::WindowResize:
+			{
+				unsigned int width = static_cast<unsigned int>(ReadVarint());
+				unsigned int height = static_cast<unsigned int>(ReadVarint());
+				event.emplace(std::in_place_type<WindowResizeEvent>, width, height);
+				break;
+			}
+			case EventType::WindowMoved: event.emplace(std::in_place_type<WindowMovedEvent>, ReadPosition()); break;
+			case EventType::KeyPressed:
+			{
+				int keyCode = static_cast<int>(ReadSignedVarint());
+				int repeatCount = static_cast<int>(ReadVarint());
+				event.emplace(std::in_place_type<KeyPressedEvent>, keyCode, repeatCount);
+				break;
+			}
+			case EventType::KeyReleased: event.emplace(std::in_place_type<KeyReleasedEvent>, static_cast<int>(ReadSignedVarint())); break;
+			case EventType::MouseButtonPressed:
+			{
+				int buttonCode = static_cast<int>(ReadSignedVarint());
+				event.emplace(std::in_place_type<MouseButtonPressedEvent>, buttonCode, ReadPosition());
+				break;
+			}
+			case EventType::MouseButtonReleased:
+			{
+				int buttonCode = static_cast<int>(ReadSignedVarint());
+				event.emplace(std::in_place_type<MouseButtonReleasedEvent>, buttonCode, ReadPosition());
+				break;
+			}
+			case EventType::MouseMoved: event.emplace(std::in_place_type<MouseMovedEvent>, ReadPosition()); break;
+			case EventType::MouseWheelScrolled:
+			{
+				int wheel = static_cast<int>(ReadSignedVarint());
+				Vector2I position = ReadPosition();
+				event.emplace(std::in_place_type<MouseScrolledEvent>, wheel, position, ReadFloat());
+				break;
+			}
+			default:
+				FLUX_CORE_ERROR("Input recording contains an unknown event type ({0}), stopping replay!", static_cast<int>(nextType));
+				valid = false;
+				return std::nullopt;
+		}
+
+		ReadRecordHeader();
+		return event;
+	}
+
+	void InputRecordingReader::ReadRecordHeader()
+	{
+		if (readOffset >= data.size())
+		{
+			// INFO: Truncated Recording (e.g. Crash While Recording), Treat the Last Event's Frame as the End
+			nextType = EventType::None;
+			return;
+		}
+
+		nextFrameIndex += ReadVarint();
+		nextType = readOffset < data.size() ? static_cast<EventType>(data[readOffset++]) : EventType::None;
+	}
+
+	uint64_t InputRecordingReader::ReadVarint()
+	{
+		uint64_t value = 0;
+
+		for (int shift = 0; readOffset < data.size() && shift < 64; shift += 7)
+		{
+			uint8_t byte = data[readOffset++];
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0) { break; }
+		}
+
+		return value;
+	}
+
+	int64_t InputRecordingReader::ReadSignedVarint()
+	{
+		uint64_t value = ReadVarint();
+		return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+	}
+
+	Vector2I InputRecordingReader::ReadPosition()
+	{
+		int x = static_cast<int>(ReadSignedVarint());
+		int y = static_cast<int>(ReadSignedVarint());
+		return Vector2I(x, y);
+	}
+
+	float InputRecordingReader::ReadFloat()
+	{
+		uint32_t bits = 0;
+		for (int i = 0; i < 4 && readOffset < data.size(); ++i) { bits |= static_cast<uint32_t>(data[readOffset++]) << (i * 8); }
+		return std::bit_cast<float>(bits);
+	}
+#pragma endregion InputRecordingReader
+}
\ No newline at end of file
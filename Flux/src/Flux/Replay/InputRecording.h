@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "Flux/Events/ApplicationEvent.h"
+#include "Flux/Events/Event.h"
+#include "Flux/Events/KeyEvent.h"
+#include "Flux/Events/MouseEvent.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Binary input recording layout (little-endian):
+	///		Header: "FLXR", uint16 version, uint16 reserved, uint32 window width, uint32 window height
+	///		Record: varint frames since the previous record, uint8 EventType, event payload (varints, zigzag for signed values)
+	///		End:	a record with EventType::None marking the frame the recording stopped on
+	/// </summary>
+	struct InputRecordingHeader
+	{
+		static constexpr char Magic[4] = { 'F', 'L', 'X', 'R' };
+		static constexpr uint16_t CurrentVersion = 2; // 2: Input is sampled at the start of the frame, version 1 events land a frame early
+
+		uint16_t version = CurrentVersion;
+		uint32_t windowWidth = 0;
+		uint32_t windowHeight = 0;
+	};
+
+	using RecordedEvent = std::variant<WindowCloseEvent, WindowResizeEvent, WindowFocusEvent, WindowLostFocusEvent, WindowMovedEvent,
+									   KeyPressedEvent, KeyReleasedEvent,
+									   MouseButtonPressedEvent, MouseButtonReleasedEvent, MouseMovedEvent, MouseScrolledEvent>;
+
+	/// <summary>
+	/// Writes emitted Flux events and the frame they were emitted on to a compact binary file
+	/// </summary>
+	class InputRecorder
+	{
+	public:
+		InputRecorder(const std::filesystem::path& filepath, unsigned int windowWidth, unsigned int windowHeight);
+		~InputRecorder();
+
+		InputRecorder(const InputRecorder&) = delete;
+		InputRecorder& operator=(const InputRecorder&) = delete;
+
+		void Record(uint64_t frameIndex, const Event& event);
+
+		/// <summary>
+		/// Writes the end marker and closes the file, called automatically on destruction
+		/// </summary>
+		void Finish(uint64_t frameIndex);
+
+		bool IsRecording() const { return file.is_open(); }
+		uint64_t GetRecordedEventCount() const { return recordedEventCount; }
+
+	private:
+		void WriteRecordHeader(uint64_t frameIndex, EventType type);
+		void Flush();
+
+	private:
+		std::ofstream file;
+		std::vector<uint8_t> buffer;
+
+		uint64_t previousFrameIndex;
+		uint64_t recordedEventCount;
+	};
+
+	/// <summary>
+	/// Reads an input recording back one event at a time
+	/// </summary>
+	class InputRecordingReader
+	{
+	public:
+		InputRecordingReader(const std::filesystem::path& filepath);
+
+		bool IsValid() const { return valid; }
+		const InputRecordingHeader& GetHeader() const { return header; }
+
+		/// <summary>
+		/// Frame of the next event, or the frame the recording stopped on once every event was read
+		/// </summary>
+		uint64_t GetNextFrameIndex() const { return nextFrameIndex; }
+		bool IsFinished() const { return !valid || nextType == EventType::None; }
+
+		/// <summary>
+		/// Returns the next event if it was recorded on frameIndex
+		/// </summary>
+		std::optional<RecordedEvent> ReadNext(uint64_t frameIndex);
+
+	private:
+		void ReadRecordHeader();
+
+		uint64_t ReadVarint();
+		int64_t ReadSignedVarint();
+		Vector2I ReadPosition();
+		float ReadFloat();
+
+	private:
+		InputRecordingHeader header;
+		std::vector<uint8_t> data;
+		size_t readOffset;
+		bool valid;
+
+		uint64_t nextFrameIndex;
+		EventType nextType;
+	};
+}
\ No newline at end of file
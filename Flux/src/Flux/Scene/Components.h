@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <box2d/id.h>
+
+#include "Flux/Math/AABB.h"
+#include "Flux/Math/Vector2.h"
+#include "SpatialIndex.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Position in pixels and rotation in degrees (Clockwise), in world space or relative to the parent if it has one (See Scene::SetParent)
+	/// </summary>
+	struct TransformComponent
+	{
+		Vector2F position;
+		float rotation = 0.0f;
+
+		TransformComponent() = default;
+		TransformComponent(const Vector2F& position, float rotation = 0.0f) : position(position), rotation(rotation) {}
+	};
+
+	/// <summary>
+	/// World space bounds, entities with bounds are tracked by the scene's SpatialIndex.
+	/// Change bounds through Scene::SetBounds so the index follows.
+	/// </summary>
+	struct BoundsComponent
+	{
+		AABB bounds;
+		SpatialProxyID proxy = InvalidSpatialProxy; // Managed by the scene
+
+		BoundsComponent() = default;
+		BoundsComponent(const AABB& bounds) : bounds(bounds) {}
+	};
+
+	enum class RigidbodyType
+	{
+		Static,		// Never moves, e.g. level geometry
+		Kinematic,	// Moved by the game through its TransformComponent, pushes dynamic bodies but is not pushed back
+		Dynamic		// Moved by the simulation, its TransformComponent is written back after every step
+	};
+
+	/// <summary>
+	/// Simulates the entity in the scene's PhysicsWorld (See Scene::EnablePhysics), requires a TransformComponent.
+	/// The settings are read when the body is created, change them afterwards through the box2d body.
+	/// Bodies are simulated in world space, so keep rigidbody entities as roots of the transform hierarchy.
+	/// </summary>
+	struct RigidbodyComponent
+	{
+		RigidbodyType type = RigidbodyType::Dynamic;
+
+		float linearDamping = 0.0f;
+		float angularDamping = 0.0f;
+		float gravityScale = 1.0f;
+		bool fixedRotation = false;
+		bool isBullet = false;
+
+		b2BodyId body = b2_nullBodyId; // Managed by the physics world
+
+		RigidbodyComponent() = default;
+		RigidbodyComponent(RigidbodyType type) : type(type) {}
+	};
+
+	enum class ColliderShape
+	{
+		Box,
+		Circle
+	};
+
+	/// <summary>
+	/// Shape attached to the entity's rigidbody, sizes are in pixels (A circle's diameter is size.x)
+	/// </summary>
+	struct ColliderComponent
+	{
+		ColliderShape shape = ColliderShape::Box;
+		Vector2F size = Vector2F(1.0f, 1.0f);
+		Vector2F offset;
+
+		float density = 1.0f;
+		float friction = 0.6f;
+		float restitution = 0.0f;
+		bool isSensor = false;
+
+		b2ShapeId shapeId = b2_nullShapeId; // Managed by the physics world
+
+		ColliderComponent() = default;
+		ColliderComponent(ColliderShape shape, const Vector2F& size) : shape(shape), size(size) {}
+	};
+}
\ No newline at end of file
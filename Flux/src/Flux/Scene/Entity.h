@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <entt/entt.hpp>
+
+#include "Scene.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Lightweight handle pairing an EnTT entity with the scene that owns it, cheap to copy and pass by value
+	/// </summary>
+	class Entity
+	{
+	public:
+		Entity() = default;
+		Entity(entt::entity handle, Scene* scene) : handle(handle), scene(scene) {}
+
+		template<typename T, typename... Args>
+		T& AddComponent(Args&&... args)
+		{
+			FLUX_CORE_ASSERT(!HasComponent<T>(), "Entity already has component!");
+			return scene->GetRegistry().emplace<T>(handle, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		T& GetComponent()
+		{
+			FLUX_CORE_ASSERT(HasComponent<T>(), "Entity does not have component!");
+			return scene->GetRegistry().get<T>(handle);
+		}
+
+		template<typename... T>
+		bool HasComponent() const
+		{
+			return scene->GetRegistry().all_of<T...>(handle);
+		}
+
+		template<typename T>
+		void RemoveComponent()
+		{
+			FLUX_CORE_ASSERT(HasComponent<T>(), "Entity does not have component!");
+			scene->GetRegistry().remove<T>(handle);
+		}
+
+		/// <summary>
+		/// Attaches this entity's transform under parent's, pass an empty Entity to detach it
+		/// </summary>
+		bool SetParent(Entity parent) { return scene->SetParent(handle, parent.handle); }
+		Entity GetParent() const { return Entity(scene->GetParent(handle), scene); }
+
+		bool IsValid() const { return scene != nullptr && scene->GetRegistry().valid(handle); }
+
+		entt::entity GetHandle() const { return handle; }
+		Scene* GetScene() const { return scene; }
+
+		explicit operator bool() const { return handle != entt::null; }
+
+		bool operator==(const Entity& other) const { return handle == other.handle && scene == other.scene; }
+
+	private:
+		entt::entity handle = entt::null;
+		Scene* scene = nullptr;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "FluxPCH.h"
+
+#include "Scene.h"
+
+#include "Components.h"
+#include "Entity.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	Scene::Scene(const std::string& name) : name(name)
+	{
+		registry.on_construct<BoundsComponent>().connect<&Scene::OnBoundsConstruct>(*this);
+		registry.on_destroy<BoundsComponent>().connect<&Scene::OnBoundsDestroy>(*this);
+		registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformDestroy>(*this);
+	}
+
+	Scene::~Scene()
+	{
+		physicsWorld.reset();
+
+		registry.on_construct<BoundsComponent>().disconnect(this);
+		registry.on_destroy<BoundsComponent>().disconnect(this);
+		registry.on_destroy<TransformComponent>().disconnect(this);
+	}
+
+	Entity Scene::CreateEntity()
+	{
+		return Entity(registry.create(), this);
+	}
+
+	void Scene::DestroyEntity(Entity entity)
+	{
+		FLUX_CORE_ASSERT(entity.GetScene() == this, "Entity belongs to a different scene!");
+		registry.destroy(entity.GetHandle());
+	}
+
+	void Scene::Update(Timestep deltaTime)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		updateSystems.Run(registry, deltaTime);
+		spatialIndex.ApplyMoves();
+
+		// INFO: After the Systems (And Any Fixed Steps Before them) so World Transforms are Final for Rendering
+		transformHierarchy.Update();
+	}
+
+	void Scene::FixedUpdate(Timestep fixedTimestep)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		fixedUpdateSystems.Run(registry, fixedTimestep);
+		if (physicsWorld) { physicsWorld->Step(fixedTimestep); }
+
+		spatialIndex.ApplyMoves();
+	}
+
+	void Scene::EnablePhysics(const PhysicsSpecification& specification)
+	{
+		FLUX_CORE_ASSERT(!physicsWorld, "Physics is already enabled for this scene!");
+		physicsWorld = std::make_unique<PhysicsWorld>(*this, specification);
+	}
+
+	void Scene::SetBounds(entt::entity entity, const AABB& bounds)
+	{
+		BoundsComponent& component = registry.get<BoundsComponent>(entity);
+		component.bounds = bounds;
+
+		spatialIndex.RequestMove(component.proxy, bounds);
+	}
+
+	void Scene::SetTransform(entt::entity entity, const TransformComponent& transform)
+	{
+		registry.get<TransformComponent>(entity) = transform;
+
+		if (transformHierarchy.Contains(entity)) { transformHierarchy.SetLocal(entity, transform.position, transform.rotation); }
+	}
+
+	bool Scene::SetParent(entt::entity child, entt::entity parent)
+	{
+		FLUX_CORE_ASSERT(registry.all_of<TransformComponent>(child), "Parented entity requires a TransformComponent!");
+		FLUX_CORE_ASSERT(parent == entt::null || registry.all_of<TransformComponent>(parent), "Parent entity requires a TransformComponent!");
+
+		// INFO: Entities Only Join the Hierarchy Once Parented, the Rest Cost Nothing
+		auto addToHierarchy = [this](entt::entity entity)
+		{
+			if (transformHierarchy.Contains(entity)) { return; }
+
+			const TransformComponent& transform = registry.get<TransformComponent>(entity);
+			transformHierarchy.Add(entity, transform.position, transform.rotation);
+		};
+
+		if (parent == entt::null && !transformHierarchy.Contains(child)) { return true; }
+
+		addToHierarchy(child);
+		if (parent != entt::null) { addToHierarchy(parent); }
+
+		return transformHierarchy.SetParent(child, parent);
+	}
+
+	entt::entity Scene::GetParent(entt::entity entity) const
+	{
+		return transformHierarchy.Contains(entity) ? transformHierarchy.GetParent(entity) : entt::null;
+	}
+
+	Matrix3x3 Scene::GetWorldMatrix(entt::entity entity) const
+	{
+		if (transformHierarchy.Contains(entity)) { return transformHierarchy.GetWorldMatrix(entity); }
+
+		const TransformComponent& transform = registry.get<TransformComponent>(entity);
+		return Matrix3x3::FromTransform(transform.position, transform.rotation);
+	}
+
+	void Scene::OnBoundsConstruct(entt::registry& registry, entt::entity entity)
+	{
+		BoundsComponent& component = registry.get<BoundsComponent>(entity);
+		component.proxy = spatialIndex.CreateProxy(component.bounds, entity);
+	}
+
+	void Scene::OnBoundsDestroy(entt::registry& registry, entt::entity entity)
+	{
+		BoundsComponent& component = registry.get<BoundsComponent>(entity);
+		spatialIndex.DestroyProxy(component.proxy);
+		component.proxy = InvalidSpatialProxy;
+	}
+
+	void Scene::OnTransformDestroy(entt::registry& registry, entt::entity entity)
+	{
+		if (transformHierarchy.Contains(entity)) { transformHierarchy.Remove(entity); }
+	}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <entt/entt.hpp>
+
+#include "Flux/Math/AABB.h"
+#include "Flux/Math/Matrix3x3.h"
+#include "Flux/Physics/PhysicsWorld.h"
+#include "Flux/Time/Timestep.h"
+#include "SpatialIndex.h"
+#include "SystemScheduler.h"
+#include "TransformHierarchy.h"
+
+namespace Flux
+{
+	class Entity;
+	struct TransformComponent;
+
+	enum class SystemPhase
+	{
+		Update,		// Once per frame with the variable frame time
+		FixedUpdate	// At the fixed simulation rate
+	};
+
+	/// <summary>
+	/// Owns the entities and components of a world and the systems that update them
+	/// </summary>
+	class Scene
+	{
+	public:
+		Scene(const std::string& name = "Scene");
+		~Scene();
+
+		Scene(const Scene&) = delete;
+		Scene& operator=(const Scene&) = delete;
+
+		Entity CreateEntity();
+		void DestroyEntity(Entity entity);
+
+		void Update(Timestep deltaTime);
+		void FixedUpdate(Timestep fixedTimestep);
+
+		/// <summary>
+		/// Registers a system, declare its component access on the returned system (e.g. AddSystem(...).Reads&lt;A&gt;().Writes&lt;B&gt;())
+		/// </summary>
+		System& AddSystem(SystemPhase phase, std::string name, SystemFunction function) { return GetScheduler(phase).AddSystem(std::move(name), std::move(function)); }
+		void RemoveSystem(SystemPhase phase, std::string_view name) { GetScheduler(phase).RemoveSystem(name); }
+
+		/// <summary>
+		/// Creates an owning group up front for a hot component set, the owned components are kept packed together so
+		/// systems iterating registry.group&lt;Owned...&gt;() touch contiguous memory. A component can only be owned by one group.
+		/// </summary>
+		template<typename... Owned, typename... Get>
+		void DeclareOwningGroup(entt::get_t<Get...> get = entt::get_t<>())
+		{
+			registry.group<Owned...>(get);
+		}
+
+		/// <summary>
+		/// Updates an entity's BoundsComponent and its place in the spatial index, safe to call from systems running in
+		/// parallel that declared Writes&lt;BoundsComponent&gt;() (Re-insertions are applied once the systems have finished)
+		/// </summary>
+		void SetBounds(entt::entity entity, const AABB& bounds);
+
+		/// <summary>
+		/// Updates an entity's TransformComponent and its node in the transform hierarchy if it has one, safe to call from
+		/// systems running in parallel that declared Writes&lt;TransformComponent&gt;()
+		/// </summary>
+		void SetTransform(entt::entity entity, const TransformComponent& transform);
+
+		/// <summary>
+		/// Attaches child under parent (entt::null detaches it), both need a TransformComponent. A parented entity's
+		/// TransformComponent is relative to its parent, set it through SetTransform so the hierarchy follows.
+		/// Returns false if parent is the child or one of its descendants.
+		/// </summary>
+		bool SetParent(entt::entity child, entt::entity parent);
+		entt::entity GetParent(entt::entity entity) const;
+
+		/// <summary>
+		/// World transform as of the last Update for entities in the hierarchy, otherwise built from the TransformComponent
+		/// </summary>
+		Matrix3x3 GetWorldMatrix(entt::entity entity) const;
+
+		/// <summary>
+		/// Calls callback(entt::entity) for every entity whose bounds may overlap area (e.g. AABB::FromView(camera))
+		/// </summary>
+		template<typename F>
+		void QueryArea(const AABB& area, F&& callback) const { spatialIndex.Query(area, std::forward<F>(callback)); }
+
+		/// <summary>
+		/// Creates the scene's physics world, stepped after the fixed update systems. Entities with a RigidbodyComponent
+		/// get a body, and their TransformComponent (and BoundsComponent) follows the simulation.
+		/// </summary>
+		void EnablePhysics(const PhysicsSpecification& specification = PhysicsSpecification());
+		void DisablePhysics() { physicsWorld.reset(); }
+
+		/// <summary>
+		/// Null until EnablePhysics is called
+		/// </summary>
+		PhysicsWorld* GetPhysicsWorld() { return physicsWorld.get(); }
+		const PhysicsWorld* GetPhysicsWorld() const { return physicsWorld.get(); }
+
+		TransformHierarchy& GetTransformHierarchy() { return transformHierarchy; }
+		const TransformHierarchy& GetTransformHierarchy() const { return transformHierarchy; }
+
+		SpatialIndex& GetSpatialIndex() { return spatialIndex; }
+		const SpatialIndex& GetSpatialIndex() const { return spatialIndex; }
+
+		SystemScheduler& GetScheduler(SystemPhase phase) { return phase == SystemPhase::Update ? updateSystems : fixedUpdateSystems; }
+
+		void SetName(const std::string& name) { this->name = name; }
+		const std::string& GetName() const { return name; }
+		size_t GetEntityCount() const { return registry.storage<entt::entity>()->free_list(); }
+
+		entt::registry& GetRegistry() { return registry; }
+		const entt::registry& GetRegistry() const { return registry; }
+
+	private:
+		void OnBoundsConstruct(entt::registry& registry, entt::entity entity);
+		void OnBoundsDestroy(entt::registry& registry, entt::entity entity);
+		void OnTransformDestroy(entt::registry& registry, entt::entity entity);
+
+	private:
+		std::string name;
+
+		entt::registry registry;
+		SpatialIndex spatialIndex;
+		TransformHierarchy transformHierarchy;
+		std::unique_ptr<PhysicsWorld> physicsWorld;
+
+		SystemScheduler updateSystems;
+		SystemScheduler fixedUpdateSystems;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,795 @@
+#include "FluxPCH.h"
+
+#include "SceneSerializer.h"
+
+#include <cstring>
+#include <format>
+#include <span>
+#include <type_traits>
+
+#include <entt/entt.hpp>
+#include <yaml-cpp/yaml.h>
+
+#include "Components.h"
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Utility/MappedFile.h"
+#include "Scene.h"
+
+namespace YAML
+{
+	template<>
+	struct convert<Flux::Vector2F>
+	{
+		static Node encode(const Flux::Vector2F& vector)
+		{
+			Node node;
+			node.push_back(vector.x);
+			node.push_back(vector.y);
+			node.SetStyle(EmitterStyle::Flow);
+			return node;
+		}
+
+		static bool decode(const Node& node, Flux::Vector2F& vector)
+		{
+			if (!node.IsSequence() || node.size() != 2) { return false; }
+
+			vector = Flux::Vector2F(node[0].as<float>(), node[1].as<float>());
+			return true;
+		}
+	};
+}
+
+namespace Flux
+{
+	namespace
+	{
+#pragma region Binary Layout
+		// INFO: Little-Endian, Every Array Starts on a 16 Byte Boundary so Records can be Read in Place from the Mapping
+		constexpr std::array<char, 4> BinaryMagic = { 'F', 'L', 'X', 'S' };
+		constexpr size_t BinaryAlignment = 16;
+
+		struct BinarySceneHeader
+		{
+			std::array<char, 4> magic;
+			uint32_t version;
+			uint32_t entityCount;
+			uint32_t sectionCount;
+			uint64_t sectionTableOffset;
+			uint64_t nameOffset;
+			uint32_t nameLength;
+			uint32_t reserved;
+		};
+
+		/// <summary>
+		/// One per component type, the entities (Indices into the file's entity list) and records are parallel arrays
+		/// </summary>
+		struct BinarySceneSection
+		{
+			uint32_t componentID;
+			uint32_t recordSize;
+			uint32_t count;
+			uint32_t reserved;
+			uint64_t entityOffset;
+			uint64_t recordOffset;
+		};
+
+		static_assert(sizeof(BinarySceneHeader) == 40 && sizeof(BinarySceneSection) == 32);
+
+		enum class BinaryComponentID : uint32_t
+		{
+			Transform = 1,
+			Bounds,
+			Rigidbody,
+			Collider,
+			Parent			// Not a component, the records are the parents' entity indices (See WriteParentSection)
+		};
+
+		constexpr uint32_t NoParent = ~0u;
+
+		struct RigidbodyRecord
+		{
+			uint32_t type;
+			float linearDamping;
+			float angularDamping;
+			float gravityScale;
+			uint8_t fixedRotation;
+			uint8_t isBullet;
+			uint8_t reserved[2];
+		};
+
+		struct ColliderRecord
+		{
+			uint32_t shape;
+			float size[2];
+			float offset[2];
+			float density;
+			float friction;
+			float restitution;
+			uint8_t isSensor;
+			uint8_t reserved[3];
+		};
+
+		/// <summary>
+		/// Maps a component to its binary record, components that are their own record are copied straight from the mapping
+		/// </summary>
+		template<typename T>
+		struct BinaryComponent;
+
+		template<>
+		struct BinaryComponent<TransformComponent>
+		{
+			using Record = TransformComponent;
+			static constexpr BinaryComponentID ID = BinaryComponentID::Transform;
+
+			static const Record& ToRecord(const TransformComponent& component) { return component; }
+		};
+
+		static_assert(std::is_trivially_copyable_v<TransformComponent> && sizeof(TransformComponent) == 12, "TransformComponent changed, update its record and bump SceneSerializer::BinaryVersion!");
+
+		template<>
+		struct BinaryComponent<BoundsComponent>
+		{
+			using Record = AABB;
+			static constexpr BinaryComponentID ID = BinaryComponentID::Bounds;
+
+			static const Record& ToRecord(const BoundsComponent& component) { return component.bounds; }
+			static BoundsComponent FromRecord(const Record& record) { return BoundsComponent(record); }
+		};
+
+		static_assert(std::is_trivially_copyable_v<AABB> && sizeof(AABB) == 16, "AABB changed, update its record and bump SceneSerializer::BinaryVersion!");
+
+		template<>
+		struct BinaryComponent<RigidbodyComponent>
+		{
+			using Record = RigidbodyRecord;
+			static constexpr BinaryComponentID ID = BinaryComponentID::Rigidbody;
+
+			static Record ToRecord(const RigidbodyComponent& component)
+			{
+				return { static_cast<uint32_t>(component.type), component.linearDamping, component.angularDamping, component.gravityScale,
+						 component.fixedRotation, component.isBullet, {} };
+			}
+
+			static bool IsValid(const Record& record) { return record.type <= static_cast<uint32_t>(RigidbodyType::Dynamic); }
+
+			static RigidbodyComponent FromRecord(const Record& record)
+			{
+				RigidbodyComponent component(static_cast<RigidbodyType>(record.type));
+				component.linearDamping = record.linearDamping;
+				component.angularDamping = record.angularDamping;
+				component.gravityScale = record.gravityScale;
+				component.fixedRotation = record.fixedRotation != 0;
+				component.isBullet = record.isBullet != 0;
+				return component;
+			}
+		};
+
+		template<>
+		struct BinaryComponent<ColliderComponent>
+		{
+			using Record = ColliderRecord;
+			static constexpr BinaryComponentID ID = BinaryComponentID::Collider;
+
+			static Record ToRecord(const ColliderComponent& component)
+			{
+				return { static_cast<uint32_t>(component.shape), { component.size.x, component.size.y }, { component.offset.x, component.offset.y },
+						 component.density, component.friction, component.restitution, component.isSensor, {} };
+			}
+
+			static bool IsValid(const Record& record) { return record.shape <= static_cast<uint32_t>(ColliderShape::Circle); }
+
+			static ColliderComponent FromRecord(const Record& record)
+			{
+				ColliderComponent component(static_cast<ColliderShape>(record.shape), Vector2F(record.size[0], record.size[1]));
+				component.offset = Vector2F(record.offset[0], record.offset[1]);
+				component.density = record.density;
+				component.friction = record.friction;
+				component.restitution = record.restitution;
+				component.isSensor = record.isSensor != 0;
+				return component;
+			}
+		};
+
+		/// <summary>
+		/// Files refer to entities by their position in the registry's entity storage, indexed here by entt::to_entity.
+		/// Returns the entity count.
+		/// </summary>
+		uint32_t GetEntityIndices(entt::registry& registry, std::vector<uint32_t>& entityIndices)
+		{
+			uint32_t entityCount = 0;
+
+			for (const auto [entity] : registry.storage<entt::entity>().each())
+			{
+				const uint32_t entityID = static_cast<uint32_t>(entt::to_entity(entity));
+				if (entityID >= entityIndices.size()) { entityIndices.resize(static_cast<size_t>(entityID) + 1); }
+
+				entityIndices[entityID] = entityCount++;
+			}
+
+			return entityCount;
+		}
+
+		/// <summary>
+		/// Checks parent links (Entity indices, NoParent for roots) before any are restored, both ends need a
+		/// TransformComponent and no entity may end up as its own ancestor
+		/// </summary>
+		bool ValidateParents(std::span<const uint32_t> parents, const std::vector<bool>& hasTransform)
+		{
+			for (size_t i = 0; i < parents.size(); ++i)
+			{
+				if (parents[i] == NoParent) { continue; }
+				if (parents[i] >= parents.size() || !hasTransform[i] || !hasTransform[parents[i]]) { return false; }
+			}
+
+			// INFO: 0 = Unvisited, 1 = On the Chain Being Walked, 2 = Known to Reach a Root
+			std::vector<uint8_t> states(parents.size(), 0);
+
+			for (uint32_t first = 0; first < parents.size(); ++first)
+			{
+				uint32_t node = first;
+				while (node != NoParent && states[node] == 0)
+				{
+					states[node] = 1;
+					node = parents[node];
+				}
+
+				if (node != NoParent && states[node] == 1) { return false; }
+
+				for (node = first; node != NoParent && states[node] == 1; node = parents[node]) { states[node] = 2; }
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Parents the entities in file order, the links must have passed ValidateParents
+		/// </summary>
+		void RestoreParents(Scene& scene, std::span<const uint32_t> parents, const std::vector<entt::entity>& entities)
+		{
+			for (size_t i = 0; i < parents.size(); ++i)
+			{
+				if (parents[i] == NoParent) { continue; }
+
+				const bool isParented = scene.SetParent(entities[i], entities[parents[i]]);
+				FLUX_CORE_ASSERT(isParented, "Validated parent link was rejected by the transform hierarchy!");
+			}
+		}
+
+		/// <summary>
+		/// Grows the buffer by an aligned block and returns the block's offset
+		/// </summary>
+		uint64_t AllocateBlock(std::vector<std::byte>& buffer, size_t size)
+		{
+			const size_t offset = (buffer.size() + BinaryAlignment - 1) & ~(BinaryAlignment - 1);
+			buffer.resize(offset + size);
+			return offset;
+		}
+
+		template<typename T>
+		void WriteSection(entt::registry& registry, const std::vector<uint32_t>& entityIndices, std::vector<std::byte>& buffer, std::vector<BinarySceneSection>& sections)
+		{
+			using Binary = BinaryComponent<T>;
+			using Record = typename Binary::Record;
+
+			const auto& storage = registry.storage<T>();
+			if (storage.empty()) { return; }
+
+			BinarySceneSection section = {};
+			section.componentID = static_cast<uint32_t>(Binary::ID);
+			section.recordSize = sizeof(Record);
+			section.count = static_cast<uint32_t>(storage.size());
+			section.entityOffset = AllocateBlock(buffer, section.count * sizeof(uint32_t));
+			section.recordOffset = AllocateBlock(buffer, section.count * sizeof(Record));
+
+			uint32_t* indices = reinterpret_cast<uint32_t*>(buffer.data() + section.entityOffset);
+			Record* records = reinterpret_cast<Record*>(buffer.data() + section.recordOffset);
+
+			for (const auto [entity, component] : storage.each())
+			{
+				*indices++ = entityIndices[entt::to_entity(entity)];
+				*records++ = Binary::ToRecord(component);
+			}
+
+			sections.push_back(section);
+		}
+
+		/// <summary>
+		/// One record per parented entity, the entities are the children and the records their parents
+		/// </summary>
+		void WriteParentSection(Scene& scene, const std::vector<uint32_t>& entityIndices, std::vector<std::byte>& buffer, std::vector<BinarySceneSection>& sections)
+		{
+			std::vector<uint32_t> children;
+			std::vector<uint32_t> parents;
+
+			for (const auto [entity] : scene.GetRegistry().storage<entt::entity>().each())
+			{
+				const entt::entity parent = scene.GetParent(entity);
+				if (parent == entt::null) { continue; }
+
+				children.push_back(entityIndices[entt::to_entity(entity)]);
+				parents.push_back(entityIndices[entt::to_entity(parent)]);
+			}
+
+			if (children.empty()) { return; }
+
+			BinarySceneSection section = {};
+			section.componentID = static_cast<uint32_t>(BinaryComponentID::Parent);
+			section.recordSize = sizeof(uint32_t);
+			section.count = static_cast<uint32_t>(children.size());
+			section.entityOffset = AllocateBlock(buffer, section.count * sizeof(uint32_t));
+			section.recordOffset = AllocateBlock(buffer, section.count * sizeof(uint32_t));
+
+			std::memcpy(buffer.data() + section.entityOffset, children.data(), section.count * sizeof(uint32_t));
+			std::memcpy(buffer.data() + section.recordOffset, parents.data(), section.count * sizeof(uint32_t));
+
+			sections.push_back(section);
+		}
+
+		bool IsBlockInFile(uint64_t offset, uint64_t count, uint64_t elementSize, size_t alignment, size_t fileSize)
+		{
+			return offset % alignment == 0 && offset <= fileSize && count <= (fileSize - offset) / elementSize;
+		}
+
+		const BinarySceneSection* FindSection(std::span<const BinarySceneSection> sections, BinaryComponentID id)
+		{
+			auto section = std::find_if(sections.begin(), sections.end(), [id](const BinarySceneSection& section) { return section.componentID == static_cast<uint32_t>(id); });
+			return section != sections.end() ? &*section : nullptr;
+		}
+
+		template<typename T>
+		const BinarySceneSection* FindSection(std::span<const BinarySceneSection> sections)
+		{
+			return FindSection(sections, BinaryComponent<T>::ID);
+		}
+
+		/// <summary>
+		/// Checks a section's blocks, entity indices (In range, each at most once) and records without touching the registry
+		/// </summary>
+		template<typename T>
+		bool ValidateSection(const MappedFile& file, std::span<const BinarySceneSection> sections, uint32_t entityCount, std::vector<bool>& hasComponent)
+		{
+			using Binary = BinaryComponent<T>;
+			using Record = typename Binary::Record;
+
+			const BinarySceneSection* section = FindSection<T>(sections);
+			if (!section) { return true; }
+
+			if (section->recordSize != sizeof(Record) ||
+				!IsBlockInFile(section->entityOffset, section->count, sizeof(uint32_t), alignof(uint32_t), file.GetSize()) ||
+				!IsBlockInFile(section->recordOffset, section->count, sizeof(Record), alignof(Record), file.GetSize()))
+			{
+				return false;
+			}
+
+			const uint32_t* indices = reinterpret_cast<const uint32_t*>(file.GetData() + section->entityOffset);
+			const Record* records = reinterpret_cast<const Record*>(file.GetData() + section->recordOffset);
+
+			// INFO: A Repeated Index Would Emplace the Same Component Twice on One Entity
+			hasComponent.assign(entityCount, false);
+			for (uint32_t i = 0; i < section->count; ++i)
+			{
+				if (indices[i] >= entityCount || hasComponent[indices[i]]) { return false; }
+				hasComponent[indices[i]] = true;
+			}
+
+			if constexpr (requires(const Record& record) { Binary::IsValid(record); })
+			{
+				return std::all_of(records, records + section->count, [](const Record& record) { return Binary::IsValid(record); });
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Reads the parent section into one link per entity (NoParent for roots) and checks it like ValidateSection
+		/// </summary>
+		bool ValidateParentSection(const MappedFile& file, std::span<const BinarySceneSection> sections, uint32_t entityCount, const std::vector<bool>& hasTransform, std::vector<uint32_t>& parents)
+		{
+			parents.assign(entityCount, NoParent);
+
+			const BinarySceneSection* section = FindSection(sections, BinaryComponentID::Parent);
+			if (!section) { return true; }
+
+			if (section->recordSize != sizeof(uint32_t) ||
+				!IsBlockInFile(section->entityOffset, section->count, sizeof(uint32_t), alignof(uint32_t), file.GetSize()) ||
+				!IsBlockInFile(section->recordOffset, section->count, sizeof(uint32_t), alignof(uint32_t), file.GetSize()))
+			{
+				return false;
+			}
+
+			const uint32_t* children = reinterpret_cast<const uint32_t*>(file.GetData() + section->entityOffset);
+			const uint32_t* records = reinterpret_cast<const uint32_t*>(file.GetData() + section->recordOffset);
+
+			for (uint32_t i = 0; i < section->count; ++i)
+			{
+				if (children[i] >= entityCount || records[i] >= entityCount || parents[children[i]] != NoParent) { return false; }
+				parents[children[i]] = records[i];
+			}
+
+			return ValidateParents(parents, hasTransform);
+		}
+
+		/// <summary>
+		/// Adds a section's components to the entities, the section must have passed ValidateSection
+		/// </summary>
+		template<typename T>
+		void ReadSection(entt::registry& registry, const MappedFile& file, std::span<const BinarySceneSection> sections, const std::vector<entt::entity>& entities, std::vector<entt::entity>& sectionEntities)
+		{
+			using Binary = BinaryComponent<T>;
+			using Record = typename Binary::Record;
+
+			const BinarySceneSection* section = FindSection<T>(sections);
+			if (!section) { return; }
+
+			const uint32_t* indices = reinterpret_cast<const uint32_t*>(file.GetData() + section->entityOffset);
+			const Record* records = reinterpret_cast<const Record*>(file.GetData() + section->recordOffset);
+
+			sectionEntities.resize(section->count);
+			for (uint32_t i = 0; i < section->count; ++i) { sectionEntities[i] = entities[indices[i]]; }
+
+			// INFO: Components Stored as Themselves are Copied into the Pool in One Go, the Rest are Converted One by One
+			if constexpr (std::is_same_v<Record, T>) { registry.insert<T>(sectionEntities.begin(), sectionEntities.end(), records); }
+			else
+			{
+				auto& storage = registry.storage<T>();
+				storage.reserve(storage.size() + section->count);
+
+				for (uint32_t i = 0; i < section->count; ++i) { registry.emplace<T>(sectionEntities[i], Binary::FromRecord(records[i])); }
+			}
+		}
+#pragma endregion Binary Layout
+
+#pragma region YAML Helpers
+		YAML::Emitter& operator<<(YAML::Emitter& out, const Vector2F& vector)
+		{
+			out << YAML::Flow << YAML::BeginSeq << vector.x << vector.y << YAML::EndSeq;
+			return out;
+		}
+
+		const char* RigidbodyTypeToString(RigidbodyType type)
+		{
+			switch (type)
+			{
+			case RigidbodyType::Static: return "Static";
+			case RigidbodyType::Kinematic: return "Kinematic";
+			case RigidbodyType::Dynamic: return "Dynamic";
+			}
+
+			return "Dynamic";
+		}
+
+		RigidbodyType RigidbodyTypeFromString(const std::string& type)
+		{
+			if (type == "Static") { return RigidbodyType::Static; }
+			if (type == "Kinematic") { return RigidbodyType::Kinematic; }
+			return RigidbodyType::Dynamic;
+		}
+
+		const char* ColliderShapeToString(ColliderShape shape)
+		{
+			return shape == ColliderShape::Circle ? "Circle" : "Box";
+		}
+
+		ColliderShape ColliderShapeFromString(const std::string& shape)
+		{
+			return shape == "Circle" ? ColliderShape::Circle : ColliderShape::Box;
+		}
+#pragma endregion YAML Helpers
+	}
+
+	bool SceneSerializer::SerializeYAML(const std::filesystem::path& filepath) const
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		entt::registry& registry = scene.GetRegistry();
+
+		std::vector<uint32_t> entityIndices;
+		GetEntityIndices(registry, entityIndices);
+
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << YAML::Key << "Scene" << YAML::Value << scene.GetName();
+		out << YAML::Key << "Version" << YAML::Value << YAMLVersion;
+		out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+
+		for (const auto [entity] : registry.storage<entt::entity>().each())
+		{
+			out << YAML::BeginMap;
+
+			if (const TransformComponent* transform = registry.try_get<TransformComponent>(entity))
+			{
+				out << YAML::Key << "TransformComponent" << YAML::Value << YAML::BeginMap;
+				out << YAML::Key << "Position" << YAML::Value << transform->position;
+				out << YAML::Key << "Rotation" << YAML::Value << transform->rotation;
+				out << YAML::EndMap;
+			}
+
+			// INFO: The Parent's Position in the Entities List, the TransformComponent is then Relative to it
+			if (const entt::entity parent = scene.GetParent(entity); parent != entt::null)
+			{
+				out << YAML::Key << "Parent" << YAML::Value << entityIndices[entt::to_entity(parent)];
+			}
+
+			if (const BoundsComponent* bounds = registry.try_get<BoundsComponent>(entity))
+			{
+				out << YAML::Key << "BoundsComponent" << YAML::Value << YAML::BeginMap;
+				out << YAML::Key << "Min" << YAML::Value << bounds->bounds.min;
+				out << YAML::Key << "Max" << YAML::Value << bounds->bounds.max;
+				out << YAML::EndMap;
+			}
+
+			if (const RigidbodyComponent* rigidbody = registry.try_get<RigidbodyComponent>(entity))
+			{
+				out << YAML::Key << "RigidbodyComponent" << YAML::Value << YAML::BeginMap;
+				out << YAML::Key << "Type" << YAML::Value << RigidbodyTypeToString(rigidbody->type);
+				out << YAML::Key << "LinearDamping" << YAML::Value << rigidbody->linearDamping;
+				out << YAML::Key << "AngularDamping" << YAML::Value << rigidbody->angularDamping;
+				out << YAML::Key << "GravityScale" << YAML::Value << rigidbody->gravityScale;
+				out << YAML::Key << "FixedRotation" << YAML::Value << rigidbody->fixedRotation;
+				out << YAML::Key << "IsBullet" << YAML::Value << rigidbody->isBullet;
+				out << YAML::EndMap;
+			}
+
+			if (const ColliderComponent* collider = registry.try_get<ColliderComponent>(entity))
+			{
+				out << YAML::Key << "ColliderComponent" << YAML::Value << YAML::BeginMap;
+				out << YAML::Key << "Shape" << YAML::Value << ColliderShapeToString(collider->shape);
+				out << YAML::Key << "Size" << YAML::Value << collider->size;
+				out << YAML::Key << "Offset" << YAML::Value << collider->offset;
+				out << YAML::Key << "Density" << YAML::Value << collider->density;
+				out << YAML::Key << "Friction" << YAML::Value << collider->friction;
+				out << YAML::Key << "Restitution" << YAML::Value << collider->restitution;
+				out << YAML::Key << "IsSensor" << YAML::Value << collider->isSensor;
+				out << YAML::EndMap;
+			}
+
+			out << YAML::EndMap;
+		}
+
+		out << YAML::EndSeq;
+		out << YAML::EndMap;
+
+		std::ofstream file(filepath, std::ios::trunc);
+		if (!file.is_open())
+		{
+			FLUX_CORE_ERROR("Failed to open scene file for writing: {0}", filepath.string());
+			return false;
+		}
+
+		file << out.c_str();
+		return file.good();
+	}
+
+	bool SceneSerializer::DeserializeYAML(const std::filesystem::path& filepath)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		entt::registry& registry = scene.GetRegistry();
+		std::vector<entt::entity> entities;
+		std::vector<uint32_t> parents;
+
+		// INFO: yaml-cpp Reports Malformed Files and Failed Conversions by Throwing
+		try
+		{
+			const YAML::Node data = YAML::LoadFile(filepath.string());
+
+			const YAML::Node entityNodes = data["Entities"];
+			if (!data["Scene"] || !entityNodes.IsSequence())
+			{
+				FLUX_CORE_ERROR("Not a scene file: {0}", filepath.string());
+				return false;
+			}
+
+			const uint32_t version = data["Version"].as<uint32_t>(YAMLVersion);
+			if (version > YAMLVersion)
+			{
+				FLUX_CORE_ERROR("Scene file {0} is version {1}, this build reads up to version {2}", filepath.string(), version, YAMLVersion);
+				return false;
+			}
+
+			scene.SetName(data["Scene"].as<std::string>());
+
+			entities.resize(entityNodes.size());
+			registry.create(entities.begin(), entities.end());
+			parents.assign(entities.size(), NoParent);
+
+			for (size_t i = 0; i < entities.size(); ++i)
+			{
+				const YAML::Node entityNode = entityNodes[i];
+				const entt::entity entity = entities[i];
+
+				if (const YAML::Node transform = entityNode["TransformComponent"])
+				{
+					registry.emplace<TransformComponent>(entity, transform["Position"].as<Vector2F>(), transform["Rotation"].as<float>(0.0f));
+				}
+
+				if (const YAML::Node parent = entityNode["Parent"]) { parents[i] = parent.as<uint32_t>(); }
+
+				if (const YAML::Node bounds = entityNode["BoundsComponent"])
+				{
+					registry.emplace<BoundsComponent>(entity, AABB(bounds["Min"].as<Vector2F>(), bounds["Max"].as<Vector2F>()));
+				}
+
+				if (const YAML::Node rigidbodyNode = entityNode["RigidbodyComponent"])
+				{
+					RigidbodyComponent rigidbody(RigidbodyTypeFromString(rigidbodyNode["Type"].as<std::string>()));
+					rigidbody.linearDamping = rigidbodyNode["LinearDamping"].as<float>(rigidbody.linearDamping);
+					rigidbody.angularDamping = rigidbodyNode["AngularDamping"].as<float>(rigidbody.angularDamping);
+					rigidbody.gravityScale = rigidbodyNode["GravityScale"].as<float>(rigidbody.gravityScale);
+					rigidbody.fixedRotation = rigidbodyNode["FixedRotation"].as<bool>(rigidbody.fixedRotation);
+					rigidbody.isBullet = rigidbodyNode["IsBullet"].as<bool>(rigidbody.isBullet);
+
+					registry.emplace<RigidbodyComponent>(entity, rigidbody);
+				}
+
+				if (const YAML::Node colliderNode = entityNode["ColliderComponent"])
+				{
+					ColliderComponent collider(ColliderShapeFromString(colliderNode["Shape"].as<std::string>()), colliderNode["Size"].as<Vector2F>());
+					collider.offset = colliderNode["Offset"].as<Vector2F>(collider.offset);
+					collider.density = colliderNode["Density"].as<float>(collider.density);
+					collider.friction = colliderNode["Friction"].as<float>(collider.friction);
+					collider.restitution = colliderNode["Restitution"].as<float>(collider.restitution);
+					collider.isSensor = colliderNode["IsSensor"].as<bool>(collider.isSensor);
+
+					registry.emplace<ColliderComponent>(entity, collider);
+				}
+			}
+		}
+		catch (const YAML::Exception& exception)
+		{
+			FLUX_CORE_ERROR("Failed to load scene file {0}: {1}", filepath.string(), exception.what());
+
+			registry.destroy(entities.begin(), entities.end());
+			return false;
+		}
+
+		// INFO: Links are Restored Once Every Entity has its Components, a Parent may Come After its Children in the File
+		std::vector<bool> hasTransform(entities.size());
+		for (size_t i = 0; i < entities.size(); ++i) { hasTransform[i] = registry.all_of<TransformComponent>(entities[i]); }
+
+		if (!ValidateParents(parents, hasTransform))
+		{
+			FLUX_CORE_ERROR("Scene file has invalid parent links: {0}", filepath.string());
+
+			registry.destroy(entities.begin(), entities.end());
+			return false;
+		}
+
+		RestoreParents(scene, parents, entities);
+		return true;
+	}
+
+	bool SceneSerializer::SerializeBinary(const std::filesystem::path& filepath) const
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		entt::registry& registry = scene.GetRegistry();
+
+		// INFO: Entities are Saved as their Position in this List, Loading Creates Fresh Entities in the Same Order
+		std::vector<uint32_t> entityIndices;
+		const uint32_t entityCount = GetEntityIndices(registry, entityIndices);
+
+		std::vector<std::byte> buffer(sizeof(BinarySceneHeader));
+		std::vector<BinarySceneSection> sections;
+
+		WriteSection<TransformComponent>(registry, entityIndices, buffer, sections);
+		WriteSection<BoundsComponent>(registry, entityIndices, buffer, sections);
+		WriteSection<RigidbodyComponent>(registry, entityIndices, buffer, sections);
+		WriteSection<ColliderComponent>(registry, entityIndices, buffer, sections);
+		WriteParentSection(scene, entityIndices, buffer, sections);
+
+		BinarySceneHeader header = {};
+		header.magic = BinaryMagic;
+		header.version = BinaryVersion;
+		header.entityCount = entityCount;
+		header.sectionCount = static_cast<uint32_t>(sections.size());
+		header.nameLength = static_cast<uint32_t>(scene.GetName().size());
+		header.nameOffset = AllocateBlock(buffer, header.nameLength);
+		std::memcpy(buffer.data() + header.nameOffset, scene.GetName().data(), header.nameLength);
+
+		// INFO: The Section Table Goes Last, its Size was Unknown Until Every Section was Written
+		header.sectionTableOffset = AllocateBlock(buffer, sections.size() * sizeof(BinarySceneSection));
+		std::memcpy(buffer.data() + header.sectionTableOffset, sections.data(), sections.size() * sizeof(BinarySceneSection));
+
+		std::memcpy(buffer.data(), &header, sizeof(header));
+
+		std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			FLUX_CORE_ERROR("Failed to open scene file for writing: {0}", filepath.string());
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		return file.good();
+	}
+
+	bool SceneSerializer::DeserializeBinary(const std::filesystem::path& filepath)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		MappedFile file;
+		if (!file.Open(filepath))
+		{
+			FLUX_CORE_ERROR("Failed to open scene file: {0}", filepath.string());
+			return false;
+		}
+
+		BinarySceneHeader header;
+		if (file.GetSize() < sizeof(header) || std::memcmp(file.GetData(), BinaryMagic.data(), BinaryMagic.size()) != 0)
+		{
+			FLUX_CORE_ERROR("Not a binary scene file: {0}", filepath.string());
+			return false;
+		}
+
+		std::memcpy(&header, file.GetData(), sizeof(header));
+		if (header.version != BinaryVersion)
+		{
+			FLUX_CORE_ERROR("Binary scene file {0} is version {1}, this build reads version {2} (Convert it from YAML again)", filepath.string(), header.version, BinaryVersion);
+			return false;
+		}
+
+		if (!IsBlockInFile(header.sectionTableOffset, header.sectionCount, sizeof(BinarySceneSection), alignof(BinarySceneSection), file.GetSize()) ||
+			!IsBlockInFile(header.nameOffset, header.nameLength, 1, 1, file.GetSize()))
+		{
+			FLUX_CORE_ERROR("Binary scene file is corrupt: {0}", filepath.string());
+			return false;
+		}
+
+		const std::span<const BinarySceneSection> sections(reinterpret_cast<const BinarySceneSection*>(file.GetData() + header.sectionTableOffset), header.sectionCount);
+		for (const BinarySceneSection& section : sections)
+		{
+			if (section.componentID == 0 || section.componentID > static_cast<uint32_t>(BinaryComponentID::Parent))
+			{
+				FLUX_CORE_WARN("Skipping unknown component {0} in scene file: {1}", section.componentID, filepath.string());
+			}
+		}
+
+		// INFO: Everything is Checked Before the First Entity is Created, a Corrupt File Leaves the Scene Untouched
+		std::vector<bool> hasTransform(header.entityCount, false);
+		std::vector<bool> hasComponent;
+		std::vector<uint32_t> parents;
+		const bool isValid = ValidateSection<TransformComponent>(file, sections, header.entityCount, hasTransform) &&
+							 ValidateSection<BoundsComponent>(file, sections, header.entityCount, hasComponent) &&
+							 ValidateSection<RigidbodyComponent>(file, sections, header.entityCount, hasComponent) &&
+							 ValidateSection<ColliderComponent>(file, sections, header.entityCount, hasComponent) &&
+							 ValidateParentSection(file, sections, header.entityCount, hasTransform, parents);
+
+		if (!isValid)
+		{
+			FLUX_CORE_ERROR("Binary scene file is corrupt: {0}", filepath.string());
+			return false;
+		}
+
+		scene.SetName(std::string(reinterpret_cast<const char*>(file.GetData() + header.nameOffset), header.nameLength));
+
+		entt::registry& registry = scene.GetRegistry();
+
+		std::vector<entt::entity> entities(header.entityCount);
+		registry.create(entities.begin(), entities.end());
+
+		// INFO: Fixed Order Regardless of the File's, Rigidbodies Need their Transform and Colliders their Rigidbody
+		std::vector<entt::entity> sectionEntities;
+		ReadSection<TransformComponent>(registry, file, sections, entities, sectionEntities);
+		ReadSection<BoundsComponent>(registry, file, sections, entities, sectionEntities);
+		ReadSection<RigidbodyComponent>(registry, file, sections, entities, sectionEntities);
+		ReadSection<ColliderComponent>(registry, file, sections, entities, sectionEntities);
+
+		RestoreParents(scene, parents, entities);
+		return true;
+	}
+
+	bool SceneSerializer::ConvertYAMLToBinary(const std::filesystem::path& yamlFilepath, const std::filesystem::path& binaryFilepath)
+	{
+		Scene scene;
+		SceneSerializer serializer(scene);
+		return serializer.DeserializeYAML(yamlFilepath) && serializer.SerializeBinary(binaryFilepath);
+	}
+
+	bool SceneSerializer::ConvertBinaryToYAML(const std::filesystem::path& binaryFilepath, const std::filesystem::path& yamlFilepath)
+	{
+		Scene scene;
+		SceneSerializer serializer(scene);
+		return serializer.DeserializeBinary(binaryFilepath) && serializer.SerializeYAML(yamlFilepath);
+	}
+}
\ No newline at end of file
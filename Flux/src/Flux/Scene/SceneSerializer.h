@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <filesystem>
+
+namespace Flux
+{
+	class Scene;
+
+	/// <summary>
+	/// Saves and loads a scene's entities, their data components (Transform, Bounds, Rigidbody and Collider) and their
+	/// parents in the transform hierarchy (Local scales set directly on the hierarchy are not saved).
+	/// YAML is the human readable, editor facing format. The binary format stores each component type as flat arrays
+	/// that are memory mapped and inserted into the registry in bulk, use it for shipping large levels.
+	/// Loading adds the file's entities to the scene alongside any it already has.
+	/// </summary>
+	class SceneSerializer
+	{
+	public:
+		static constexpr uint32_t YAMLVersion = 2;
+		static constexpr uint32_t BinaryVersion = 2; // Bump whenever a binary record's layout changes
+
+		SceneSerializer(Scene& scene) : scene(scene) {}
+
+		bool SerializeYAML(const std::filesystem::path& filepath) const;
+		bool DeserializeYAML(const std::filesystem::path& filepath);
+
+		bool SerializeBinary(const std::filesystem::path& filepath) const;
+		bool DeserializeBinary(const std::filesystem::path& filepath);
+
+		/// <summary>
+		/// Loads one format into a temporary scene and saves it as the other, e.g. to bake editor scenes for shipping
+		/// </summary>
+		static bool ConvertYAMLToBinary(const std::filesystem::path& yamlFilepath, const std::filesystem::path& binaryFilepath);
+		static bool ConvertBinaryToYAML(const std::filesystem::path& binaryFilepath, const std::filesystem::path& yamlFilepath);
+
+	private:
+		Scene& scene;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,331 @@
+#include "FluxPCH.h"
+
+#include "SpatialIndex.h"
+
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	SpatialIndex::SpatialIndex(float fatMargin) : fatMargin(fatMargin)
+	{
+	}
+
+	SpatialProxyID SpatialIndex::CreateProxy(const AABB& bounds, entt::entity entity)
+	{
+		const int32_t proxy = AllocateNode();
+
+		Node& node = nodes[proxy];
+		node.bounds = bounds.Expanded(fatMargin);
+		node.entity = entity;
+		node.height = 0;
+
+		InsertLeaf(proxy);
+		++proxyCount;
+
+		return proxy;
+	}
+
+	void SpatialIndex::DestroyProxy(SpatialProxyID proxy)
+	{
+		FLUX_CORE_ASSERT(proxy >= 0 && proxy < static_cast<int32_t>(nodes.size()) && nodes[proxy].IsLeaf(), "Invalid spatial proxy!");
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		--proxyCount;
+	}
+
+	bool SpatialIndex::MoveProxy(SpatialProxyID proxy, const AABB& bounds)
+	{
+		FLUX_CORE_ASSERT(proxy >= 0 && proxy < static_cast<int32_t>(nodes.size()) && nodes[proxy].IsLeaf(), "Invalid spatial proxy!");
+
+		if (nodes[proxy].bounds.Contains(bounds)) { return false; }
+
+		RemoveLeaf(proxy);
+		nodes[proxy].bounds = bounds.Expanded(fatMargin);
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	void SpatialIndex::RequestMove(SpatialProxyID proxy, const AABB& bounds)
+	{
+		Node& node = nodes[proxy];
+		node.requestedBounds = bounds;
+
+		// INFO: The Tree isn't Restructured until ApplyMoves, so Only Escaping Proxies are Queued (Once)
+		if (node.isMovePending || node.bounds.Contains(bounds)) { return; }
+
+		node.isMovePending = true;
+
+		std::scoped_lock lock(pendingMoveMutex);
+		pendingMoves.push_back(proxy);
+	}
+
+	void SpatialIndex::ApplyMoves()
+	{
+		if (pendingMoves.empty()) { return; }
+
+		FLUX_PROFILE_FUNCTION();
+
+		for (SpatialProxyID proxy : pendingMoves)
+		{
+			// INFO: Skip Proxies Destroyed after Requesting a Move
+			if (!nodes[proxy].isMovePending) { continue; }
+
+			nodes[proxy].isMovePending = false;
+			MoveProxy(proxy, nodes[proxy].requestedBounds);
+		}
+		pendingMoves.clear();
+	}
+
+	void SpatialIndex::Clear()
+	{
+		nodes.clear();
+		root = NullNode;
+		freeList = NullNode;
+		proxyCount = 0;
+		pendingMoves.clear();
+	}
+
+	int32_t SpatialIndex::AllocateNode()
+	{
+		if (freeList == NullNode)
+		{
+			nodes.emplace_back();
+			return static_cast<int32_t>(nodes.size() - 1);
+		}
+
+		const int32_t node = freeList;
+		freeList = nodes[node].parent;
+		nodes[node] = Node();
+		return node;
+	}
+
+	void SpatialIndex::FreeNode(int32_t node)
+	{
+		nodes[node].parent = freeList;
+		nodes[node].height = -1;
+		nodes[node].isMovePending = false;
+		freeList = node;
+	}
+
+	void SpatialIndex::InsertLeaf(int32_t leaf)
+	{
+		if (root == NullNode)
+		{
+			root = leaf;
+			nodes[root].parent = NullNode;
+			return;
+		}
+
+		// INFO: Descend Towards the Sibling that Grows the Total Perimeter the Least
+		const AABB leafBounds = nodes[leaf].bounds;
+		int32_t index = root;
+
+		while (!nodes[index].IsLeaf())
+		{
+			const Node& node = nodes[index];
+
+			const float combinedPerimeter = AABB::Union(node.bounds, leafBounds).GetPerimeter();
+			const float cost = 2.0f * combinedPerimeter;
+			const float inheritanceCost = 2.0f * (combinedPerimeter - node.bounds.GetPerimeter());
+
+			auto descendCost = [this, &leafBounds, inheritanceCost](int32_t child)
+			{
+				const Node& childNode = nodes[child];
+				const float perimeter = AABB::Union(leafBounds, childNode.bounds).GetPerimeter();
+				return (childNode.IsLeaf() ? perimeter : perimeter - childNode.bounds.GetPerimeter()) + inheritanceCost;
+			};
+
+			const float cost1 = descendCost(node.child1);
+			const float cost2 = descendCost(node.child2);
+
+			if (cost < cost1 && cost < cost2) { break; }
+
+			index = cost1 < cost2 ? node.child1 : node.child2;
+		}
+
+		const int32_t sibling = index;
+
+		// INFO: Allocate before Taking References, the Node Pool may Grow
+		const int32_t newParent = AllocateNode();
+		const int32_t oldParent = nodes[sibling].parent;
+
+		Node& parentNode = nodes[newParent];
+		parentNode.parent = oldParent;
+		parentNode.bounds = AABB::Union(leafBounds, nodes[sibling].bounds);
+		parentNode.height = nodes[sibling].height + 1;
+		parentNode.child1 = sibling;
+		parentNode.child2 = leaf;
+
+		if (oldParent != NullNode)
+		{
+			if (nodes[oldParent].child1 == sibling) { nodes[oldParent].child1 = newParent; }
+			else { nodes[oldParent].child2 = newParent; }
+		}
+		else
+		{
+			root = newParent;
+		}
+
+		nodes[sibling].parent = newParent;
+		nodes[leaf].parent = newParent;
+
+		RefitAncestors(nodes[leaf].parent);
+	}
+
+	void SpatialIndex::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == root)
+		{
+			root = NullNode;
+			return;
+		}
+
+		const int32_t parent = nodes[leaf].parent;
+		const int32_t grandParent = nodes[parent].parent;
+		const int32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+		if (grandParent != NullNode)
+		{
+			// INFO: Sibling Takes the Parent's Place
+			if (nodes[grandParent].child1 == parent) { nodes[grandParent].child1 = sibling; }
+			else { nodes[grandParent].child2 = sibling; }
+
+			nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			RefitAncestors(grandParent);
+		}
+		else
+		{
+			root = sibling;
+			nodes[sibling].parent = NullNode;
+			FreeNode(parent);
+		}
+	}
+
+	void SpatialIndex::RefitAncestors(int32_t index)
+	{
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			Node& node = nodes[index];
+			const Node& child1 = nodes[node.child1];
+			const Node& child2 = nodes[node.child2];
+
+			node.height = 1 + std::max(child1.height, child2.height);
+			node.bounds = AABB::Union(child1.bounds, child2.bounds);
+
+			index = node.parent;
+		}
+	}
+
+	int32_t SpatialIndex::Balance(int32_t indexA)
+	{
+		Node& a = nodes[indexA];
+		if (a.IsLeaf() || a.height < 2) { return indexA; }
+
+		const int32_t indexB = a.child1;
+		const int32_t indexC = a.child2;
+		Node& b = nodes[indexB];
+		Node& c = nodes[indexC];
+
+		const int32_t balance = c.height - b.height;
+
+		// INFO: Rotate C Up
+		if (balance > 1)
+		{
+			const int32_t indexF = c.child1;
+			const int32_t indexG = c.child2;
+			Node& f = nodes[indexF];
+			Node& g = nodes[indexG];
+
+			c.child1 = indexA;
+			c.parent = a.parent;
+			a.parent = indexC;
+
+			if (c.parent != NullNode)
+			{
+				if (nodes[c.parent].child1 == indexA) { nodes[c.parent].child1 = indexC; }
+				else { nodes[c.parent].child2 = indexC; }
+			}
+			else
+			{
+				root = indexC;
+			}
+
+			if (f.height > g.height)
+			{
+				c.child2 = indexF;
+				a.child2 = indexG;
+				g.parent = indexA;
+				a.bounds = AABB::Union(b.bounds, g.bounds);
+				c.bounds = AABB::Union(a.bounds, f.bounds);
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			}
+			else
+			{
+				c.child2 = indexG;
+				a.child2 = indexF;
+				f.parent = indexA;
+				a.bounds = AABB::Union(b.bounds, f.bounds);
+				c.bounds = AABB::Union(a.bounds, g.bounds);
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+
+			return indexC;
+		}
+
+		// INFO: Rotate B Up
+		if (balance < -1)
+		{
+			const int32_t indexD = b.child1;
+			const int32_t indexE = b.child2;
+			Node& d = nodes[indexD];
+			Node& e = nodes[indexE];
+
+			b.child1 = indexA;
+			b.parent = a.parent;
+			a.parent = indexB;
+
+			if (b.parent != NullNode)
+			{
+				if (nodes[b.parent].child1 == indexA) { nodes[b.parent].child1 = indexB; }
+				else { nodes[b.parent].child2 = indexB; }
+			}
+			else
+			{
+				root = indexB;
+			}
+
+			if (d.height > e.height)
+			{
+				b.child2 = indexD;
+				a.child1 = indexE;
+				e.parent = indexA;
+				a.bounds = AABB::Union(c.bounds, e.bounds);
+				b.bounds = AABB::Union(a.bounds, d.bounds);
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			}
+			else
+			{
+				b.child2 = indexE;
+				a.child1 = indexD;
+				d.parent = indexA;
+				a.bounds = AABB::Union(c.bounds, d.bounds);
+				b.bounds = AABB::Union(a.bounds, e.bounds);
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+
+			return indexB;
+		}
+
+		return indexA;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "Flux/Logging/Log.h"
+#include "Flux/Math/AABB.h"
+
+namespace Flux
+{
+	using SpatialProxyID = int32_t;
+	static constexpr SpatialProxyID InvalidSpatialProxy = -1;
+
+	/// <summary>
+	/// Dynamic AABB tree (Height Balanced, Surface Area Heuristic Insertion) over entity bounds.
+	/// Leaves store bounds fattened by a margin, so objects only get re-inserted once they leave their fattened bounds.
+	/// Queries cost O(log n + results), independent of how many objects are outside the query area.
+	/// </summary>
+	class SpatialIndex
+	{
+	public:
+		SpatialIndex(float fatMargin = 8.0f);
+
+		SpatialProxyID CreateProxy(const AABB& bounds, entt::entity entity);
+		void DestroyProxy(SpatialProxyID proxy);
+
+		/// <summary>
+		/// Moves the proxy immediately, returns true if it had to be re-inserted (Not Thread-Safe)
+		/// </summary>
+		bool MoveProxy(SpatialProxyID proxy, const AABB& bounds);
+
+		/// <summary>
+		/// Thread-safe alternative to MoveProxy for parallel systems, moves within the fattened bounds cost nothing and the
+		/// rest are queued until ApplyMoves. Must not overlap with ApplyMoves, CreateProxy or DestroyProxy.
+		/// </summary>
+		void RequestMove(SpatialProxyID proxy, const AABB& bounds);
+		void ApplyMoves();
+
+		/// <summary>
+		/// Calls callback(entt::entity) for every proxy whose fattened bounds overlap area, return false from it to stop early
+		/// </summary>
+		template<typename F>
+		void Query(const AABB& area, F&& callback) const;
+
+		const AABB& GetFatBounds(SpatialProxyID proxy) const { return nodes[proxy].bounds; }
+		entt::entity GetEntity(SpatialProxyID proxy) const { return nodes[proxy].entity; }
+
+		size_t GetProxyCount() const { return proxyCount; }
+		int32_t GetHeight() const { return root != NullNode ? nodes[root].height : 0; }
+
+		void Clear();
+
+	private:
+		static constexpr int32_t NullNode = -1;
+		static constexpr size_t MaxQueryDepth = 256;
+
+		struct Node
+		{
+			AABB bounds;
+			entt::entity entity = entt::null;
+
+			int32_t parent = NullNode; // Next free node while on the free list
+			int32_t child1 = NullNode;
+			int32_t child2 = NullNode;
+			int32_t height = 0; // Leaves are 0, free nodes are -1
+
+			// INFO: Latest Bounds Passed to RequestMove, a Proxy is only Written by One Thread at a Time
+			AABB requestedBounds;
+			bool isMovePending = false;
+
+			bool IsLeaf() const { return child1 == NullNode; }
+		};
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t node);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+
+		/// <summary>
+		/// Rotates the subtree rooted at node if its children's heights differ by more than one, returns the new subtree root
+		/// </summary>
+		int32_t Balance(int32_t node);
+
+		/// <summary>
+		/// Refits bounds and heights from node up to the root, balancing on the way
+		/// </summary>
+		void RefitAncestors(int32_t node);
+
+	private:
+		std::vector<Node> nodes;
+		int32_t root = NullNode;
+		int32_t freeList = NullNode;
+		size_t proxyCount = 0;
+
+		float fatMargin;
+
+		std::mutex pendingMoveMutex;
+		std::vector<SpatialProxyID> pendingMoves;
+	};
+
+	template<typename F>
+	inline void SpatialIndex::Query(const AABB& area, F&& callback) const
+	{
+		if (root == NullNode) { return; }
+
+		std::array<int32_t, MaxQueryDepth> stack;
+		size_t stackSize = 0;
+		stack[stackSize++] = root;
+
+		while (stackSize > 0)
+		{
+			const Node& node = nodes[stack[--stackSize]];
+			if (!node.bounds.Overlaps(area)) { continue; }
+
+			if (node.IsLeaf())
+			{
+				if constexpr (std::is_same_v<std::invoke_result_t<F&, entt::entity>, bool>)
+				{
+					if (!callback(node.entity)) { return; }
+				}
+				else
+				{
+					callback(node.entity);
+				}
+			}
+			else
+			{
+				FLUX_CORE_ASSERT(stackSize + 2 <= MaxQueryDepth, "SpatialIndex query stack overflow!");
+				stack[stackSize++] = node.child1;
+				stack[stackSize++] = node.child2;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "FluxPCH.h"
+
+#include "SystemScheduler.h"
+
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	bool System::ConflictsWith(const System& other) const
+	{
+		if (isExclusive || other.isExclusive) { return true; }
+
+		return Overlaps(writes, other.writes) || Overlaps(writes, other.reads) || Overlaps(reads, other.writes);
+	}
+
+	bool System::Overlaps(const std::vector<ComponentAccess>& lhs, const std::vector<ComponentAccess>& rhs)
+	{
+		for (const ComponentAccess& a : lhs)
+		{
+			for (const ComponentAccess& b : rhs)
+			{
+				if (a.id == b.id) { return true; }
+			}
+		}
+		return false;
+	}
+
+	System& SystemScheduler::AddSystem(std::string name, SystemFunction function)
+	{
+		FLUX_CORE_ASSERT(function != nullptr, "System has no function!");
+		FLUX_CORE_ASSERT(GetSystem(name) == nullptr, "A system with this name is already registered!");
+
+		isDirty = true;
+		return systems.emplace_back(std::move(name), std::move(function));
+	}
+
+	void SystemScheduler::RemoveSystem(std::string_view name)
+	{
+		auto it = std::find_if(systems.begin(), systems.end(), [name](const System& system) { return system.name == name; });
+
+		if (it != systems.end())
+		{
+			systems.erase(it);
+			isDirty = true;
+		}
+	}
+
+	System* SystemScheduler::GetSystem(std::string_view name)
+	{
+		auto it = std::find_if(systems.begin(), systems.end(), [name](const System& system) { return system.name == name; });
+		return it != systems.end() ? &(*it) : nullptr;
+	}
+
+	void SystemScheduler::Run(entt::registry& registry, Timestep deltaTime)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		if (isDirty || builtFor != &registry) { Build(registry); }
+
+		for (const std::vector<uint32_t>& wave : waves)
+		{
+			if (!isParallel || wave.size() == 1)
+			{
+				for (uint32_t index : wave) { RunSystem(systems[index], registry, deltaTime); }
+				continue;
+			}
+
+			// INFO: The Calling Thread Takes the First System, then Helps with the Rest while Waiting
+			JobCounter counter;
+			for (size_t i = 1; i < wave.size(); ++i)
+			{
+				System* system = &systems[wave[i]];
+				JobSystem::Run([system, &registry, deltaTime]() { RunSystem(*system, registry, deltaTime); }, &counter);
+			}
+
+			RunSystem(systems[wave[0]], registry, deltaTime);
+			JobSystem::Wait(counter);
+		}
+	}
+
+	void SystemScheduler::Build(entt::registry& registry)
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		// INFO: A System Waits on Every Earlier System it Conflicts with, so its Wave is One Past the Latest of those
+		std::vector<uint32_t> systemWaves(systems.size(), 0);
+		waves.clear();
+
+		for (uint32_t i = 0; i < systems.size(); ++i)
+		{
+			for (uint32_t j = 0; j < i; ++j)
+			{
+				if (systems[i].ConflictsWith(systems[j])) { systemWaves[i] = std::max(systemWaves[i], systemWaves[j] + 1); }
+			}
+
+			if (systemWaves[i] >= waves.size()) { waves.resize(systemWaves[i] + 1); }
+			waves[systemWaves[i]].push_back(i);
+
+			// INFO: Storage is Created Lazily by EnTT, Create it Up Front so Parallel Views Never Modify the Registry
+			for (const System::ComponentAccess& access : systems[i].reads) { access.assureStorage(registry); }
+			for (const System::ComponentAccess& access : systems[i].writes) { access.assureStorage(registry); }
+		}
+
+		builtFor = &registry;
+		isDirty = false;
+	}
+
+	void SystemScheduler::RunSystem(System& system, entt::registry& registry, Timestep deltaTime)
+	{
+		if (!system.enabled) { return; }
+
+		FLUX_PROFILE_SCOPE_DYNAMIC(system.name);
+		system.function(registry, deltaTime);
+	}
+}
\ No newline at end of file
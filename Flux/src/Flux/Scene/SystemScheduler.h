@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "Flux/Time/Timestep.h"
+
+namespace Flux
+{
+	using SystemFunction = std::function<void(entt::registry&, Timestep)>;
+
+	/// <summary>
+	/// A registered system and the components it declares access to, the declarations decide what may run alongside it
+	/// </summary>
+	class System
+	{
+	public:
+		System(std::string name, SystemFunction function) : name(std::move(name)), function(std::move(function)) {}
+
+		/// <summary>
+		/// Components the system only reads, any number of readers may run in parallel
+		/// </summary>
+		template<typename... Components>
+		System& Reads()
+		{
+			(AddAccess<Components>(reads), ...);
+			return *this;
+		}
+
+		/// <summary>
+		/// Components the system writes, a writer never runs alongside another system touching the same component
+		/// </summary>
+		template<typename... Components>
+		System& Writes()
+		{
+			(AddAccess<Components>(writes), ...);
+			return *this;
+		}
+
+		/// <summary>
+		/// Runs the system on its own, required when it creates/destroys entities or adds/removes components
+		/// </summary>
+		System& Exclusive()
+		{
+			isExclusive = true;
+			return *this;
+		}
+
+		const std::string& GetName() const { return name; }
+		bool IsExclusive() const { return isExclusive; }
+
+		bool IsEnabled() const { return enabled; }
+		void SetEnabled(bool enabled) { this->enabled = enabled; }
+
+		/// <summary>
+		/// True if the two systems can't safely run at the same time
+		/// </summary>
+		bool ConflictsWith(const System& other) const;
+
+	private:
+		friend class SystemScheduler;
+
+		struct ComponentAccess
+		{
+			entt::id_type id;
+			void (*assureStorage)(entt::registry&);
+		};
+
+		template<typename Component>
+		static void AddAccess(std::vector<ComponentAccess>& accesses)
+		{
+			using Type = std::remove_const_t<Component>;
+			accesses.push_back({ entt::type_hash<Type>::value(), [](entt::registry& registry) { registry.storage<Type>(); } });
+		}
+
+		static bool Overlaps(const std::vector<ComponentAccess>& lhs, const std::vector<ComponentAccess>& rhs);
+
+	private:
+		std::string name;
+		SystemFunction function;
+
+		std::vector<ComponentAccess> reads;
+		std::vector<ComponentAccess> writes;
+		bool isExclusive = false;
+		bool enabled = true;
+	};
+
+	/// <summary>
+	/// Orders systems into waves from their read/write declarations, systems within a wave don't conflict and run in parallel
+	/// on the JobSystem. Conflicting systems keep their registration order.
+	/// </summary>
+	class SystemScheduler
+	{
+	public:
+		SystemScheduler() = default;
+
+		/// <summary>
+		/// The returned reference stays valid until a system is removed
+		/// </summary>
+		System& AddSystem(std::string name, SystemFunction function);
+		void RemoveSystem(std::string_view name);
+		System* GetSystem(std::string_view name);
+
+		void Run(entt::registry& registry, Timestep deltaTime);
+
+		/// <summary>
+		/// Disabling runs every wave on the calling thread (Useful when debugging a system)
+		/// </summary>
+		void SetParallelEnabled(bool enabled) { isParallel = enabled; }
+		bool IsParallelEnabled() const { return isParallel; }
+
+		size_t GetSystemCount() const { return systems.size(); }
+
+		/// <summary>
+		/// Indices of the systems in each wave, in execution order (Rebuilt on the next Run after systems change)
+		/// </summary>
+		const std::vector<std::vector<uint32_t>>& GetWaves() const { return waves; }
+
+	private:
+		void Build(entt::registry& registry);
+
+		static void RunSystem(System& system, entt::registry& registry, Timestep deltaTime);
+
+	private:
+		std::deque<System> systems;
+		std::vector<std::vector<uint32_t>> waves;
+
+		entt::registry* builtFor = nullptr;
+		bool isDirty = true;
+		bool isParallel = true;
+	};
+}
\ No newline at end of file
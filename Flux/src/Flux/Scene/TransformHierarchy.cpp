@@ -0,0 +1,327 @@
+#include "FluxPCH.h"
+
+#include "TransformHierarchy.h"
+
+#include <algorithm>
+
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	namespace
+	{
+		/// <summary>
+		/// parent * local for 2D affine matrices, skipping the constant bottom row
+		/// </summary>
+		Matrix3x3 MultiplyAffine(const Matrix3x3& parent, const Matrix3x3& local)
+		{
+			return Matrix3x3(parent(0, 0) * local(0, 0) + parent(0, 1) * local(1, 0), parent(0, 0) * local(0, 1) + parent(0, 1) * local(1, 1), parent(0, 0) * local(0, 2) + parent(0, 1) * local(1, 2) + parent(0, 2),
+							 parent(1, 0) * local(0, 0) + parent(1, 1) * local(1, 0), parent(1, 0) * local(0, 1) + parent(1, 1) * local(1, 1), parent(1, 0) * local(0, 2) + parent(1, 1) * local(1, 2) + parent(1, 2),
+							 0.0f, 0.0f, 1.0f);
+		}
+
+		template<typename T>
+		void RotateRange(std::vector<T>& values, uint32_t first, uint32_t middle, uint32_t last)
+		{
+			std::rotate(values.begin() + first, values.begin() + middle, values.begin() + last);
+		}
+	}
+
+	void TransformHierarchy::Add(entt::entity entity, const Vector2F& position, float rotation)
+	{
+		FLUX_CORE_ASSERT(!Contains(entity), "Entity is already in the transform hierarchy!");
+
+		const size_t id = static_cast<size_t>(entt::to_entity(entity));
+		if (id >= entityToNode.size()) { entityToNode.resize(std::max(id + 1, entityToNode.size() * 2), InvalidNode); }
+
+		const uint32_t node = static_cast<uint32_t>(entities.size());
+		entityToNode[id] = node;
+
+		entities.push_back(entity);
+		parents.push_back(InvalidNode);
+		subtreeSizes.push_back(1);
+		localPositions.push_back(position);
+		localRotations.push_back(rotation);
+		localScales.emplace_back(1.0f, 1.0f);
+		localMatrices.emplace_back();
+		worldMatrices.emplace_back();
+		dirtyFlags.push_back(LocalDirty);
+
+		rootStarts.push_back(node);
+	}
+
+	void TransformHierarchy::Remove(entt::entity entity)
+	{
+		const uint32_t node = GetNode(entity);
+		FLUX_CORE_ASSERT(node != InvalidNode, "Entity is not in the transform hierarchy!");
+		if (node == InvalidNode) { return; }
+
+		// INFO: The Node Stays as a Gap Until the Next Update Compacts, so Removing Many Nodes Costs One Pass rather than One Each
+		const uint32_t subtreeEnd = node + subtreeSizes[node];
+		for (uint32_t child = node + 1; child < subtreeEnd; ++child)
+		{
+			if (parents[child] == node)
+			{
+				parents[child] = parents[node];
+				dirtyFlags[child] |= WorldDirty;
+			}
+		}
+
+		// INFO: Children of a Removed Root Become Roots
+		if (parents[node] == InvalidNode) { isStructureDirty = true; }
+
+		entityToNode[static_cast<size_t>(entt::to_entity(entity))] = InvalidNode;
+		entities[node] = entt::null;
+		dirtyFlags[node] = 0;
+		++removedCount;
+	}
+
+	bool TransformHierarchy::SetParent(entt::entity entity, entt::entity parent)
+	{
+		const uint32_t node = GetNode(entity);
+		FLUX_CORE_ASSERT(node != InvalidNode, "Entity is not in the transform hierarchy!");
+
+		const uint32_t parentNode = parent != entt::null ? GetNode(parent) : InvalidNode;
+		FLUX_CORE_ASSERT(parent == entt::null || parentNode != InvalidNode, "Parent is not in the transform hierarchy!");
+
+		if (node == InvalidNode || (parent != entt::null && parentNode == InvalidNode)) { return false; }
+		if (parents[node] == parentNode) { return true; }
+
+		const uint32_t size = subtreeSizes[node];
+		if (parentNode != InvalidNode && parentNode >= node && parentNode < node + size)
+		{
+			FLUX_CORE_ERROR("Can't parent an entity to itself or one of its descendants!");
+			return false;
+		}
+
+		// INFO: Appended After the New Parent's Last Descendant (Or After Everything, as a Root)
+		const uint32_t destination = parentNode != InvalidNode ? parentNode + subtreeSizes[parentNode] : static_cast<uint32_t>(entities.size());
+
+		// INFO: Rotating the Subtree into Place Shifts Everything Between its Old and New Position, Parent Indices are Fixed Up After
+		uint32_t first = 0, middle = 0, last = 0;
+		uint32_t newNode = 0;
+
+		if (destination > node)
+		{
+			first = node;
+			middle = node + size;
+			last = destination;
+			newNode = destination - size;
+		}
+		else
+		{
+			first = destination;
+			middle = node;
+			last = node + size;
+			newNode = destination;
+		}
+
+		auto remap = [first, middle, last](uint32_t index)
+		{
+			if (index < first || index >= last) { return index; }
+			return index < middle ? index + (last - middle) : index - (middle - first);
+		};
+
+		// INFO: Nodes Past the Range can Still be Children of Nodes Inside it (e.g. an Ancestor of the New Parent), so their
+		// Parent Indices Need Fixing Too. Removed Nodes are Skipped, their Sizes Aren't Maintained.
+		uint32_t remapEnd = last;
+		for (uint32_t i = first; i < last; ++i)
+		{
+			if (entities[i] != entt::null) { remapEnd = std::max(remapEnd, i + subtreeSizes[i]); }
+		}
+
+		for (uint32_t ancestor = parents[node]; ancestor != InvalidNode; ancestor = parents[ancestor]) { subtreeSizes[ancestor] -= size; }
+
+		RotateRange(entities, first, middle, last);
+		RotateRange(parents, first, middle, last);
+		RotateRange(subtreeSizes, first, middle, last);
+		RotateRange(localPositions, first, middle, last);
+		RotateRange(localRotations, first, middle, last);
+		RotateRange(localScales, first, middle, last);
+		RotateRange(localMatrices, first, middle, last);
+		RotateRange(worldMatrices, first, middle, last);
+		RotateRange(dirtyFlags, first, middle, last);
+
+		for (uint32_t i = first; i < last; ++i)
+		{
+			if (entities[i] != entt::null) { entityToNode[static_cast<size_t>(entt::to_entity(entities[i]))] = i; }
+		}
+
+		for (uint32_t i = first; i < remapEnd; ++i)
+		{
+			if (parents[i] != InvalidNode) { parents[i] = remap(parents[i]); }
+		}
+
+		parents[newNode] = parentNode != InvalidNode ? remap(parentNode) : InvalidNode;
+
+		for (uint32_t ancestor = parents[newNode]; ancestor != InvalidNode; ancestor = parents[ancestor]) { subtreeSizes[ancestor] += size; }
+
+		dirtyFlags[newNode] |= WorldDirty;
+		isStructureDirty = true;
+
+		return true;
+	}
+
+	entt::entity TransformHierarchy::GetParent(entt::entity entity) const
+	{
+		const uint32_t node = GetNode(entity);
+		FLUX_CORE_ASSERT(node != InvalidNode, "Entity is not in the transform hierarchy!");
+
+		return node != InvalidNode && parents[node] != InvalidNode ? entities[parents[node]] : entt::null;
+	}
+
+	void TransformHierarchy::SetLocal(entt::entity entity, const Vector2F& position, float rotation)
+	{
+		const uint32_t node = GetNode(entity);
+		FLUX_CORE_ASSERT(node != InvalidNode, "Entity is not in the transform hierarchy!");
+
+		localPositions[node] = position;
+		localRotations[node] = rotation;
+		dirtyFlags[node] |= LocalDirty;
+	}
+
+	void TransformHierarchy::SetLocalScale(entt::entity entity, const Vector2F& scale)
+	{
+		const uint32_t node = GetNode(entity);
+		FLUX_CORE_ASSERT(node != InvalidNode, "Entity is not in the transform hierarchy!");
+
+		localScales[node] = scale;
+		dirtyFlags[node] |= LocalDirty;
+	}
+
+	const Matrix3x3& TransformHierarchy::GetWorldMatrix(entt::entity entity) const
+	{
+		const uint32_t node = GetNode(entity);
+		FLUX_CORE_ASSERT(node != InvalidNode, "Entity is not in the transform hierarchy!");
+
+		return worldMatrices[node];
+	}
+
+	void TransformHierarchy::Update()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		if (removedCount > 0) { Compact(); }
+		if (isStructureDirty) { RebuildRootStarts(); }
+
+		const uint32_t nodeCount = static_cast<uint32_t>(entities.size());
+
+		// INFO: Batches Split by Node Count, then Snapped to Root Boundaries so No Tree is Shared Between Jobs
+		JobSystem::ParallelFor(nodeCount, [this, nodeCount](uint32_t begin, uint32_t end)
+		{
+			auto snapToRoot = [this, nodeCount](uint32_t node)
+			{
+				auto it = std::lower_bound(rootStarts.begin(), rootStarts.end(), node);
+				return it != rootStarts.end() ? *it : nodeCount;
+			};
+
+			UpdateRange(snapToRoot(begin), snapToRoot(end));
+		}, MinNodesPerJob);
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		entities.clear();
+		parents.clear();
+		subtreeSizes.clear();
+		localPositions.clear();
+		localRotations.clear();
+		localScales.clear();
+		localMatrices.clear();
+		worldMatrices.clear();
+		dirtyFlags.clear();
+
+		entityToNode.clear();
+		rootStarts.clear();
+
+		removedCount = 0;
+		isStructureDirty = false;
+	}
+
+	void TransformHierarchy::UpdateRange(uint32_t begin, uint32_t end)
+	{
+		uint32_t node = begin;
+
+		while (node < end)
+		{
+			// INFO: Clean Nodes Cost a Byte Read, a Dirty One Recomputes its Whole Subtree and Skips Past it
+			if (dirtyFlags[node] == 0)
+			{
+				++node;
+				continue;
+			}
+
+			const uint32_t subtreeEnd = node + subtreeSizes[node];
+			for (uint32_t i = node; i < subtreeEnd; ++i)
+			{
+				if (entities[i] == entt::null) { continue; }
+
+				if (dirtyFlags[i] & LocalDirty) { localMatrices[i] = Matrix3x3::FromTransform(localPositions[i], localRotations[i], localScales[i]); }
+				dirtyFlags[i] = 0;
+
+				const uint32_t parent = parents[i];
+				worldMatrices[i] = parent != InvalidNode ? MultiplyAffine(worldMatrices[parent], localMatrices[i]) : localMatrices[i];
+			}
+
+			node = subtreeEnd;
+		}
+	}
+
+	void TransformHierarchy::Compact()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		const uint32_t nodeCount = static_cast<uint32_t>(entities.size());
+
+		// INFO: removedBefore[i] Counts the Removed Nodes in [0, i), so a Subtree Loses the Removed Nodes Within its Range
+		std::vector<uint32_t> removedBefore(nodeCount + 1, 0);
+		for (uint32_t i = 0; i < nodeCount; ++i) { removedBefore[i + 1] = removedBefore[i] + (entities[i] == entt::null ? 1 : 0); }
+
+		uint32_t write = 0;
+		for (uint32_t read = 0; read < nodeCount; ++read)
+		{
+			if (entities[read] == entt::null) { continue; }
+
+			const uint32_t parent = parents[read];
+
+			entities[write] = entities[read];
+			parents[write] = parent != InvalidNode ? parent - removedBefore[parent] : InvalidNode;
+			subtreeSizes[write] = subtreeSizes[read] - (removedBefore[read + subtreeSizes[read]] - removedBefore[read]);
+			localPositions[write] = localPositions[read];
+			localRotations[write] = localRotations[read];
+			localScales[write] = localScales[read];
+			localMatrices[write] = localMatrices[read];
+			worldMatrices[write] = worldMatrices[read];
+			dirtyFlags[write] = dirtyFlags[read];
+
+			entityToNode[static_cast<size_t>(entt::to_entity(entities[write]))] = write;
+			++write;
+		}
+
+		entities.resize(write);
+		parents.resize(write);
+		subtreeSizes.resize(write);
+		localPositions.resize(write);
+		localRotations.resize(write);
+		localScales.resize(write);
+		localMatrices.resize(write);
+		worldMatrices.resize(write);
+		dirtyFlags.resize(write);
+
+		removedCount = 0;
+		isStructureDirty = true;
+	}
+
+	void TransformHierarchy::RebuildRootStarts()
+	{
+		rootStarts.clear();
+
+		for (uint32_t node = 0; node < entities.size(); node += subtreeSizes[node])
+		{
+			rootStarts.push_back(node);
+		}
+
+		isStructureDirty = false;
+	}
+}
\ No newline at end of file
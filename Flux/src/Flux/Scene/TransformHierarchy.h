@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "Flux/Math/Matrix3x3.h"
+#include "Flux/Math/Vector2.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Parent/child transforms stored depth first in contiguous arrays, so every subtree (and every root's whole tree) is one
+	/// contiguous range with parents before their children. Update recomputes world matrices for dirty subtrees only, in one
+	/// linear pass that splits independent root trees across the JobSystem.
+	/// </summary>
+	class TransformHierarchy
+	{
+	public:
+		TransformHierarchy() = default;
+
+		TransformHierarchy(const TransformHierarchy&) = delete;
+		TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+		/// <summary>
+		/// Adds the entity as a root (Not Thread-Safe)
+		/// </summary>
+		void Add(entt::entity entity, const Vector2F& position, float rotation);
+
+		/// <summary>
+		/// Children of a removed node are attached to its parent, keeping their local transforms (Not Thread-Safe)
+		/// </summary>
+		void Remove(entt::entity entity);
+
+		bool Contains(entt::entity entity) const { return GetNode(entity) != InvalidNode; }
+
+		/// <summary>
+		/// Moves the entity's subtree under parent as its last child, entt::null makes it a root. Shifts every node between the
+		/// old and new position, so it is cheapest within a tree. Returns false if parent is the entity or one of its descendants (Not Thread-Safe)
+		/// </summary>
+		bool SetParent(entt::entity entity, entt::entity parent);
+		entt::entity GetParent(entt::entity entity) const;
+
+		/// <summary>
+		/// Sets the transform relative to the parent and marks the subtree dirty.
+		/// Safe to call from parallel systems as long as each entity is only set by one of them.
+		/// </summary>
+		void SetLocal(entt::entity entity, const Vector2F& position, float rotation);
+		void SetLocalScale(entt::entity entity, const Vector2F& scale);
+
+		/// <summary>
+		/// As of the last Update
+		/// </summary>
+		const Matrix3x3& GetWorldMatrix(entt::entity entity) const;
+
+		/// <summary>
+		/// Recomputes the world matrices of every dirty subtree
+		/// </summary>
+		void Update();
+
+		size_t GetNodeCount() const { return entities.size() - removedCount; }
+		size_t GetRootCount() const { return rootStarts.size(); }
+
+		void Clear();
+
+	private:
+		static constexpr uint32_t InvalidNode = ~0u;
+		static constexpr uint32_t MinNodesPerJob = 4096;
+
+		static constexpr uint8_t LocalDirty = BIT(0);	// Local matrix needs rebuilding (And so does the subtree's world)
+		static constexpr uint8_t WorldDirty = BIT(1);	// Only the subtree's world needs rebuilding (e.g. Reparented)
+
+		uint32_t GetNode(entt::entity entity) const
+		{
+			const size_t id = static_cast<size_t>(entt::to_entity(entity));
+			return id < entityToNode.size() ? entityToNode[id] : InvalidNode;
+		}
+
+		/// <summary>
+		/// Recomputes the dirty subtrees in [begin, end), which must start and end on root tree boundaries
+		/// </summary>
+		void UpdateRange(uint32_t begin, uint32_t end);
+
+		/// <summary>
+		/// Drops removed nodes, keeping the depth first order
+		/// </summary>
+		void Compact();
+
+		void RebuildRootStarts();
+
+	private:
+		// INFO: Structure of Arrays Indexed by Node, in Depth First Order
+		std::vector<entt::entity> entities;		// entt::null for removed nodes until the next Compact
+		std::vector<uint32_t> parents;			// InvalidNode for roots
+		std::vector<uint32_t> subtreeSizes;		// Including the node itself, its subtree is [node, node + size)
+		std::vector<Vector2F> localPositions;
+		std::vector<float> localRotations;
+		std::vector<Vector2F> localScales;
+		std::vector<Matrix3x3> localMatrices;	// Cached, only rebuilt for nodes whose local transform changed
+		std::vector<Matrix3x3> worldMatrices;
+		std::vector<uint8_t> dirtyFlags;		// Bytes rather than bits so parallel SetLocal calls don't share words
+
+		std::vector<uint32_t> entityToNode;		// Indexed by entt::to_entity
+		std::vector<uint32_t> rootStarts;		// Node index of every root, ascending
+
+		size_t removedCount = 0;
+		bool isStructureDirty = false;			// Root starts need rebuilding
+	};
+}
\ No newline at end of file
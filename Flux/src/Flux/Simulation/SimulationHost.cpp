@@ -0,0 +1,117 @@
+#include "FluxPCH.h"
+
+#include "SimulationHost.h"
+
+#include "Flux/Jobs/JobSystem.h"
+#include "Flux/Memory/Memory.h"
+#include "Flux/Profiling/Profiler.h"
+#include "Flux/Time/FramePacer.h"
+
+#include <chrono>
+
+namespace Flux
+{
+	SimulationHostSpecification SimulationHostSpecification::FromCommandLine(const ApplicationCommandLineArgs& args)
+	{
+		SimulationHostSpecification specification;
+		specification.tickRate = ApplicationSpecification::FromCommandLine(args).tickRate;
+
+		args.GetNumberOption("--threads", specification.workerThreadCount, 1);
+
+		return specification;
+	}
+
+	SimulationHost::SimulationHost(const SimulationHostSpecification& specification) : specification(specification), isRunning(false)
+	{
+		// INFO: Started Before any Instance, so the Host's Worker Count is the One Used
+		JobSystem::Initialise(specification.workerThreadCount);
+		Memory::Initialise();
+	}
+
+	SimulationHost::~SimulationHost()
+	{
+		instances.clear();
+
+		Memory::Shutdown();
+		JobSystem::Shutdown();
+	}
+
+	Application& SimulationHost::AddInstance(std::unique_ptr<Application> application)
+	{
+		FLUX_CORE_ASSERT(application != nullptr, "Simulation host was given a null application!");
+		FLUX_CORE_ASSERT(application->IsHeadless(), "Simulation host instances must be headless!");
+
+		instances.push_back(std::move(application));
+		return *instances.back();
+	}
+
+	void SimulationHost::Run()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		FLUX_CORE_INFO("Simulation host running {0} instances on {1} threads", instances.size(), JobSystem::GetThreadCount());
+
+		// INFO: Sleep Only, a Spinning Host Thread Would Take a Core from the Instances
+		FramePacer pacer(specification.tickRate);
+		pacer.SetSpinWaitEnabled(false);
+
+		isRunning.store(true, std::memory_order_relaxed);
+
+		while (isRunning.load(std::memory_order_relaxed) && GetRunningInstanceCount() > 0)
+		{
+			pacer.Wait();
+			Step();
+		}
+	}
+
+	void SimulationHost::Step()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		const std::chrono::steady_clock::time_point stepStart = std::chrono::steady_clock::now();
+
+		JobSystem::ParallelFor(static_cast<uint32_t>(instances.size()), [this](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				if (instances[i]->IsRunning()) { instances[i]->Tick(); }
+			}
+		}, specification.minInstancesPerJob);
+
+		stepStats.Record(std::chrono::duration<double>(std::chrono::steady_clock::now() - stepStart).count());
+
+		FLUX_PROFILE_END_FRAME();
+	}
+
+	size_t SimulationHost::GetRunningInstanceCount() const
+	{
+		return std::count_if(instances.begin(), instances.end(), [](const std::unique_ptr<Application>& instance) { return instance->IsRunning(); });
+	}
+
+	void SimulationHost::LogTickStats() const
+	{
+		if (stepStats.GetTickCount() == 0) { return; }
+
+		uint64_t instanceTickCount = 0;
+		const Application* slowestInstance = nullptr;
+
+		for (const std::unique_ptr<Application>& instance : instances)
+		{
+			instanceTickCount += instance->GetTickStats().GetTickCount();
+
+			if (slowestInstance == nullptr || instance->GetTickStats().GetMeanTickTime() > slowestInstance->GetTickStats().GetMeanTickTime()) { slowestInstance = instance.get(); }
+		}
+
+		// INFO: Throughput is Measured over Time Spent Stepping, so Pacing Sleeps don't Count Against it
+		const double instanceTicksPerSecond = static_cast<double>(instanceTickCount) / stepStats.GetTotalTickTime();
+
+		FLUX_CORE_INFO("Simulation host: {0} steps, mean {1:.3f} ms, max {2:.3f} ms", stepStats.GetTickCount(), stepStats.GetMeanTickTime() * 1000.0, stepStats.GetMaxTickTime() * 1000.0);
+		FLUX_CORE_INFO("Simulation host: {0:.0f} instance ticks per second, {1:.0f} per thread", instanceTicksPerSecond, instanceTicksPerSecond / JobSystem::GetThreadCount());
+
+		if (slowestInstance != nullptr)
+		{
+			const TickStats& slowestStats = slowestInstance->GetTickStats();
+			FLUX_CORE_INFO("Simulation host: slowest instance mean {0:.3f} ms, max {1:.3f} ms", slowestStats.GetMeanTickTime() * 1000.0, slowestStats.GetMaxTickTime() * 1000.0);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Flux/Application.h"
+#include "Flux/Time/TickStats.h"
+
+namespace Flux
+{
+	struct SimulationHostSpecification
+	{
+		unsigned int tickRate = 60;		// Host steps per second of wall time (0 = Uncapped)
+		uint32_t workerThreadCount = 0; // Used if the host is the first to start the JobSystem (0 = one worker per hardware thread minus the caller)
+		uint32_t minInstancesPerJob = 1;
+
+		/// <summary>
+		/// Supports --tick-rate <rate> and --threads <count>
+		/// </summary>
+		static SimulationHostSpecification FromCommandLine(const ApplicationCommandLineArgs& args);
+	};
+
+	/// <summary>
+	/// Runs many independent headless applications (e.g. server side matches) in one process. Every step ticks each
+	/// running instance once, with the instances sharded across the JobSystem, so an instance may tick on a different
+	/// thread each step but never on two at once.
+	/// </summary>
+	class SimulationHost
+	{
+	public:
+		SimulationHost(const SimulationHostSpecification& specification = SimulationHostSpecification());
+		~SimulationHost();
+
+		SimulationHost(const SimulationHost&) = delete;
+		SimulationHost& operator=(const SimulationHost&) = delete;
+
+		/// <summary>
+		/// Takes ownership of a headless application, not thread-safe with Step
+		/// </summary>
+		Application& AddInstance(std::unique_ptr<Application> application);
+
+		/// <summary>
+		/// Steps at the tick rate until every instance has closed or Stop is called
+		/// </summary>
+		void Run();
+
+		/// <summary>
+		/// Ticks every running instance once across the JobSystem and returns once they have all finished
+		/// </summary>
+		void Step();
+
+		/// <summary>
+		/// Ends Run after the current step, safe from any thread
+		/// </summary>
+		void Stop() { isRunning.store(false, std::memory_order_relaxed); }
+
+		size_t GetInstanceCount() const { return instances.size(); }
+		size_t GetRunningInstanceCount() const;
+		Application& GetInstance(size_t index) { return *instances[index]; }
+
+		/// <summary>
+		/// Wall time of whole steps, every instance's own tick time is in its Application::GetTickStats
+		/// </summary>
+		const TickStats& GetStepStats() const { return stepStats; }
+
+		/// <summary>
+		/// Logs the step times, instance tick throughput per thread and the slowest instance
+		/// </summary>
+		void LogTickStats() const;
+
+	private:
+		SimulationHostSpecification specification;
+
+		std::vector<std::unique_ptr<Application>> instances;
+		std::atomic<bool> isRunning;
+
+		TickStats stepStats;
+	};
+}
\ No newline at end of file
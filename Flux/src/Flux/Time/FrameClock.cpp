@@ -0,0 +1,82 @@
+#include "FluxPCH.h"
+
+#include "FrameClock.h"
+
+#include <cmath>
+
+namespace Flux
+{
+	FrameClock::FrameClock(float fixedTimestep, float maxFrameTime, unsigned int maxFixedStepsPerFrame)
+		: previousTime(Clock::now()), deltaTime(0.0f), accumulator(0.0), fixedTimestep(fixedTimestep), maxFrameTime(maxFrameTime),
+		  maxFixedStepsPerFrame(maxFixedStepsPerFrame), fixedStepsThisFrame(0), frameCount(0), fixedStepCount(0)
+	{
+		FLUX_CORE_ASSERT(fixedTimestep > 0.0f, "Fixed timestep must be greater than zero!");
+	}
+
+	void FrameClock::Reset()
+	{
+		previousTime = Clock::now();
+		deltaTime = 0.0f;
+		accumulator = 0.0;
+		fixedStepsThisFrame = 0;
+	}
+
+	Timestep FrameClock::Tick()
+	{
+		Clock::time_point currentTime = Clock::now();
+		std::chrono::duration<float> elapsed = currentTime - previousTime;
+
+		// INFO: Clamp Long Frames (Breakpoints, Window Dragging, etc.) so the Simulation doesn't Spiral Trying to Catch Up
+		Advance(std::min(elapsed.count(), maxFrameTime));
+		previousTime = currentTime;
+
+		return deltaTime;
+	}
+
+	Timestep FrameClock::Advance(float seconds)
+	{
+		previousTime = Clock::now();
+
+		deltaTime = seconds;
+		accumulator += deltaTime;
+		fixedStepsThisFrame = 0;
+		++frameCount;
+
+		return deltaTime;
+	}
+
+	bool FrameClock::StepFixed()
+	{
+		if (accumulator < fixedTimestep) { return false; }
+
+		// INFO: Spiral of Death Guard, Drop the Whole Steps we can't Afford this Frame and Keep the Remainder for Interpolation
+		if (fixedStepsThisFrame >= maxFixedStepsPerFrame)
+		{
+			accumulator = std::fmod(accumulator, static_cast<double>(fixedTimestep));
+			return false;
+		}
+
+		accumulator -= fixedTimestep;
+		++fixedStepsThisFrame;
+		++fixedStepCount;
+		return true;
+	}
+
+	void FrameClock::SetFixedTimestep(float seconds)
+	{
+		FLUX_CORE_ASSERT(seconds > 0.0f, "Fixed timestep must be greater than zero!");
+		fixedTimestep = seconds;
+	}
+
+	void FrameClock::SetMaxFrameTime(float seconds)
+	{
+		FLUX_CORE_ASSERT(seconds > 0.0f, "Max frame time must be greater than zero!");
+		maxFrameTime = seconds;
+	}
+
+	void FrameClock::SetMaxFixedStepsPerFrame(unsigned int steps)
+	{
+		FLUX_CORE_ASSERT(steps > 0, "Max fixed steps per frame must be greater than zero!");
+		maxFixedStepsPerFrame = steps;
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <chrono>
+#include <cstdint>
+
+#include "Timestep.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Measures frame time and accumulates it into fixed rate simulation steps
+	/// </summary>
+	class FrameClock
+	{
+	public:
+		FrameClock(float fixedTimestep = 1.0f / 60.0f, float maxFrameTime = 0.25f, unsigned int maxFixedStepsPerFrame = 8);
+
+		void Reset();
+
+		/// <summary>
+		/// Samples the time since the previous tick and adds it (clamped to the max frame time) to the fixed step accumulator
+		/// </summary>
+		Timestep Tick();
+
+		/// <summary>
+		/// Like Tick, but with a given frame time instead of the wall clock's (e.g. Headless simulation advancing by whole fixed steps)
+		/// </summary>
+		Timestep Advance(float seconds);
+
+		/// <summary>
+		/// Consumes a single fixed step from the accumulator, call until it returns false
+		/// </summary>
+		bool StepFixed();
+
+		Timestep GetDeltaTime() const { return deltaTime; }
+		Timestep GetFixedTimestep() const { return fixedTimestep; }
+		float GetInterpolationAlpha() const { return static_cast<float>(accumulator / fixedTimestep); }
+
+		void SetFixedTimestep(float seconds);
+		void SetMaxFrameTime(float seconds);
+		void SetMaxFixedStepsPerFrame(unsigned int steps);
+
+		float GetMaxFrameTime() const { return maxFrameTime; }
+		unsigned int GetMaxFixedStepsPerFrame() const { return maxFixedStepsPerFrame; }
+
+		uint64_t GetFrameCount() const { return frameCount; }
+		uint64_t GetFixedStepCount() const { return fixedStepCount; }
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		Clock::time_point previousTime;
+
+		Timestep deltaTime;
+		double accumulator;
+
+		float fixedTimestep;
+		float maxFrameTime;
+		unsigned int maxFixedStepsPerFrame;
+		unsigned int fixedStepsThisFrame;
+
+		uint64_t frameCount;
+		uint64_t fixedStepCount;
+	};
+}
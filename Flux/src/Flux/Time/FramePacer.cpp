@@ -0,0 +1,92 @@
+#include "FluxPCH.h"
+
+#include "FramePacer.h"
+
+#include <cmath>
+#include <thread>
+
+namespace Flux
+{
+	namespace
+	{
+		constexpr std::chrono::milliseconds SleepSlice = std::chrono::milliseconds(1);
+
+		// INFO: Starting Guess for a 1 ms Slice, Coarse Timers (e.g. Windows' Default 15.6 ms) are Learnt within a Few Frames
+		constexpr double InitialSleepEstimate = 0.002;
+
+		// INFO: Each Slice Counts for 1/32 of the Estimate, so it Follows a Change in Timer Resolution within a Frame or Two
+		constexpr double SleepSampleWeight = 1.0 / 32.0;
+
+		// INFO: Longer than any OS Timer Tick, a Slice Taking Longer was a Stall (e.g. Window Drag, Breakpoint) and Says Nothing About the Timer
+		constexpr double MaxSleepSample = 0.025;
+	}
+
+	FramePacer::FramePacer(unsigned int targetRate)
+		: targetRate(0), interval(Clock::duration::zero()), spinWait(true), hasFrameStarted(false),
+		  sleepEstimate(InitialSleepEstimate), sleepMean(InitialSleepEstimate), sleepVariance(0.0)
+	{
+		SetTargetRate(targetRate);
+		Reset();
+	}
+
+	void FramePacer::SetTargetRate(unsigned int framesPerSecond)
+	{
+		if (framesPerSecond == targetRate) { return; }
+
+		targetRate = framesPerSecond;
+		interval = targetRate > 0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetRate)) : Clock::duration::zero();
+	}
+
+	void FramePacer::Reset()
+	{
+		nextFrame = Clock::now();
+		hasFrameStarted = false;
+
+		frameTimeStats.Reset();
+		latencyStats.Reset();
+	}
+
+	void FramePacer::Wait()
+	{
+		if (!IsUncapped())
+		{
+			nextFrame = std::max(nextFrame + interval, Clock::now());
+
+			if (spinWait) { SleepUntil(nextFrame); }
+			else { std::this_thread::sleep_until(nextFrame); }
+		}
+
+		const Clock::time_point now = Clock::now();
+		if (hasFrameStarted) { frameTimeStats.Record(std::chrono::duration<double>(now - frameStart).count()); }
+
+		frameStart = now;
+		hasFrameStarted = true;
+	}
+
+	void FramePacer::MarkPresented()
+	{
+		if (!hasFrameStarted) { return; }
+
+		latencyStats.Record(std::chrono::duration<double>(Clock::now() - frameStart).count());
+	}
+
+	void FramePacer::SleepUntil(Clock::time_point deadline)
+	{
+		// INFO: Sleep in Slices while even a Slow Wake Lands Before the Deadline, Each Slice Refines how Slow a Wake can be
+		while (std::chrono::duration<double>(deadline - Clock::now()).count() > sleepEstimate)
+		{
+			const Clock::time_point sleepStart = Clock::now();
+			std::this_thread::sleep_for(SleepSlice);
+			const double observed = std::chrono::duration<double>(Clock::now() - sleepStart).count();
+			if (observed > MaxSleepSample) { continue; }
+
+			const double delta = observed - sleepMean;
+			sleepMean += SleepSampleWeight * delta;
+			sleepVariance = (1.0 - SleepSampleWeight) * (sleepVariance + SleepSampleWeight * delta * delta);
+			sleepEstimate = sleepMean + std::sqrt(sleepVariance);
+		}
+
+		// INFO: Spin Through the Rest, Yielding so a Core Shared with Other Work isn't Starved
+		while (Clock::now() < deadline) { std::this_thread::yield(); }
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <chrono>
+
+#include "FrameTimeStats.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Holds a loop to a target rate of wall time and measures it. Waits sleep in short slices while the OS timer can be trusted to
+	/// wake in time (Learnt from how late past slices woke) and spin through the remainder, so frames start on time rather than
+	/// a timer tick late. Wait at the top of the frame and sample input straight after, so input is as fresh as possible when presented.
+	/// </summary>
+	class FramePacer
+	{
+	public:
+		/// <summary>
+		/// 0 = Uncapped, Wait only measures
+		/// </summary>
+		FramePacer(unsigned int targetRate = 0);
+
+		/// <summary>
+		/// Takes effect from the next Wait, safe to change every frame
+		/// </summary>
+		void SetTargetRate(unsigned int framesPerSecond);
+		unsigned int GetTargetRate() const { return targetRate; }
+		bool IsUncapped() const { return targetRate == 0; }
+
+		/// <summary>
+		/// Spinning keeps a core busy for the end of every wait, disable it where precision matters less than CPU time (e.g. servers)
+		/// </summary>
+		void SetSpinWaitEnabled(bool enabled) { spinWait = enabled; }
+		bool IsSpinWaitEnabled() const { return spinWait; }
+
+		void Reset();
+
+		/// <summary>
+		/// Waits until the next frame is due, then starts it and records the time since the previous one started.
+		/// A frame that overran starts the next one straight away rather than bursting to catch up.
+		/// </summary>
+		void Wait();
+
+		/// <summary>
+		/// Call once the frame has been presented, records the time since Wait started it (Input sampling to present)
+		/// </summary>
+		void MarkPresented();
+
+		/// <summary>
+		/// Time between frame starts
+		/// </summary>
+		const FrameTimeStats& GetFrameTimeStats() const { return frameTimeStats; }
+
+		/// <summary>
+		/// Time from the start of a frame, where input is sampled, to its present
+		/// </summary>
+		const FrameTimeStats& GetLatencyStats() const { return latencyStats; }
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		void SleepUntil(Clock::time_point deadline);
+
+	private:
+		unsigned int targetRate;
+		Clock::duration interval;
+		bool spinWait;
+
+		Clock::time_point nextFrame;
+		Clock::time_point frameStart;
+		bool hasFrameStarted;
+
+		// INFO: Exponentially Weighted Mean and Variance of how Long a Slice Actually Sleeps, in Seconds, Old Slices Fade Out
+		double sleepEstimate;
+		double sleepMean;
+		double sleepVariance;
+
+		FrameTimeStats frameTimeStats;
+		FrameTimeStats latencyStats;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "FluxPCH.h"
+
+#include "FrameTimeStats.h"
+
+namespace Flux
+{
+	void FrameTimeStats::Record(double seconds)
+	{
+		samples[nextSample] = seconds;
+		nextSample = (nextSample + 1) % WindowSize;
+		sampleCount = std::min(sampleCount + 1, WindowSize);
+
+		// INFO: Selecting from a Copy Keeps the Samples in Recording Order, a Few Hundred Doubles is Cheap Enough Every Frame
+		std::array<double, WindowSize> sorted;
+		std::copy_n(samples.begin(), sampleCount, sorted.begin());
+
+		const auto percentile = [&sorted, this](double fraction)
+		{
+			const auto nth = sorted.begin() + static_cast<ptrdiff_t>(fraction * static_cast<double>(sampleCount - 1) + 0.5);
+			std::nth_element(sorted.begin(), nth, sorted.begin() + sampleCount);
+			return *nth;
+		};
+
+		summary.p50 = percentile(0.5);
+		summary.p99 = percentile(0.99);
+		summary.max = *std::max_element(sorted.begin(), sorted.begin() + sampleCount);
+
+		double total = 0.0;
+		for (uint32_t i = 0; i < sampleCount; ++i) { total += sorted[i]; }
+		summary.mean = total / static_cast<double>(sampleCount);
+		summary.sampleCount = sampleCount;
+	}
+
+	void FrameTimeStats::Reset()
+	{
+		nextSample = 0;
+		sampleCount = 0;
+		summary = FrameTimeSummary();
+	}
+}
\ No newline at end of file
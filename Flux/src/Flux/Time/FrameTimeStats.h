@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Flux
+{
+	struct FrameTimeSummary
+	{
+		// INFO: In Seconds, Over the Samples Currently in the Window
+		double p50 = 0.0;
+		double p99 = 0.0;
+		double max = 0.0;
+		double mean = 0.0;
+
+		uint32_t sampleCount = 0;
+	};
+
+	/// <summary>
+	/// Rolling window of the last WindowSize durations (e.g. frame times), summarised into percentiles as each one is recorded.
+	/// The summary only changes in Record, so reading it while nothing records (e.g. from layers mid-frame) is safe from any thread.
+	/// </summary>
+	class FrameTimeStats
+	{
+	public:
+		static constexpr uint32_t WindowSize = 256;
+
+		void Record(double seconds);
+		void Reset();
+
+		const FrameTimeSummary& GetSummary() const { return summary; }
+
+		double GetP50() const { return summary.p50; }
+		double GetP99() const { return summary.p99; }
+		double GetMax() const { return summary.max; }
+		double GetMean() const { return summary.mean; }
+
+		/// <summary>
+		/// Most recent sample, 0 if there isn't one yet
+		/// </summary>
+		double GetLast() const { return sampleCount > 0 ? samples[(nextSample + WindowSize - 1) % WindowSize] : 0.0; }
+
+	private:
+		std::array<double, WindowSize> samples = {};
+		uint32_t nextSample = 0;
+		uint32_t sampleCount = 0;
+
+		FrameTimeSummary summary;
+	};
+}
\ No newline at end of file
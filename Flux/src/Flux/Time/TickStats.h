@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace Flux
+{
+	/// <summary>
+	/// Running statistics of how long ticks took in wall time, in seconds
+	/// </summary>
+	class TickStats
+	{
+	public:
+		void Record(double seconds)
+		{
+			lastTickTime = seconds;
+			totalTickTime += seconds;
+			minTickTime = std::min(minTickTime, seconds);
+			maxTickTime = std::max(maxTickTime, seconds);
+			++tickCount;
+		}
+
+		void Reset() { *this = TickStats(); }
+
+		uint64_t GetTickCount() const { return tickCount; }
+
+		double GetLastTickTime() const { return lastTickTime; }
+		double GetTotalTickTime() const { return totalTickTime; }
+		double GetMinTickTime() const { return tickCount > 0 ? minTickTime : 0.0; }
+		double GetMaxTickTime() const { return maxTickTime; }
+		double GetMeanTickTime() const { return tickCount > 0 ? totalTickTime / static_cast<double>(tickCount) : 0.0; }
+
+		/// <summary>
+		/// Ticks per second of time spent ticking (Not per second of wall time, which includes any pacing)
+		/// </summary>
+		double GetTicksPerSecond() const { return totalTickTime > 0.0 ? static_cast<double>(tickCount) / totalTickTime : 0.0; }
+
+	private:
+		uint64_t tickCount = 0;
+
+		double lastTickTime = 0.0;
+		double totalTickTime = 0.0;
+		double minTickTime = std::numeric_limits<double>::max();
+		double maxTickTime = 0.0;
+	};
+}
\ No newline at end of file
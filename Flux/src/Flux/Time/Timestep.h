@@ -0,0 +1,21 @@
+#pragma once
+
+namespace Flux
+{
+	/// <summary>
+	/// Length of a frame or simulation step in seconds
+	/// </summary>
+	class Timestep
+	{
+	public:
+		constexpr Timestep(float seconds = 0.0f) : seconds(seconds) {}
+
+		constexpr operator float() const { return seconds; }
+
+		constexpr float GetSeconds() const { return seconds; }
+		constexpr float GetMilliseconds() const { return seconds * 1000.0f; }
+
+	private:
+		float seconds;
+	};
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Flux/Core.h"
+#include "Flux/Logging/Log.h"
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Flux
+{
+	template<typename Signature, size_t InlineSize = 2 * sizeof(void*)>
+	class Delegate;
+
+	/// <summary>
+	/// Non-allocating std::function replacement, the callable is stored inline and invoked through a single function pointer.
+	/// Only trivially copyable callables fit (free functions, bound member functions, lambdas capturing pointers/references)
+	/// </summary>
+	template<typename R, typename... Args, size_t InlineSize>
+	class Delegate<R(Args...), InlineSize>
+	{
+	public:
+		Delegate() = default;
+		Delegate(std::nullptr_t) {}
+
+		template<typename F>
+			requires (!std::is_same_v<std::decay_t<F>, Delegate> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+		Delegate(F&& function)
+		{
+			using Callable = std::decay_t<F>;
+
+			static_assert(sizeof(Callable) <= InlineSize, "Callable is too large for the Delegate's inline storage!");
+			static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable is over-aligned for the Delegate's inline storage!");
+			static_assert(std::is_trivially_copyable_v<Callable> && std::is_trivially_destructible_v<Callable>,
+						  "Delegates only store trivially copyable callables, capture pointers or references instead of owning objects!");
+
+			new (storage) Callable(std::forward<F>(function));
+			invoker = &Invoke<Callable>;
+		}
+
+		/// <summary>
+		/// Binds a member function, calls are dispatched virtually if the member function is virtual
+		/// </summary>
+		template<auto Method, typename T>
+		static Delegate Bind(T* instance)
+		{
+			FLUX_CORE_ASSERT(instance != nullptr, "Trying to bind a member function to a null instance!");
+			return Delegate([instance](Args... args) -> R { return std::invoke(Method, instance, std::forward<Args>(args)...); });
+		}
+
+		R operator()(Args... args) const
+		{
+			FLUX_CORE_ASSERT(invoker != nullptr, "Trying to invoke an unbound Delegate!");
+			return invoker(storage, std::forward<Args>(args)...);
+		}
+
+		explicit operator bool() const { return invoker != nullptr; }
+
+		void Reset() { invoker = nullptr; }
+
+	private:
+		using Invoker = R(*)(void* storage, Args... args);
+
+		template<typename Callable>
+		static R Invoke(void* storage, Args... args)
+		{
+			return std::invoke(*std::launder(static_cast<Callable*>(storage)), std::forward<Args>(args)...);
+		}
+
+	private:
+		alignas(std::max_align_t) mutable std::byte storage[InlineSize] = {};
+		Invoker invoker = nullptr;
+	};
+}
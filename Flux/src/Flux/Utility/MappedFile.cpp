@@ -0,0 +1,88 @@
+#include "FluxPCH.h"
+
+#include "MappedFile.h"
+
+#ifdef FLUX_PLATFORM_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Flux
+{
+	bool MappedFile::Open(const std::filesystem::path& filepath)
+	{
+		Close();
+
+#ifdef FLUX_PLATFORM_WINDOWS
+		HANDLE file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) { return false; }
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		void* view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (view == nullptr)
+		{
+			if (mapping != nullptr) { CloseHandle(mapping); }
+			CloseHandle(file);
+			return false;
+		}
+
+		fileHandle = file;
+		mappingHandle = mapping;
+		data = static_cast<const std::byte*>(view);
+		size = static_cast<size_t>(fileSize.QuadPart);
+#elif defined(FLUX_PLATFORM_LINUX)
+		const int descriptor = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+		if (descriptor < 0) { return false; }
+
+		struct stat status;
+		if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+		{
+			close(descriptor);
+			return false;
+		}
+
+		void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+		close(descriptor); // INFO: The Mapping Keeps the File Open
+
+		if (view == MAP_FAILED) { return false; }
+
+		// INFO: Loaders Read Front to Back, Let the Kernel Read Ahead Aggressively
+		madvise(view, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+		data = static_cast<const std::byte*>(view);
+		size = static_cast<size_t>(status.st_size);
+#else
+		#error "MappedFile is not implemented for this platform!"
+#endif
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (data == nullptr) { return; }
+
+#ifdef FLUX_PLATFORM_WINDOWS
+		UnmapViewOfFile(data);
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+
+		fileHandle = nullptr;
+		mappingHandle = nullptr;
+#elif defined(FLUX_PLATFORM_LINUX)
+		munmap(const_cast<std::byte*>(data), size);
+#endif
+
+		data = nullptr;
+		size = 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace Flux
+{
+	/// <summary>
+	/// Read-only memory mapping of a whole file, pages are read from disk on first touch instead of copied up front
+	/// </summary>
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::filesystem::path& filepath);
+		void Close();
+
+		const std::byte* GetData() const { return data; }
+		size_t GetSize() const { return size; }
+		bool IsOpen() const { return data != nullptr; }
+
+	private:
+		const std::byte* data = nullptr;
+		size_t size = 0;
+
+#ifdef FLUX_PLATFORM_WINDOWS
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#endif
+	};
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Flux/Core.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Flux
+{
+	/// <summary>
+	/// Stable LSD radix sort on a 64-bit key (8 bits per pass), passes where every key shares the same byte are skipped.
+	/// scratch is resized to match values and kept by the caller so repeated sorts don't allocate.
+	/// </summary>
+	template<typename T, typename KeyFunction>
+	void RadixSort(std::vector<T>& values, std::vector<T>& scratch, KeyFunction getKey)
+	{
+		constexpr uint32_t PassCount = sizeof(uint64_t);
+		const size_t count = values.size();
+
+		if (count < 2) { return; }
+		scratch.resize(count);
+
+		// INFO: Every Pass's Histogram in a Single Read of the Keys
+		std::array<std::array<uint32_t, 256>, PassCount> histograms = {};
+		for (const T& value : values)
+		{
+			const uint64_t key = getKey(value);
+			for (uint32_t pass = 0; pass < PassCount; ++pass) { ++histograms[pass][(key >> (pass * 8)) & 0xFF]; }
+		}
+
+		T* source = values.data();
+		T* destination = scratch.data();
+
+		for (uint32_t pass = 0; pass < PassCount; ++pass)
+		{
+			const uint32_t shift = pass * 8;
+			std::array<uint32_t, 256>& histogram = histograms[pass];
+
+			if (histogram[(getKey(source[0]) >> shift) & 0xFF] == count) { continue; }
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram)
+			{
+				const uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				destination[histogram[(getKey(source[i]) >> shift) & 0xFF]++] = source[i];
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != values.data()) { values.swap(scratch); }
+	}
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#include "FluxPCH.h"
+
+#include "HeadlessWindow.h"
+
+namespace Flux
+{
+	HeadlessWindow::HeadlessWindow(const WindowProperties& properties) : Window(properties)
+	{
+		// INFO: Nothing Presents, so there is Nothing to Sync To
+		data.vsyncEnabled = false;
+	}
+}
\ No newline at end of file
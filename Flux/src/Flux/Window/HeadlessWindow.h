@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Window.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Window without a native window or input, for applications that only simulate (e.g. dedicated servers)
+	/// </summary>
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow(const WindowProperties& properties);
+		virtual ~HeadlessWindow() override = default;
+
+		virtual void Update() override { EndUpdate(); }
+
+		virtual void SetVSyncEnabled(bool enabled) override { data.vsyncEnabled = enabled; }
+
+		virtual sf::RenderWindow* GetNativeWindow() override { return nullptr; }
+	};
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "FluxPCH.h"
+
+#include "ReplayWindow.h"
+
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	ReplayWindow::ReplayWindow(const WindowProperties& properties)
+		: Window(properties), reader(properties.replayFilepath), closeOnFinish(true), closeEmitted(false)
+	{
+		FLUX_CORE_INFO("Creating Replay Window: {0}", properties.replayFilepath.string());
+
+		// INFO: Report the Size the Recording Started with, so Layers see the Same Window they did when Recording
+		if (reader.IsValid())
+		{
+			data.properties.width = reader.GetHeader().windowWidth;
+			data.properties.height = reader.GetHeader().windowHeight;
+		}
+	}
+
+	void ReplayWindow::Update()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		while (std::optional<RecordedEvent> recordedEvent = reader.ReadNext(frameIndex))
+		{
+			std::visit([this](auto& event)
+			{
+				using T = std::decay_t<decltype(event)>;
+
+				if constexpr (std::is_same_v<T, WindowResizeEvent>)
+				{
+					data.properties.width = event.GetWidth();
+					data.properties.height = event.GetHeight();
+				}
+				else if constexpr (std::is_same_v<T, WindowMovedEvent>)
+				{
+					data.properties.position = event.GetPosition();
+				}
+
+				PushEvent<T>(event);
+			}, *recordedEvent);
+		}
+
+		if (closeOnFinish && !closeEmitted && reader.IsFinished() && frameIndex >= reader.GetNextFrameIndex())
+		{
+			FLUX_CORE_INFO("Input replay finished on frame {0}", frameIndex);
+
+			PushEvent<WindowCloseEvent>();
+			closeEmitted = true;
+		}
+
+		EndUpdate();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Window.h"
+
+namespace Flux
+{
+	/// <summary>
+	/// Headless window that feeds back an input recording frame-exactly instead of polling a native window
+	/// </summary>
+	class ReplayWindow : public Window
+	{
+	public:
+		ReplayWindow(const WindowProperties& properties);
+		virtual ~ReplayWindow() override = default;
+
+		virtual void Update() override;
+
+		virtual void SetVSyncEnabled(bool enabled) override { data.vsyncEnabled = enabled; }
+
+		virtual sf::RenderWindow* GetNativeWindow() override { return nullptr; }
+
+		bool IsReplayFinished() const { return reader.IsFinished(); }
+
+		/// <summary>
+		/// Emits a WindowCloseEvent once the recording ends (Enabled by Default), so replays terminate on their own
+		/// </summary>
+		void SetCloseOnFinish(bool close) { closeOnFinish = close; }
+
+	private:
+		InputRecordingReader reader;
+
+		bool closeOnFinish;
+		bool closeEmitted;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "FluxPCH.h"
+
+#include "SFMLWindow.h"
+
+#include <sfml/Graphics/Image.hpp>
+#include <sfml/Graphics/RenderWindow.hpp>
+
+#include "Flux/Events/ApplicationEvent.h"
+#include "Flux/Events/KeyEvent.h"
+#include "Flux/Events/MouseEvent.h"
+#include "Flux/Profiling/Profiler.h"
+
+namespace Flux
+{
+	SFMLWindow::SFMLWindow(const WindowProperties& properties) : SFMLWindow(properties, true)
+	{
+	}
+
+	SFMLWindow::SFMLWindow(const WindowProperties& properties, bool createNativeWindow) : Window(properties)
+	{
+		if (!createNativeWindow) { return; }
+
+		FLUX_CORE_INFO("Creating Window: {0}", data.properties);
+
+		// INFO: SFML Window Creation
+		window = std::make_unique<sf::RenderWindow>(sf::VideoMode({ data.properties.width, data.properties.height }), data.properties.title);
+		FLUX_CORE_ASSERT(window != nullptr, "Failed to create SFML Window!");
+
+		SetVSyncEnabled(true);
+		data.properties.position = window->getPosition();
+
+		// INFO: Disable Clicking on Console Window (Windows Only)
+#ifdef FLUX_PLATFORM_WINDOWS
+		HANDLE hStdIn = GetStdHandle(STD_INPUT_HANDLE);
+		DWORD consoleMode;
+		GetConsoleMode(hStdIn, &consoleMode);
+		consoleMode &= ~ENABLE_QUICK_EDIT_MODE;
+		SetConsoleMode(hStdIn, consoleMode);
+#endif
+	}
+
+	SFMLWindow::~SFMLWindow()
+	{
+		if (window) { window->close(); }
+	}
+
+	void SFMLWindow::Update()
+	{
+		FLUX_PROFILE_FUNCTION();
+
+		while (const std::optional event = PollNativeEvent())
+		{
+			TranslateEvent(*event);
+		}
+
+		// INFO: SFML has no Moved Event, so the Position is Compared Once per Update (Not per Event)
+		if (const Vector2I windowPosition = GetNativePosition(); windowPosition != data.properties.position)
+		{
+			data.properties.position = windowPosition;
+			PushEvent<WindowMovedEvent>(data.properties.position);
+		}
+
+		EndUpdate();
+	}
+
+	void SFMLWindow::SetVSyncEnabled(bool enabled)
+	{
+		data.vsyncEnabled = enabled;
+		if (window) { window->setVerticalSyncEnabled(enabled); }
+	}
+
+	std::optional<sf::Event> SFMLWindow::PollNativeEvent()
+	{
+		return window->pollEvent();
+	}
+
+	Vector2I SFMLWindow::GetNativePosition() const
+	{
+		return window->getPosition();
+	}
+
+	void SFMLWindow::TranslateEvent(const sf::Event& event)
+	{
+#pragma region ApplicationEvents
+		// INFO: Window Close Event
+		if (event.is<sf::Event::Closed>())
+		{
+			PushEvent<WindowCloseEvent>();
+		}
+		// INFO: Window Resize Event
+		else if (const auto* windowResized = event.getIf<sf::Event::Resized>())
+		{
+			sf::Vector2u size = windowResized->size;
+			data.properties.width = size.x;
+			data.properties.height = size.y;
+
+			PushEvent<WindowResizeEvent>(data.properties.width, data.properties.height);
+		}
+		// INFO: Window Focus Event
+		else if (event.is<sf::Event::FocusGained>())
+		{
+			PushEvent<WindowFocusEvent>();
+		}
+		// INFO: Window Lost Focus Event
+		else if (event.is<sf::Event::FocusLost>())
+		{
+			PushEvent<WindowLostFocusEvent>();
+		}
+#pragma endregion ApplicationEvents
+
+#pragma region KeyboardEvents
+		// INFO: Key Pressed Event
+		else if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>())
+		{
+			int keyCode = static_cast<int>(keyPressed->code);
+
+			// INFO: Handling Key Repeat
+			if (keyCode == repeatedKeyData.keyCode)
+			{
+				repeatedKeyData.repeatCount++;
+			}
+			else
+			{
+				repeatedKeyData.keyCode = keyCode;
+				repeatedKeyData.repeatCount = 0;
+			}
+			PushEvent<KeyPressedEvent>(repeatedKeyData.keyCode, repeatedKeyData.repeatCount);
+		}
+		// INFO: Key Released Event
+		else if (const auto* keyReleased = event.getIf<sf::Event::KeyReleased>())
+		{
+			int keyCode = static_cast<int>(keyReleased->code);
+
+			// INFO: Resetting Repeat Data
+			if (keyCode == repeatedKeyData.keyCode)
+			{
+				repeatedKeyData.keyCode = -1;
+				repeatedKeyData.repeatCount = 0;
+			}
+
+			PushEvent<KeyReleasedEvent>(keyCode);
+		}
+#pragma endregion KeyboardEvents
+
+#pragma region MouseEvents
+		// INFO: Mouse Button Pressed Event
+		else if (const auto* mouseButtonPressed = event.getIf<sf::Event::MouseButtonPressed>())
+		{
+			PushEvent<MouseButtonPressedEvent>(static_cast<int>(mouseButtonPressed->button), mouseButtonPressed->position);
+		}
+		// INFO: Mouse Button Released Event
+		else if (const auto* mouseButtonReleased = event.getIf<sf::Event::MouseButtonReleased>())
+		{
+			PushEvent<MouseButtonReleasedEvent>(static_cast<int>(mouseButtonReleased->button), mouseButtonReleased->position);
+		}
+		// INFO: Mouse Moved Event
+		else if (const auto* mouseMoved = event.getIf<sf::Event::MouseMoved>())
+		{
+			PushEvent<MouseMovedEvent>(mouseMoved->position);
+		}
+		// INFO: Mouse Wheel Scrolled Event
+		else if (const auto* mouseWheelScrolled = event.getIf<sf::Event::MouseWheelScrolled>())
+		{
+			PushEvent<MouseScrolledEvent>(static_cast<int>(mouseWheelScrolled->wheel), mouseWheelScrolled->position, mouseWheelScrolled->delta);
+		}
+#pragma endregion MouseEvents
+	}
+}
\ No newline at end of file
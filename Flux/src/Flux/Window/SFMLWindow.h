@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Window.h"
+
+#include <optional>
+
+#include <sfml/Window/Event.hpp>
+
+namespace Flux
+{
+	/// <summary>
+	/// Window backed by an sf::RenderWindow, translates SFML events into Flux events
+	/// </summary>
+	class SFMLWindow : public Window
+	{
+	public:
+		SFMLWindow(const WindowProperties& properties = WindowProperties());
+		virtual ~SFMLWindow() override;
+
+		virtual void Update() override;
+
+		virtual void SetVSyncEnabled(bool enabled) override;
+
+		virtual sf::RenderWindow* GetNativeWindow() override { return window.get(); }
+
+	protected:
+		/// <summary>
+		/// Skips creating the native window, for subclasses that override the event source (e.g. to benchmark or test the
+		/// event translation with scripted SFML events)
+		/// </summary>
+		SFMLWindow(const WindowProperties& properties, bool createNativeWindow);
+
+		virtual std::optional<sf::Event> PollNativeEvent();
+		virtual Vector2I GetNativePosition() const;
+
+		/// <summary>
+		/// Emits the Flux events for one SFML event
+		/// </summary>
+		void TranslateEvent(const sf::Event& event);
+
+	private:
+		struct RepeatedKeyData
+		{
+			int keyCode;
+			int repeatCount;
+
+			RepeatedKeyData(int keyCode = -1, int repeatCount = 0)
+				: keyCode(keyCode), repeatCount(repeatCount) {}
+		} repeatedKeyData;
+
+		std::unique_ptr<sf::RenderWindow> window;
+	};
+}
\ No newline at end of file
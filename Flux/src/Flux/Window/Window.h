@@ -2,10 +2,19 @@
 
 #include "Flux/Core.h"
 
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <optional>
+#include <type_traits>
 
+#include "Flux/Events/ApplicationEvent.h"
 #include "Flux/Events/Event.h"
+#include "Flux/Events/EventBus.h"
+#include "Flux/Events/MouseEvent.h"
+#include "Flux/Input/Input.h"
 #include "Flux/Math/Vector2.h"
+#include "Flux/Replay/InputRecording.h"
 
 namespace sf { class RenderWindow; }
 
@@ -18,6 +27,12 @@ namespace Flux
 		unsigned int height;
 		Vector2I position;
 
+		// INFO: When set, events are replayed from this recording and no native window is created
+		std::filesystem::path replayFilepath;
+
+		// INFO: No native window and no input, the window only counts frames
+		bool headless = false;
+
 		WindowProperties(const std::string& title = "Flux Engine",
 						 unsigned int width = 1280,
 						 unsigned int height = 720,
@@ -25,28 +40,99 @@ namespace Flux
 			: title(title), width(width), height(height), position(position) {}
 	};
 
+	/// <summary>
+	/// Window interface, backends translate their input into Flux events once per Update
+	/// </summary>
 	class Window : public EventEmitter
 	{
 	public:
-		Window(const WindowProperties& properties = WindowProperties());
-		virtual ~Window() override;
+		virtual ~Window() override = default;
+
+		/// <summary>
+		/// Creates the SFML window, a ReplayWindow if properties.replayFilepath is set or a HeadlessWindow if properties.headless is
+		/// </summary>
+		static std::unique_ptr<Window> Create(const WindowProperties& properties = WindowProperties());
 
-		void Update();
+		virtual void Update() = 0;
 
 		const WindowProperties& GetProperties() const { return data.properties; }
 		const std::string& GetTitle() const { return data.properties.title; }
 		unsigned int GetWidth() const { return data.properties.width; }
 		unsigned int GetHeight() const { return data.properties.height; }
 
-		void SetVSyncEnabled(bool enabled);
+		virtual void SetVSyncEnabled(bool enabled) = 0;
 		bool IsVSyncEnabled() const { return data.vsyncEnabled; }
 
-		void SetFramerateLimit(unsigned int limit);
+		/// <summary>
+		/// Frames per second the Application's FramePacer holds to (0 = No Limit), works alongside VSync and can change at any time
+		/// </summary>
+		void SetFramerateLimit(unsigned int limit) { data.framerateLimit = limit; }
 		unsigned int GetFramerateLimit() const { return data.framerateLimit; }
 
-		std::unique_ptr<sf::RenderWindow>& GetNativeWindow() { return window; }
+		/// <summary>
+		/// Returns nullptr for backends without a native window (e.g. Replay)
+		/// </summary>
+		virtual sf::RenderWindow* GetNativeWindow() = 0;
+
+		/// <summary>
+		/// Every event emitted from now on is written to the recorder along with the current frame index
+		/// </summary>
+		void SetInputRecorder(InputRecorder* recorder) { inputRecorder = recorder; }
+
+		/// <summary>
+		/// Every event emitted from now on also updates the input's state, which is published at the end of each Update
+		/// </summary>
+		void SetInput(Input* input) { this->input = input; }
+
+		/// <summary>
+		/// Runs of consecutive mouse move or resize events are folded into their last one before being emitted (Disabled by Default).
+		/// The input recorder and Input still see every event, enable Input's mouse move samples for the raw positions.
+		/// </summary>
+		void SetEventCoalescingEnabled(bool enabled) { coalesceEvents = enabled; }
+		bool IsEventCoalescingEnabled() const { return coalesceEvents; }
+
+		/// <summary>
+		/// Number of completed Update calls, events recorded during an Update are tagged with this index
+		/// </summary>
+		uint64_t GetFrameIndex() const { return frameIndex; }
+
+	protected:
+		Window(const WindowProperties& properties) : data(properties) {}
+
+		/// <summary>
+		/// Records the event (if recording), folds it into the input state and emits it, or holds it back for coalescing
+		/// </summary>
+		template<typename T, typename... Args>
+		void PushEvent(Args&&... args);
+
+		/// <summary>
+		/// Emits any event still held back for coalescing, publishes the input gathered during the update and moves on to the next frame,
+		/// call at the end of Update
+		/// </summary>
+		void EndUpdate()
+		{
+			FlushCoalescedEvents();
+
+			if (input != nullptr) { input->Publish(frameIndex); }
+			++frameIndex;
+		}
 
-	private:
+		void FlushCoalescedEvents()
+		{
+			if (coalescedMouseMove.has_value())
+			{
+				EmitEvent<MouseMovedEvent>(std::move(*coalescedMouseMove));
+				coalescedMouseMove.reset();
+			}
+
+			if (coalescedResize.has_value())
+			{
+				EmitEvent<WindowResizeEvent>(std::move(*coalescedResize));
+				coalescedResize.reset();
+			}
+		}
+
+	protected:
 		struct WindowData
 		{
 			WindowProperties properties;
@@ -54,21 +140,50 @@ namespace Flux
 			unsigned int framerateLimit;
 
 			WindowData(const WindowProperties& properties = WindowProperties())
-				: properties(properties), vsyncEnabled(true), framerateLimit(60) {
+				: properties(properties), vsyncEnabled(true), framerateLimit(0) {
 			}
 		} data;
 
-		struct RepeatedKeyData
-		{
-			int keyCode;
-			int repeatCount;
-
-			RepeatedKeyData(int keyCode = -1, int repeatCount = 0)
-				: keyCode(keyCode), repeatCount(repeatCount) {}
-		} repeatedKeyData;
+		InputRecorder* inputRecorder = nullptr;
+		Input* input = nullptr;
+		uint64_t frameIndex = 0;
 
-		std::unique_ptr<sf::RenderWindow> window;
+		// INFO: At Most One is Held at a Time, so Coalesced Events Keep their Order Relative to Everything Else
+		bool coalesceEvents = false;
+		std::optional<MouseMovedEvent> coalescedMouseMove;
+		std::optional<WindowResizeEvent> coalescedResize;
 	};
+
+	template<typename T, typename... Args>
+	inline void Window::PushEvent(Args&&... args)
+	{
+		T event(std::forward<Args>(args)...);
+
+		if (inputRecorder != nullptr) { inputRecorder->Record(frameIndex, event); }
+		if (input != nullptr) { input->OnEvent(event); }
+
+		if (coalesceEvents)
+		{
+			if constexpr (std::is_same_v<T, MouseMovedEvent>)
+			{
+				if (coalescedResize.has_value()) { FlushCoalescedEvents(); }
+				coalescedMouseMove = std::move(event);
+				return;
+			}
+			else if constexpr (std::is_same_v<T, WindowResizeEvent>)
+			{
+				if (coalescedMouseMove.has_value()) { FlushCoalescedEvents(); }
+				coalescedResize = std::move(event);
+				return;
+			}
+			else
+			{
+				FlushCoalescedEvents();
+			}
+		}
+
+		EmitEvent<T>(std::move(event));
+	}
 }
 
 // INFO: Specialization for Logging Window Properties
@@ -0,0 +1,65 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <format>
+#include <iostream>
+
+namespace FluxBenchmarks
+{
+	int BenchmarkRegistry::Register(const char* name, BenchmarkFunction function)
+	{
+		GetBenchmarks().push_back({ name, function });
+		return static_cast<int>(GetBenchmarks().size());
+	}
+
+	std::vector<BenchmarkRegistry::Entry>& BenchmarkRegistry::GetBenchmarks()
+	{
+		static std::vector<Entry> benchmarks;
+		return benchmarks;
+	}
+
+	std::vector<BenchmarkResult> BenchmarkRegistry::RunAll(const std::string& filter, std::chrono::milliseconds minimumTime, uint32_t repetitions)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		std::vector<BenchmarkResult> results;
+
+		for (const Entry& benchmark : GetBenchmarks())
+		{
+			if (!filter.empty() && std::string(benchmark.name).find(filter) == std::string::npos) { continue; }
+
+			// INFO: Warm Up Caches and Branch Predictors
+			benchmark.function(1);
+
+			uint64_t iterations = 1;
+			std::chrono::nanoseconds elapsed(0);
+
+			while (true)
+			{
+				Clock::time_point start = Clock::now();
+				benchmark.function(iterations);
+				elapsed = Clock::now() - start;
+
+				if (elapsed >= minimumTime || iterations >= (static_cast<uint64_t>(1) << 40)) { break; }
+				iterations *= 2;
+			}
+
+			// INFO: Repetitions Reuse the Iteration Count the First Run Settled on
+			for (uint32_t repetition = 1; repetition < repetitions; ++repetition)
+			{
+				Clock::time_point start = Clock::now();
+				benchmark.function(iterations);
+				elapsed = std::min<std::chrono::nanoseconds>(elapsed, Clock::now() - start);
+			}
+
+			const double nanosecondsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+			results.push_back({ benchmark.name, iterations, nanosecondsPerIteration, 1.0e9 / nanosecondsPerIteration });
+
+			// INFO: Printed Directly as Logging is Compiled Out in Release, where Benchmarks should be Run
+			std::cout << std::format("{0:<56} {1:>12.2f} ns/op {2:>16.0f} op/s ({3} iterations)\n",
+									 benchmark.name, nanosecondsPerIteration, 1.0e9 / nanosecondsPerIteration, iterations);
+		}
+
+		return results;
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace FluxBenchmarks
+{
+	/// <summary>
+	/// Signature of a benchmark body, it must run its workload exactly iterations times
+	/// </summary>
+	using BenchmarkFunction = void(*)(uint64_t iterations);
+
+	struct BenchmarkResult
+	{
+		std::string name;
+		uint64_t iterations;
+		double nanosecondsPerIteration;
+		double iterationsPerSecond;
+	};
+
+	class BenchmarkRegistry
+	{
+	public:
+		struct Entry
+		{
+			const char* name;
+			BenchmarkFunction function;
+		};
+
+		static int Register(const char* name, BenchmarkFunction function);
+		static std::vector<Entry>& GetBenchmarks();
+
+		/// <summary>
+		/// Runs every registered benchmark whose name contains filter, doubling the iteration count until a run takes minimumTime.
+		/// With several repetitions the fastest is kept, as noise only ever makes a run slower.
+		/// </summary>
+		static std::vector<BenchmarkResult> RunAll(const std::string& filter = "", std::chrono::milliseconds minimumTime = std::chrono::milliseconds(250), uint32_t repetitions = 1);
+	};
+
+	/// <summary>
+	/// Stops the optimiser from discarding a value that is otherwise unused
+	/// </summary>
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(_MSC_VER)
+		static volatile const void* sink;
+		sink = &value;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	inline void ClobberMemory()
+	{
+#if defined(_MSC_VER)
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+}
+
+#define FLUX_BENCHMARK_CONCATENATE_IMPL(a, b) a##b
+#define FLUX_BENCHMARK_CONCATENATE(a, b) FLUX_BENCHMARK_CONCATENATE_IMPL(a, b)
+
+// INFO: Defines and registers a benchmark, the body receives the iteration count as `iterations`
+#define FLUX_BENCHMARK(name) \
+	static void name(uint64_t iterations); \
+	static const int FLUX_BENCHMARK_CONCATENATE(name, Registration) = ::FluxBenchmarks::BenchmarkRegistry::Register(#name, &name); \
+	static void name(uint64_t iterations)
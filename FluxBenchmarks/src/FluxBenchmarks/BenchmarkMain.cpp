@@ -0,0 +1,129 @@
+#include <Flux/Logging/Log.h>
+
+#include <charconv>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "Benchmark.h"
+#include "BenchmarkReport.h"
+
+namespace
+{
+	struct Options
+	{
+		std::string filter;
+		std::string jsonFilepath;
+		std::string baselineFilepath;
+		double threshold = 0.1;
+		int minimumTime = 250;
+		int repetitions = 1;
+	};
+
+	void PrintUsage()
+	{
+		std::cout << "Usage: FluxBenchmarks [filter] [--json <file>] [--compare <baseline.json>] [--threshold <percent>] [--min-time <ms>] [--repetitions <count>]\n"
+					 "  filter         Only run benchmarks whose name contains this text\n"
+					 "  --json         Write the results to a JSON file (Use it as a later --compare baseline)\n"
+					 "  --compare      Compare against a saved baseline, exits with 1 if anything regressed\n"
+					 "  --threshold    Slowdown in percent counted as a regression (Default 10)\n"
+					 "  --min-time     Minimum time per benchmark run in milliseconds (Default 250)\n"
+					 "  --repetitions  Runs per benchmark, the fastest is kept (Default 1)\n";
+	}
+
+	template<typename T>
+	bool ParseNumber(std::string_view text, T& value)
+	{
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+		return error == std::errc() && end == text.data() + text.size();
+	}
+
+	bool ParseOptions(int argc, char** argv, Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view argument = argv[i];
+
+			if (argument == "--help" || argument == "-h") { return false; }
+
+			if (!argument.starts_with("--"))
+			{
+				options.filter = argument;
+				continue;
+			}
+
+			if (i + 1 >= argc)
+			{
+				std::cerr << std::format("{0} expects a value\n", argument);
+				return false;
+			}
+
+			const std::string_view value = argv[++i];
+			bool isValid = true;
+
+			if (argument == "--json") { options.jsonFilepath = value; }
+			else if (argument == "--compare") { options.baselineFilepath = value; }
+			else if (argument == "--threshold")
+			{
+				double percent = 0.0;
+				isValid = ParseNumber(value, percent) && percent >= 0.0;
+				options.threshold = percent / 100.0;
+			}
+			else if (argument == "--min-time") { isValid = ParseNumber(value, options.minimumTime) && options.minimumTime > 0; }
+			else if (argument == "--repetitions") { isValid = ParseNumber(value, options.repetitions) && options.repetitions > 0; }
+			else
+			{
+				std::cerr << std::format("Unknown option {0}\n", argument);
+				return false;
+			}
+
+			if (!isValid)
+			{
+				std::cerr << std::format("Invalid value {0} for {1}\n", value, argument);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int RunBenchmarks(const Options& options)
+	{
+		// INFO: Baseline Loaded Up Front so a Bad Path Fails before Minutes of Benchmarking
+		std::vector<FluxBenchmarks::BenchmarkResult> baseline;
+		if (!options.baselineFilepath.empty())
+		{
+			std::optional<std::vector<FluxBenchmarks::BenchmarkResult>> loaded = FluxBenchmarks::ReadResults(options.baselineFilepath);
+			if (!loaded) { return 2; }
+
+			baseline = std::move(*loaded);
+		}
+
+		const std::vector<FluxBenchmarks::BenchmarkResult> results = FluxBenchmarks::BenchmarkRegistry::RunAll(options.filter, std::chrono::milliseconds(options.minimumTime),
+																												 static_cast<uint32_t>(options.repetitions));
+
+		if (!options.jsonFilepath.empty() && !FluxBenchmarks::WriteResults(options.jsonFilepath, results)) { return 2; }
+
+		if (!options.baselineFilepath.empty() && FluxBenchmarks::CompareResults(baseline, results, options.threshold) > 0) { return 1; }
+
+		return 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	// INFO: Every Exit Code Comes Back Through Here, so the Async Logger is Always Flushed and Stopped
+	Flux::Log::Initialise();
+	const int exitCode = RunBenchmarks(options);
+	Flux::Log::Shutdown();
+
+	return exitCode;
+}
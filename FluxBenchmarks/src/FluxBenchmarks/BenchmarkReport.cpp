@@ -0,0 +1,133 @@
+#include "BenchmarkReport.h"
+
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include <yaml-cpp/yaml.h>
+
+namespace FluxBenchmarks
+{
+	namespace
+	{
+		std::string EscapeJSON(const std::string& text)
+		{
+			std::string escaped;
+			escaped.reserve(text.size());
+
+			for (char character : text)
+			{
+				if (character == '"' || character == '\\') { escaped += '\\'; }
+				escaped += character;
+			}
+
+			return escaped;
+		}
+	}
+
+	bool WriteResults(const std::filesystem::path& filepath, const std::vector<BenchmarkResult>& results)
+	{
+		std::ofstream file(filepath);
+		if (!file.is_open())
+		{
+			std::cerr << std::format("Failed to open {0} for writing!\n", filepath.string());
+			return false;
+		}
+
+		// INFO: Indented with Spaces, the YAML Parser that Reads it Back Rejects Tabs
+		file << "{\n    \"benchmarks\": [\n";
+
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const BenchmarkResult& result = results[i];
+
+			file << std::format("        {{ \"name\": \"{0}\", \"iterations\": {1}, \"nanosecondsPerIteration\": {2:.4f}, \"iterationsPerSecond\": {3:.4f} }}{4}\n",
+								EscapeJSON(result.name), result.iterations, result.nanosecondsPerIteration, result.iterationsPerSecond, i + 1 < results.size() ? "," : "");
+		}
+
+		file << "    ]\n}\n";
+
+		return file.good();
+	}
+
+	std::optional<std::vector<BenchmarkResult>> ReadResults(const std::filesystem::path& filepath)
+	{
+		// INFO: JSON is a Subset of YAML, so the yaml-cpp Parser the Engine Already Uses Reads it
+		YAML::Node root;
+		try
+		{
+			root = YAML::LoadFile(filepath.string());
+		}
+		catch (const YAML::Exception& exception)
+		{
+			std::cerr << std::format("Failed to read {0}: {1}\n", filepath.string(), exception.what());
+			return std::nullopt;
+		}
+
+		const YAML::Node benchmarks = root["benchmarks"];
+		if (!benchmarks || !benchmarks.IsSequence())
+		{
+			std::cerr << std::format("{0} has no benchmarks list!\n", filepath.string());
+			return std::nullopt;
+		}
+
+		std::vector<BenchmarkResult> results;
+		results.reserve(benchmarks.size());
+
+		for (const YAML::Node& benchmark : benchmarks)
+		{
+			if (!benchmark["name"] || !benchmark["nanosecondsPerIteration"]) { continue; }
+
+			BenchmarkResult& result = results.emplace_back();
+			result.name = benchmark["name"].as<std::string>();
+			result.iterations = benchmark["iterations"].as<uint64_t>(0);
+			result.nanosecondsPerIteration = benchmark["nanosecondsPerIteration"].as<double>();
+			result.iterationsPerSecond = benchmark["iterationsPerSecond"].as<double>(1.0e9 / result.nanosecondsPerIteration);
+		}
+
+		return results;
+	}
+
+	size_t CompareResults(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& results, double threshold)
+	{
+		std::unordered_map<std::string, const BenchmarkResult*> baselineByName;
+		for (const BenchmarkResult& result : baseline) { baselineByName[result.name] = &result; }
+
+		size_t regressionCount = 0;
+
+		std::cout << std::format("\n{0:<56} {1:>14} {2:>14} {3:>9}\n", "Benchmark", "Baseline ns/op", "Current ns/op", "Change");
+
+		for (const BenchmarkResult& result : results)
+		{
+			auto it = baselineByName.find(result.name);
+			if (it == baselineByName.end())
+			{
+				std::cout << std::format("{0:<56} {1:>14} {2:>14.2f} {3:>9}\n", result.name, "-", result.nanosecondsPerIteration, "new");
+				continue;
+			}
+
+			// INFO: Positive is Slower, Compared on Time per Iteration so Iteration Counts can Differ Between Runs
+			const double baselineTime = it->second->nanosecondsPerIteration;
+			const double change = baselineTime > 0.0 ? result.nanosecondsPerIteration / baselineTime - 1.0 : 0.0;
+
+			const char* verdict = "";
+			if (change > threshold)
+			{
+				verdict = "REGRESSION";
+				++regressionCount;
+			}
+			else if (change < -threshold)
+			{
+				verdict = "improved";
+			}
+
+			std::cout << std::format("{0:<56} {1:>14.2f} {2:>14.2f} {3:>+8.1f}% {4}\n", result.name, baselineTime, result.nanosecondsPerIteration, change * 100.0, verdict);
+		}
+
+		std::cout << std::format("\n{0} regression(s) beyond {1:.1f}%\n", regressionCount, threshold * 100.0);
+
+		return regressionCount;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "Benchmark.h"
+
+namespace FluxBenchmarks
+{
+	/// <summary>
+	/// Writes the results as JSON ({ "benchmarks": [ { "name", "iterations", "nanosecondsPerIteration", "iterationsPerSecond" } ] })
+	/// </summary>
+	bool WriteResults(const std::filesystem::path& filepath, const std::vector<BenchmarkResult>& results);
+
+	/// <summary>
+	/// Reads results written by WriteResults, std::nullopt if the file is missing or malformed
+	/// </summary>
+	std::optional<std::vector<BenchmarkResult>> ReadResults(const std::filesystem::path& filepath);
+
+	/// <summary>
+	/// Prints how every result changed against the baseline run of the same name. Returns the number of regressions,
+	/// results slower than their baseline by more than threshold (e.g. 0.1 for 10%).
+	/// </summary>
+	size_t CompareResults(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& results, double threshold);
+}
\ No newline at end of file
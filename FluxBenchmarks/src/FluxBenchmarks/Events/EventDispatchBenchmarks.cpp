@@ -0,0 +1,204 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Events/ApplicationEvent.h>
+#include <Flux/Events/Event.h>
+#include <Flux/Events/KeyEvent.h>
+#include <Flux/Events/MouseEvent.h>
+#include <Flux/Layer/LayerManager.h>
+
+#include <functional>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr int LayerCount = 4;
+
+#pragma region Legacy
+	// INFO: Dispatch Path before Delegates, a std::function Callback, std::bind and a std::function Built per Dispatch
+	class LegacyEventDispatcher
+	{
+		template<typename T>
+		using EventFunction = std::function<bool(T&)>;
+
+	public:
+		LegacyEventDispatcher(Event& event) : event(event) {}
+
+		template<typename T>
+		bool Dispatch(EventFunction<T> function)
+		{
+			if (event.GetEventType() == T::GetStaticType())
+			{
+				DoNotOptimize(function(static_cast<T&>(event)));
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		Event& event;
+	};
+
+	class LegacyLayer : public Layer
+	{
+	public:
+		virtual void OnEvent(Event& event) override
+		{
+			LegacyEventDispatcher dispatcher(event);
+			dispatcher.Dispatch<MouseMovedEvent>(std::bind(&LegacyLayer::OnMouseMoved, this, std::placeholders::_1));
+		}
+
+	private:
+		bool OnMouseMoved(MouseMovedEvent& event)
+		{
+			DoNotOptimize(event.GetPosition());
+			return false;
+		}
+	};
+
+	class LegacyApplication : public IEventListener
+	{
+	public:
+		LegacyApplication()
+		{
+			for (int i = 0; i < LayerCount; ++i) { layerManager.PushLayer(new LegacyLayer()); }
+			callback = std::bind(&LegacyApplication::OnEvent, this, std::placeholders::_1);
+		}
+
+		virtual void OnEvent(Event& event) override
+		{
+			LegacyEventDispatcher dispatcher(event);
+			dispatcher.Dispatch<WindowCloseEvent>(std::bind(&LegacyApplication::OnWindowClose, this, std::placeholders::_1));
+
+			layerManager.OnEvent(event);
+		}
+
+		std::function<void(Event&)> callback;
+
+	private:
+		bool OnWindowClose(WindowCloseEvent& event) { return true; }
+
+		LayerManager layerManager;
+	};
+#pragma endregion Legacy
+
+#pragma region Delegate
+	class DelegateLayer : public Layer
+	{
+	public:
+		virtual void OnEvent(Event& event) override
+		{
+			EventDispatcher dispatcher(event);
+			dispatcher.Dispatch<MouseMovedEvent>(BIND_EVENT_FUNCTION(DelegateLayer::OnMouseMoved));
+		}
+
+	private:
+		bool OnMouseMoved(MouseMovedEvent& event)
+		{
+			DoNotOptimize(event.GetPosition());
+			return false;
+		}
+	};
+
+	class DelegateApplication : public IEventListener
+	{
+	public:
+		DelegateApplication()
+		{
+			for (int i = 0; i < LayerCount; ++i) { layerManager.PushLayer(new DelegateLayer()); }
+			callback = BIND_EVENT_FUNCTION(DelegateApplication::OnEvent);
+		}
+
+		virtual void OnEvent(Event& event) override
+		{
+			EventDispatcher dispatcher(event);
+			dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FUNCTION(DelegateApplication::OnWindowClose));
+
+			layerManager.OnEvent(event);
+		}
+
+		EventEmitter::EventCallbackFunction callback;
+
+	private:
+		bool OnWindowClose(WindowCloseEvent& event) { return true; }
+
+		LayerManager layerManager;
+	};
+#pragma endregion Delegate
+
+	/// <summary>
+	/// Handler set of a typical layer, the dispatcher tries each type in turn until one matches
+	/// </summary>
+	class DispatchTarget
+	{
+	public:
+		bool Dispatch(Event& event)
+		{
+			EventDispatcher dispatcher(event);
+			dispatcher.Dispatch<WindowResizeEvent>(BIND_EVENT_FUNCTION(DispatchTarget::OnWindowResize));
+			dispatcher.Dispatch<KeyPressedEvent>(BIND_EVENT_FUNCTION(DispatchTarget::OnKeyPressed));
+			dispatcher.Dispatch<MouseButtonPressedEvent>(BIND_EVENT_FUNCTION(DispatchTarget::OnMouseButtonPressed));
+			return dispatcher.Dispatch<MouseMovedEvent>(BIND_EVENT_FUNCTION(DispatchTarget::OnMouseMoved));
+		}
+
+	private:
+		bool OnWindowResize(WindowResizeEvent& event) { DoNotOptimize(event.GetWidth()); return false; }
+		bool OnKeyPressed(KeyPressedEvent& event) { DoNotOptimize(event.GetKeyCode()); return false; }
+		bool OnMouseButtonPressed(MouseButtonPressedEvent& event) { DoNotOptimize(event.GetButtonCode()); return false; }
+		bool OnMouseMoved(MouseMovedEvent& event) { DoNotOptimize(event.GetPosition()); return false; }
+	};
+}
+
+FLUX_BENCHMARK(Event_Construct_MouseMoved)
+{
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		MouseMovedEvent event(Vector2I(static_cast<int>(i), 0));
+		DoNotOptimize(event);
+	}
+}
+
+FLUX_BENCHMARK(Event_Construct_KeyPressed)
+{
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		KeyPressedEvent event(static_cast<int>(i & 0xFF), 0);
+		DoNotOptimize(event);
+	}
+}
+
+// INFO: The Event Matches the Last of Four Handlers, so Three Type Checks Miss First
+FLUX_BENCHMARK(EventDispatcher_Dispatch_4Handlers)
+{
+	DispatchTarget target;
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		MouseMovedEvent event(Vector2I(static_cast<int>(i), 0));
+		DoNotOptimize(target.Dispatch(event));
+	}
+}
+
+// INFO: Window Callback into Application::OnEvent and through every Layer, as Window::Update Drives it per Mouse Move
+FLUX_BENCHMARK(EventDispatch_ApplicationOnEvent_StdFunction)
+{
+	static LegacyApplication application;
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		MouseMovedEvent event(Vector2I(static_cast<int>(i), 0));
+		application.callback(event);
+	}
+}
+
+FLUX_BENCHMARK(EventDispatch_ApplicationOnEvent_Delegate)
+{
+	static DelegateApplication application;
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		MouseMovedEvent event(Vector2I(static_cast<int>(i), 0));
+		application.callback(event);
+	}
+}
@@ -0,0 +1,68 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Events/KeyEvent.h>
+#include <Flux/Events/MouseEvent.h>
+#include <Flux/Input/Input.h>
+
+#include <array>
+#include <string>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t EventsPerFrame = 64;
+	constexpr uint32_t QueriesPerFrame = 256;
+}
+
+// INFO: Window Side Cost, Folding a Busy Frame of Input Events into the Pending Snapshot and Publishing it
+FLUX_BENCHMARK(Input_OnEvent_64Events_Publish)
+{
+	Input input;
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t j = 0; j < EventsPerFrame; ++j)
+		{
+			switch (j % 8)
+			{
+				case 3: input.OnEvent(KeyPressedEvent(static_cast<int>(j % KeyCount), 0)); break;
+				case 7: input.OnEvent(KeyReleasedEvent(static_cast<int>((j - 4) % KeyCount))); break;
+				default: input.OnEvent(MouseMovedEvent(Vector2I(static_cast<int>(j), static_cast<int>(i)))); break;
+			}
+		}
+
+		input.Publish(i);
+	}
+
+	DoNotOptimize(input.GetSnapshot());
+}
+
+// INFO: Gameplay Side Cost, Polling Actions Bound to Several Keys and Buttons Each
+FLUX_BENCHMARK(Input_IsActionDown_256Queries)
+{
+	Input input;
+	InputActionMap& actionMap = input.GetActionMap();
+
+	std::array<InputActionID, 8> actions;
+	for (uint32_t i = 0; i < actions.size(); ++i)
+	{
+		actions[i] = actionMap.AddAction(std::string("Action") + std::to_string(i));
+		actionMap.BindKey(actions[i], static_cast<int>(i));
+		actionMap.BindKey(actions[i], static_cast<int>(i + 40));
+		actionMap.BindMouseButton(actions[i], static_cast<int>(i % MouseButtonCount));
+	}
+
+	input.OnEvent(KeyPressedEvent(3, 0));
+	input.Publish(0);
+
+	uint32_t downCount = 0;
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t j = 0; j < QueriesPerFrame; ++j) { downCount += input.IsActionDown(actions[j % actions.size()]) ? 1 : 0; }
+		ClobberMemory();
+	}
+
+	DoNotOptimize(downCount);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Jobs/JobSystem.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t JobBatchSize = 1024;
+	constexpr uint32_t ParallelForElementCount = 1 << 20;
+
+	/// <summary>
+	/// Restarts the job system with the given total thread count (Workers + Calling Thread), one thread runs everything inline
+	/// </summary>
+	void UseThreadCount(uint32_t threadCount)
+	{
+		const uint32_t currentThreadCount = JobSystem::IsInitialised() ? JobSystem::GetThreadCount() : 1;
+		if (currentThreadCount == threadCount) { return; }
+
+		if (JobSystem::IsInitialised()) { JobSystem::Shutdown(); }
+		if (threadCount > 1) { JobSystem::Initialise(threadCount - 1); }
+	}
+
+	uint32_t GetHardwareThreadCount()
+	{
+		return std::max(std::thread::hardware_concurrency(), 2u);
+	}
+
+	std::vector<float>& GetParallelForData()
+	{
+		static std::vector<float> data(ParallelForElementCount, 1.0f);
+		return data;
+	}
+
+	// INFO: Enough Arithmetic per Element that Scaling is Bound by Cores rather than Memory Bandwidth
+	template<uint32_t ThreadCount>
+	void ParallelForScaling(uint64_t iterations)
+	{
+		UseThreadCount(ThreadCount);
+		std::vector<float>& data = GetParallelForData();
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			JobSystem::ParallelFor(ParallelForElementCount, [&data](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t index = begin; index < end; ++index)
+				{
+					float value = data[index];
+					for (int step = 0; step < 8; ++step) { value = std::sqrt(value * value + 1.0f); }
+					data[index] = value * 0.5f;
+				}
+			});
+			ClobberMemory();
+		}
+	}
+
+	const int parallelForScaling1 = BenchmarkRegistry::Register("JobSystem_ParallelFor_1M_1Thread", &ParallelForScaling<1>);
+	const int parallelForScaling2 = BenchmarkRegistry::Register("JobSystem_ParallelFor_1M_2Threads", &ParallelForScaling<2>);
+	const int parallelForScaling4 = BenchmarkRegistry::Register("JobSystem_ParallelFor_1M_4Threads", &ParallelForScaling<4>);
+	const int parallelForScaling8 = BenchmarkRegistry::Register("JobSystem_ParallelFor_1M_8Threads", &ParallelForScaling<8>);
+	const int parallelForScaling16 = BenchmarkRegistry::Register("JobSystem_ParallelFor_1M_16Threads", &ParallelForScaling<16>);
+}
+
+// INFO: Per-Job Overhead, Allocating, Queueing, Stealing/Popping and Completing an Empty Job
+FLUX_BENCHMARK(JobSystem_RunEmptyJob)
+{
+	UseThreadCount(GetHardwareThreadCount());
+
+	JobCounter counter;
+	uint64_t remaining = iterations;
+
+	while (remaining > 0)
+	{
+		const uint32_t batch = static_cast<uint32_t>(std::min<uint64_t>(remaining, JobBatchSize));
+		for (uint32_t i = 0; i < batch; ++i) { JobSystem::Run([]() {}, &counter); }
+
+		JobSystem::Wait(counter);
+		remaining -= batch;
+	}
+}
+
+FLUX_BENCHMARK(JobSystem_RunAfterDependency)
+{
+	UseThreadCount(GetHardwareThreadCount());
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		JobCounter first;
+		JobCounter second;
+
+		JobSystem::Run([]() {}, &first);
+		JobSystem::RunAfter(first, []() {}, &second);
+		JobSystem::Wait(second);
+		JobSystem::Wait(first);
+	}
+}
\ No newline at end of file
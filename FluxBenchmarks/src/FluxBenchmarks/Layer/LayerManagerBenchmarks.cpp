@@ -0,0 +1,117 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Events/MouseEvent.h>
+#include <Flux/Jobs/JobSystem.h>
+#include <Flux/Layer/LayerManager.h>
+
+#include <cmath>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t HeavyLayerCount = 8;
+	constexpr uint32_t HeavyLayerElementCount = 1 << 15;
+
+	/// <summary>
+	/// Stands in for a gameplay layer (AI, audio, ...) with its own state and a fixed amount of work per update
+	/// </summary>
+	class HeavyLayer : public Layer
+	{
+	public:
+		HeavyLayer(const std::string& name, bool declareAccess) : Layer(name), data(HeavyLayerElementCount, 1.0f)
+		{
+			if (declareAccess) { DeclareUpdateAccess({}, { name }); }
+		}
+
+		virtual void Update(Timestep deltaTime) override
+		{
+			for (float& value : data)
+			{
+				for (int step = 0; step < 4; ++step) { value = std::sqrt(value * value + deltaTime); }
+				value *= 0.5f;
+			}
+			DoNotOptimize(data.data());
+		}
+
+	private:
+		std::vector<float> data;
+	};
+
+	/// <summary>
+	/// Near empty layer, so the LayerManager's own per layer cost dominates
+	/// </summary>
+	class LightLayer : public Layer
+	{
+	public:
+		virtual void OnEvent(Event& event) override
+		{
+			EventDispatcher dispatcher(event);
+			dispatcher.Dispatch<MouseMovedEvent>(BIND_EVENT_FUNCTION(LightLayer::OnMouseMoved));
+		}
+
+		virtual void Update(Timestep deltaTime) override { DoNotOptimize(deltaTime); }
+
+	private:
+		bool OnMouseMoved(MouseMovedEvent& event)
+		{
+			DoNotOptimize(event.GetPosition());
+			return false;
+		}
+	};
+
+	template<uint32_t LayerCount>
+	void DispatchToLayers(uint64_t iterations)
+	{
+		LayerManager layerManager;
+		for (uint32_t i = 0; i < LayerCount; ++i) { layerManager.PushLayer(new LightLayer()); }
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			MouseMovedEvent event(Vector2I(static_cast<int>(i), 0));
+			layerManager.OnEvent(event);
+		}
+	}
+
+	template<uint32_t LayerCount>
+	void UpdateLightLayers(uint64_t iterations)
+	{
+		LayerManager layerManager;
+		for (uint32_t i = 0; i < LayerCount; ++i) { layerManager.PushLayer(new LightLayer()); }
+
+		for (uint64_t i = 0; i < iterations; ++i) { layerManager.Update(Timestep(1.0f / 60.0f)); }
+	}
+
+	const int onEvent1 = BenchmarkRegistry::Register("LayerManager_OnEvent_1Layer", &DispatchToLayers<1>);
+	const int onEvent16 = BenchmarkRegistry::Register("LayerManager_OnEvent_16Layers", &DispatchToLayers<16>);
+	const int onEvent128 = BenchmarkRegistry::Register("LayerManager_OnEvent_128Layers", &DispatchToLayers<128>);
+	const int update1 = BenchmarkRegistry::Register("LayerManager_Update_1Layer", &UpdateLightLayers<1>);
+	const int update16 = BenchmarkRegistry::Register("LayerManager_Update_16Layers", &UpdateLightLayers<16>);
+	const int update128 = BenchmarkRegistry::Register("LayerManager_Update_128Layers", &UpdateLightLayers<128>);
+
+	void UpdateLayers(uint64_t iterations, bool declareAccess)
+	{
+		if (!JobSystem::IsInitialised()) { JobSystem::Initialise(); }
+
+		LayerManager layerManager;
+		for (uint32_t i = 0; i < HeavyLayerCount; ++i) { layerManager.PushOverlay(new HeavyLayer(std::format("HeavyLayer{0}", i), declareAccess)); }
+
+		for (uint64_t i = 0; i < iterations; ++i) { layerManager.Update(Timestep(1.0f / 60.0f)); }
+	}
+}
+
+// INFO: Layers Without Declared Access Update One after the Other on the Main Thread
+FLUX_BENCHMARK(LayerManager_Update_8Layers_Sequential)
+{
+	UpdateLayers(iterations, false);
+}
+
+// INFO: Independent Layers Spread Across the JobSystem, Bound by the Slowest Layer rather than the Sum
+FLUX_BENCHMARK(LayerManager_Update_8Layers_Parallel)
+{
+	UpdateLayers(iterations, true);
+}
\ No newline at end of file
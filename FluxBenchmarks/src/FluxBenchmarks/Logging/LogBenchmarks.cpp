@@ -0,0 +1,110 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Logging/Formatters/MultiLevelFormatter.h>
+
+#include <memory>
+
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	/// <summary>
+	/// Formats every message like a console sink would, then drops it, so the numbers exclude terminal I/O
+	/// </summary>
+	class FormattingNullSink : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+	{
+	protected:
+		virtual void sink_it_(const spdlog::details::log_msg& message) override
+		{
+			buffer.clear();
+			formatter_->format(message, buffer);
+			DoNotOptimize(buffer.size());
+		}
+
+		virtual void flush_() override {}
+
+	private:
+		spdlog::memory_buf_t buffer;
+	};
+
+	std::shared_ptr<FormattingNullSink> CreateSink()
+	{
+		auto sink = std::make_shared<FormattingNullSink>();
+		sink->set_formatter(std::make_unique<MultiLevelFormatter>());
+		return sink;
+	}
+
+	// INFO: Logged through the Logger Directly, as the FLUX_ Macros are Compiled Out in Release where Benchmarks Run
+	const spdlog::source_loc Location(__FILE__, __LINE__, "LogBenchmark");
+}
+
+// INFO: The Info Pattern Includes the Function Name, Warn and Above the File and Line
+FLUX_BENCHMARK(Log_MultiLevelFormatter_Format_Info)
+{
+	MultiLevelFormatter formatter;
+	spdlog::memory_buf_t buffer;
+	const spdlog::details::log_msg message(Location, "FLUX", spdlog::level::info, "Creating Window: Flux Engine, (1280, 720)");
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		buffer.clear();
+		formatter.format(message, buffer);
+		DoNotOptimize(buffer.size());
+	}
+}
+
+FLUX_BENCHMARK(Log_MultiLevelFormatter_Format_Warn)
+{
+	MultiLevelFormatter formatter;
+	spdlog::memory_buf_t buffer;
+	const spdlog::details::log_msg message(Location, "FLUX", spdlog::level::warn, "VSync is enabled, setting a frame rate limit has no effect!");
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		buffer.clear();
+		formatter.format(message, buffer);
+		DoNotOptimize(buffer.size());
+	}
+}
+
+FLUX_BENCHMARK(Log_SyncLogger_Info)
+{
+	spdlog::logger logger("FLUX", CreateSink());
+	logger.set_level(spdlog::level::trace);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		logger.log(Location, spdlog::level::info, "Frame {0} took {1:.2f} ms", i, 16.6);
+	}
+}
+
+// INFO: Below the Logger's Level, Only the Level Check should Remain
+FLUX_BENCHMARK(Log_SyncLogger_Filtered)
+{
+	spdlog::logger logger("FLUX", CreateSink());
+	logger.set_level(spdlog::level::info);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		logger.log(Location, spdlog::level::trace, "Frame {0} took {1:.2f} ms", i, 16.6);
+	}
+}
+
+// INFO: Caller Side Cost in the Engine's Default Asynchronous Mode, Formatting Happens on the Pool's Thread
+FLUX_BENCHMARK(Log_AsyncLogger_Info)
+{
+	auto threadPool = std::make_shared<spdlog::details::thread_pool>(8192, 1);
+	auto logger = std::make_shared<spdlog::async_logger>("FLUX", CreateSink(), threadPool, spdlog::async_overflow_policy::overrun_oldest);
+	logger->set_level(spdlog::level::trace);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		logger->log(Location, spdlog::level::info, "Frame {0} took {1:.2f} ms", i, 16.6);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Math/BatchMath.h>
+
+#include <random>
+#include <vector>
+
+#include <sfml/Graphics/Transform.hpp>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t PointCount = 1 << 16;
+
+	/// <summary>
+	/// The same random boxes as an array of sf::Vector2f pairs (The scalar path) and as separate coordinate arrays (The batch path)
+	/// </summary>
+	struct BatchData
+	{
+		std::vector<sf::Vector2f> points;
+		std::vector<AABB> boxes;
+
+		std::vector<float> x, y;
+		std::vector<float> maxX, maxY;
+		std::vector<float> outX, outY;
+		std::vector<uint32_t> indices;
+
+		// INFO: Integrated and Aged in Place, Kept Apart from the Boxes so the Other Kernels See the Same Data Every Run
+		std::vector<float> positionX, positionY;
+		std::vector<float> velocityX, velocityY;
+		std::vector<float> life;
+
+		BatchData()
+		{
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> position(-10000.0f, 10000.0f);
+			std::uniform_real_distribution<float> size(8.0f, 64.0f);
+
+			for (uint32_t i = 0; i < PointCount; ++i)
+			{
+				const sf::Vector2f point(position(random), position(random));
+				const sf::Vector2f extent(size(random), size(random));
+
+				points.push_back(point);
+				boxes.emplace_back(point, point + extent);
+
+				x.push_back(point.x);
+				y.push_back(point.y);
+				maxX.push_back(point.x + extent.x);
+				maxY.push_back(point.y + extent.y);
+			}
+
+			outX.resize(PointCount);
+			outY.resize(PointCount);
+			indices.resize(PointCount);
+
+			positionX = x;
+			positionY = y;
+			velocityX = maxX;
+			velocityY = maxY;
+			life.assign(PointCount, 1.0e9f);
+		}
+	};
+
+	BatchData& GetBatchData()
+	{
+		static BatchData data;
+		return data;
+	}
+
+	Matrix3x3 GetTransform()
+	{
+		return Matrix3x3::FromTransform(Vector2F(640.0f, 360.0f), 30.0f, Vector2F(2.0f, 2.0f));
+	}
+
+	AABB GetView()
+	{
+		return AABB(Vector2F(-1920.0f, -1080.0f), Vector2F(1920.0f, 1080.0f));
+	}
+
+	template<SIMDLevel Level>
+	void TransformPoints(uint64_t iterations)
+	{
+		BatchData& data = GetBatchData();
+		const Matrix3x3 matrix = GetTransform();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			BatchMath::TransformPoints(matrix, data.x.data(), data.y.data(), data.outX.data(), data.outY.data(), PointCount);
+			ClobberMemory();
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+	}
+
+	template<SIMDLevel Level>
+	void Length(uint64_t iterations)
+	{
+		BatchData& data = GetBatchData();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			BatchMath::Length(data.x.data(), data.y.data(), data.outX.data(), PointCount);
+			ClobberMemory();
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+	}
+
+	template<SIMDLevel Level>
+	void Merge(uint64_t iterations)
+	{
+		BatchData& data = GetBatchData();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			DoNotOptimize(BatchMath::Merge(data.x.data(), data.y.data(), data.maxX.data(), data.maxY.data(), PointCount));
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+	}
+
+	template<SIMDLevel Level>
+	void Cull(uint64_t iterations)
+	{
+		BatchData& data = GetBatchData();
+		const AABB view = GetView();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			DoNotOptimize(BatchMath::Cull(view, data.x.data(), data.y.data(), data.maxX.data(), data.maxY.data(), data.indices.data(), PointCount));
+			ClobberMemory();
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+	}
+
+	template<SIMDLevel Level>
+	void Integrate(uint64_t iterations)
+	{
+		BatchData& data = GetBatchData();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			BatchMath::Integrate(data.positionX.data(), data.positionY.data(), data.velocityX.data(), data.velocityY.data(), 0.0f, 9.81f, 0.99f, 1.0f / 60.0f, PointCount);
+			ClobberMemory();
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+	}
+
+	template<SIMDLevel Level>
+	void Age(uint64_t iterations)
+	{
+		BatchData& data = GetBatchData();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			DoNotOptimize(BatchMath::Age(data.life.data(), 1.0f / 60.0f, PointCount));
+			ClobberMemory();
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+	}
+
+	// INFO: SetSIMDLevel Clamps to what the CPU Supports, so Unsupported Levels Measure the Best Available One
+	const int transformPointsScalar = BenchmarkRegistry::Register("BatchMath_TransformPoints_64K_Scalar", &TransformPoints<SIMDLevel::Scalar>);
+	const int transformPointsSSE2 = BenchmarkRegistry::Register("BatchMath_TransformPoints_64K_SSE2", &TransformPoints<SIMDLevel::SSE2>);
+	const int transformPointsAVX2 = BenchmarkRegistry::Register("BatchMath_TransformPoints_64K_AVX2", &TransformPoints<SIMDLevel::AVX2>);
+	const int lengthScalar = BenchmarkRegistry::Register("BatchMath_Length_64K_Scalar", &Length<SIMDLevel::Scalar>);
+	const int lengthSSE2 = BenchmarkRegistry::Register("BatchMath_Length_64K_SSE2", &Length<SIMDLevel::SSE2>);
+	const int lengthAVX2 = BenchmarkRegistry::Register("BatchMath_Length_64K_AVX2", &Length<SIMDLevel::AVX2>);
+	const int mergeScalar = BenchmarkRegistry::Register("BatchMath_Merge_64K_Scalar", &Merge<SIMDLevel::Scalar>);
+	const int mergeSSE2 = BenchmarkRegistry::Register("BatchMath_Merge_64K_SSE2", &Merge<SIMDLevel::SSE2>);
+	const int mergeAVX2 = BenchmarkRegistry::Register("BatchMath_Merge_64K_AVX2", &Merge<SIMDLevel::AVX2>);
+	const int cullScalar = BenchmarkRegistry::Register("BatchMath_Cull_64K_Scalar", &Cull<SIMDLevel::Scalar>);
+	const int cullSSE2 = BenchmarkRegistry::Register("BatchMath_Cull_64K_SSE2", &Cull<SIMDLevel::SSE2>);
+	const int cullAVX2 = BenchmarkRegistry::Register("BatchMath_Cull_64K_AVX2", &Cull<SIMDLevel::AVX2>);
+	const int integrateScalar = BenchmarkRegistry::Register("BatchMath_Integrate_64K_Scalar", &Integrate<SIMDLevel::Scalar>);
+	const int integrateSSE2 = BenchmarkRegistry::Register("BatchMath_Integrate_64K_SSE2", &Integrate<SIMDLevel::SSE2>);
+	const int integrateAVX2 = BenchmarkRegistry::Register("BatchMath_Integrate_64K_AVX2", &Integrate<SIMDLevel::AVX2>);
+	const int ageScalar = BenchmarkRegistry::Register("BatchMath_Age_64K_Scalar", &Age<SIMDLevel::Scalar>);
+	const int ageSSE2 = BenchmarkRegistry::Register("BatchMath_Age_64K_SSE2", &Age<SIMDLevel::SSE2>);
+	const int ageAVX2 = BenchmarkRegistry::Register("BatchMath_Age_64K_AVX2", &Age<SIMDLevel::AVX2>);
+}
+
+// INFO: Baselines, the Array of sf::Vector2f Paths the Batch Kernels Replace
+FLUX_BENCHMARK(BatchMath_TransformPoints_64K_SFML)
+{
+	BatchData& data = GetBatchData();
+	const sf::Transform transform = GetTransform();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < PointCount; ++index)
+		{
+			const sf::Vector2f point = transform.transformPoint(data.points[index]);
+			data.outX[index] = point.x;
+			data.outY[index] = point.y;
+		}
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(BatchMath_Length_64K_SFML)
+{
+	BatchData& data = GetBatchData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < PointCount; ++index) { data.outX[index] = data.points[index].length(); }
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(BatchMath_Merge_64K_AABBUnion)
+{
+	BatchData& data = GetBatchData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		AABB merged = data.boxes.front();
+		for (const AABB& box : data.boxes) { merged = AABB::Union(merged, box); }
+		DoNotOptimize(merged);
+	}
+}
+
+FLUX_BENCHMARK(BatchMath_Cull_64K_AABBOverlaps)
+{
+	BatchData& data = GetBatchData();
+	const AABB view = GetView();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		size_t visibleCount = 0;
+		for (uint32_t index = 0; index < PointCount; ++index)
+		{
+			if (data.boxes[index].Overlaps(view)) { data.indices[visibleCount++] = index; }
+		}
+		DoNotOptimize(visibleCount);
+		ClobberMemory();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Math/Vector2.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t VectorCount = 4096;
+
+	struct VectorData
+	{
+		std::vector<Vector2F> positions;
+		std::vector<Vector2F> velocities;
+		std::vector<float> results;
+
+		VectorData() : results(VectorCount)
+		{
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+			for (uint32_t i = 0; i < VectorCount; ++i)
+			{
+				positions.emplace_back(distribution(random), distribution(random));
+				velocities.emplace_back(distribution(random), distribution(random));
+			}
+		}
+	};
+
+	VectorData& GetVectorData()
+	{
+		static VectorData data;
+		return data;
+	}
+}
+
+// INFO: position += velocity * deltaTime, the Most Common Vector Operation in Gameplay Code
+FLUX_BENCHMARK(Vector2_Integrate_4K)
+{
+	VectorData& data = GetVectorData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < VectorCount; ++index) { data.positions[index] += data.velocities[index] * (1.0f / 60.0f); }
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(Vector2_Dot_4K)
+{
+	VectorData& data = GetVectorData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < VectorCount; ++index) { data.results[index] = data.positions[index].Dot(data.velocities[index]); }
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(Vector2_Length_4K)
+{
+	VectorData& data = GetVectorData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < VectorCount; ++index) { data.results[index] = data.velocities[index].Length(); }
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(Vector2_Normalised_4K)
+{
+	VectorData& data = GetVectorData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < VectorCount; ++index)
+		{
+			const Vector2F direction = data.velocities[index].Normalised();
+			data.results[index] = direction.x + direction.y;
+		}
+		ClobberMemory();
+	}
+}
+
+// INFO: Round Trip Through sf::Vector2f, which Every SFML Call with a Flux Vector Pays
+FLUX_BENCHMARK(Vector2_SFMLRoundTrip_4K)
+{
+	VectorData& data = GetVectorData();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < VectorCount; ++index)
+		{
+			const sf::Vector2f converted = data.positions[index];
+			data.results[index] = Vector2F(converted).x;
+		}
+		ClobberMemory();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Jobs/JobSystem.h>
+#include <Flux/Memory/LinearArena.h>
+#include <Flux/Memory/Memory.h>
+#include <Flux/Memory/Pool.h>
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t AllocationCount = 1024;
+	constexpr uint32_t VectorElementCount = 256;
+
+	struct Particle
+	{
+		float position[2];
+		float velocity[2];
+		float lifetime;
+		uint32_t colour;
+	};
+}
+
+// INFO: Baseline, Small Transient Allocations from the Global Heap
+FLUX_BENCHMARK(Allocator_NewDelete)
+{
+	std::vector<Particle*> particles(AllocationCount);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (Particle*& particle : particles) { particle = new Particle(); }
+		DoNotOptimize(particles.data());
+		for (Particle* particle : particles) { delete particle; }
+	}
+}
+
+// INFO: The Same Allocations from an Arena, Freed All at Once by a Reset
+FLUX_BENCHMARK(Allocator_LinearArena)
+{
+	LinearArena arena(AllocationCount * sizeof(Particle) * 2);
+	std::vector<Particle*> particles(AllocationCount);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (Particle*& particle : particles) { particle = arena.New<Particle>(); }
+		DoNotOptimize(particles.data());
+		arena.Reset();
+	}
+}
+
+FLUX_BENCHMARK(Allocator_Pool)
+{
+	Pool<Particle> pool(AllocationCount);
+	std::vector<Particle*> particles(AllocationCount);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (Particle*& particle : particles) { particle = pool.New(); }
+		DoNotOptimize(particles.data());
+		for (Particle* particle : particles) { pool.Delete(particle); }
+	}
+}
+
+// INFO: A Temporary Vector Grown Element by Element, Reallocating as it Goes
+FLUX_BENCHMARK(Allocator_Vector_Heap)
+{
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		std::vector<uint32_t> values;
+		for (uint32_t value = 0; value < VectorElementCount; ++value) { values.push_back(value); }
+		DoNotOptimize(values.data());
+	}
+}
+
+FLUX_BENCHMARK(Allocator_Vector_Scratch)
+{
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		ScratchScope scratch;
+		std::pmr::vector<uint32_t> values(scratch.GetResource());
+		for (uint32_t value = 0; value < VectorElementCount; ++value) { values.push_back(value); }
+		DoNotOptimize(values.data());
+	}
+}
+
+// INFO: Jobs Building Temporary Buffers Contend on the Global Heap, Scratch Arenas are per Thread
+FLUX_BENCHMARK(Allocator_ParallelFor_Heap)
+{
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		JobSystem::ParallelFor(AllocationCount, [](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				std::vector<uint32_t> values(VectorElementCount, index);
+				DoNotOptimize(values.data());
+			}
+		}, 16);
+	}
+}
+
+FLUX_BENCHMARK(Allocator_ParallelFor_Scratch)
+{
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		JobSystem::ParallelFor(AllocationCount, [](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				ScratchScope scratch;
+				std::pmr::vector<uint32_t> values(VectorElementCount, index, scratch.GetResource());
+				DoNotOptimize(values.data());
+			}
+		}, 16);
+	}
+}
\ No newline at end of file
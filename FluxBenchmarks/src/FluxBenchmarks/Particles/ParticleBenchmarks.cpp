@@ -0,0 +1,100 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Math/BatchMath.h>
+#include <Flux/Particles/ParticleSystem.h>
+#include <Flux/Renderer/NullRenderBackend.h>
+#include <Flux/Renderer/Renderer2D.h>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t ParticleCount = 1000000;
+	constexpr float FrameTime = 1.0f / 60.0f;
+
+	/// <summary>
+	/// A million particles in steady state, the emission rate replaces the ones expiring each frame (~11k) so updates keep compacting and spawning
+	/// </summary>
+	struct SteadyStateParticles
+	{
+		ParticleSystem particleSystem;
+
+		SteadyStateParticles()
+		{
+			ParticleEmitterProperties properties;
+			properties.position = Vector2F(960.0f, 540.0f);
+			properties.positionVariance = Vector2F(960.0f, 540.0f);
+			properties.minVelocity = Vector2F(-100.0f, -200.0f);
+			properties.maxVelocity = Vector2F(100.0f, 0.0f);
+			properties.acceleration = Vector2F(0.0f, 98.1f);
+			properties.damping = 0.9f;
+			properties.minLifetime = 1.0f;
+			properties.maxLifetime = 2.0f;
+			properties.endSize = 1.0f;
+			properties.emissionRate = static_cast<float>(ParticleCount) / 1.5f;
+			properties.maxParticles = ParticleCount;
+
+			particleSystem.AddEmitter(properties).Emit(ParticleCount);
+
+			// INFO: Two Seconds In, the Initial Burst has Expired and Emission is Keeping the Count Up
+			for (uint32_t i = 0; i < 120; ++i) { particleSystem.Update(FrameTime); }
+		}
+	};
+
+	ParticleSystem& GetParticleSystem()
+	{
+		static SteadyStateParticles particles;
+		return particles.particleSystem;
+	}
+
+	template<SIMDLevel Level>
+	void UpdateParticles(uint64_t iterations)
+	{
+		ParticleSystem& particleSystem = GetParticleSystem();
+		BatchMath::SetSIMDLevel(Level);
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			particleSystem.Update(FrameTime);
+			ClobberMemory();
+		}
+
+		BatchMath::SetSIMDLevel(BatchMath::GetSupportedSIMDLevel());
+		DoNotOptimize(particleSystem.GetParticleCount());
+	}
+
+	// INFO: Each Iteration is One Frame's Update of ~1M Particles (Target Under 4 ms)
+	const int updateScalar = BenchmarkRegistry::Register("ParticleSystem_Update_1M_Scalar", &UpdateParticles<SIMDLevel::Scalar>);
+	const int updateSSE2 = BenchmarkRegistry::Register("ParticleSystem_Update_1M_SSE2", &UpdateParticles<SIMDLevel::SSE2>);
+	const int updateAVX2 = BenchmarkRegistry::Register("ParticleSystem_Update_1M_AVX2", &UpdateParticles<SIMDLevel::AVX2>);
+}
+
+FLUX_BENCHMARK(ParticleSystem_WriteVertices_1M)
+{
+	ParticleSystem& particleSystem = GetParticleSystem();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		DoNotOptimize(particleSystem.WriteVertices().getVertexCount());
+		ClobberMemory();
+	}
+}
+
+// INFO: Update, Vertex Emission and Submission as a Frame would Run them (Null Backend)
+FLUX_BENCHMARK(ParticleSystem_Frame_1M)
+{
+	static Renderer2D renderer(std::make_unique<NullRenderBackend>());
+	ParticleSystem& particleSystem = GetParticleSystem();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		particleSystem.Update(FrameTime);
+
+		renderer.BeginFrame();
+		particleSystem.Render(renderer);
+		renderer.EndFrame();
+
+		DoNotOptimize(renderer.GetStatistics().vertexCount);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Jobs/JobSystem.h>
+#include <Flux/Scene/Components.h>
+#include <Flux/Scene/Entity.h>
+#include <Flux/Scene/Scene.h>
+
+#include <memory>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr int PileWidth = 200;
+	constexpr int PileHeight = 50;
+
+	/// <summary>
+	/// 10k boxes resting in a pile on the ground, sleeping is disabled so every step solves the whole pile
+	/// </summary>
+	std::unique_ptr<Scene> CreatePileScene()
+	{
+		std::unique_ptr<Scene> scene = std::make_unique<Scene>("PhysicsBenchmark");
+
+		PhysicsSpecification specification;
+		specification.enableSleep = false;
+		scene->EnablePhysics(specification);
+
+		Entity ground = scene->CreateEntity();
+		ground.AddComponent<TransformComponent>(Vector2F(0.0f, 32.0f));
+		ground.AddComponent<ColliderComponent>(ColliderShape::Box, Vector2F(PileWidth * 40.0f, 64.0f));
+		ground.AddComponent<RigidbodyComponent>(RigidbodyType::Static);
+
+		for (int y = 0; y < PileHeight; ++y)
+		{
+			for (int x = 0; x < PileWidth; ++x)
+			{
+				Entity box = scene->CreateEntity();
+				box.AddComponent<TransformComponent>(Vector2F((x - PileWidth / 2) * 34.0f, -16.0f - y * 33.0f));
+				box.AddComponent<ColliderComponent>(ColliderShape::Box, Vector2F(32.0f, 32.0f));
+				box.AddComponent<RigidbodyComponent>();
+			}
+		}
+
+		// INFO: Let the Pile Settle so the Measured Steps are Contact Heavy rather than Free Fall
+		for (int i = 0; i < 120; ++i) { scene->FixedUpdate(1.0f / 60.0f); }
+
+		return scene;
+	}
+
+	// INFO: The Physics World Reads the Thread Count when Created, so Each Thread Count Gets its Own Scene
+	template<uint32_t ThreadCount>
+	void PhysicsStepScaling(uint64_t iterations)
+	{
+		if (!JobSystem::IsInitialised() || JobSystem::GetThreadCount() != ThreadCount)
+		{
+			if (JobSystem::IsInitialised()) { JobSystem::Shutdown(); }
+			if (ThreadCount > 1) { JobSystem::Initialise(ThreadCount - 1); }
+		}
+
+		static std::unique_ptr<Scene> scene = CreatePileScene();
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			scene->FixedUpdate(1.0f / 60.0f);
+			ClobberMemory();
+		}
+	}
+
+	const int physicsStepScaling1 = BenchmarkRegistry::Register("Physics_Step_10kBodies_1Thread", &PhysicsStepScaling<1>);
+	const int physicsStepScaling2 = BenchmarkRegistry::Register("Physics_Step_10kBodies_2Threads", &PhysicsStepScaling<2>);
+	const int physicsStepScaling4 = BenchmarkRegistry::Register("Physics_Step_10kBodies_4Threads", &PhysicsStepScaling<4>);
+	const int physicsStepScaling8 = BenchmarkRegistry::Register("Physics_Step_10kBodies_8Threads", &PhysicsStepScaling<8>);
+}
\ No newline at end of file
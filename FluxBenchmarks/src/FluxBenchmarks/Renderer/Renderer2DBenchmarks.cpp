@@ -0,0 +1,143 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Renderer/NullRenderBackend.h>
+#include <Flux/Renderer/Renderer2D.h>
+#include <Flux/Utility/RadixSort.h>
+
+#include <sfml/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t SpriteCount = 100000;
+	constexpr uint32_t TextureCount = 8;
+
+	// INFO: Default Constructed Textures Never Touch the GPU, only their Addresses Matter to the Renderer
+	std::array<sf::Texture, TextureCount>& GetTextures()
+	{
+		static std::array<sf::Texture, TextureCount> textures;
+		return textures;
+	}
+
+	const std::vector<Sprite2D>& GetSprites()
+	{
+		static std::vector<Sprite2D> sprites = []()
+		{
+			std::mt19937 random(1337);
+			std::uniform_real_distribution<float> position(0.0f, 1920.0f);
+			std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+			std::vector<Sprite2D> result(SpriteCount);
+			for (Sprite2D& sprite : result)
+			{
+				sprite.position = Vector2F(position(random), position(random));
+				sprite.size = Vector2F(32.0f, 32.0f);
+				sprite.origin = Vector2F(16.0f, 16.0f);
+				sprite.rotation = unit(random) < 0.25f ? unit(random) * 360.0f : 0.0f;
+				sprite.texture = &GetTextures()[random() % TextureCount];
+				sprite.textureRect = sf::IntRect({ 0, 0 }, { 32, 32 });
+				sprite.layer = static_cast<uint8_t>(random() % 4);
+				sprite.depth = static_cast<float>(random() % 4);
+			}
+			return result;
+		}();
+
+		return sprites;
+	}
+
+	std::vector<uint64_t>& GetSortKeys()
+	{
+		static std::vector<uint64_t> keys = []()
+		{
+			std::vector<uint64_t> result;
+			for (const Sprite2D& sprite : GetSprites())
+			{
+				result.push_back(Renderer2D::MakeSortKey(sprite.layer, sprite.depth, sprite.blendMode, static_cast<uint32_t>(sprite.texture - GetTextures().data())));
+			}
+			return result;
+		}();
+
+		return keys;
+	}
+
+	// INFO: Stands in for a Frame's Update, Long Enough to Hide the Renderer's Side of the Previous Frame Behind
+	void SimulateFrame()
+	{
+		const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+		while (std::chrono::steady_clock::now() < end) {}
+	}
+
+	template<bool RenderThread>
+	void SimulateAndRenderFrames(uint64_t iterations)
+	{
+		Renderer2D renderer(std::make_unique<NullRenderBackend>());
+		renderer.SetRenderThreadEnabled(RenderThread);
+
+		const std::vector<Sprite2D>& sprites = GetSprites();
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			SimulateFrame();
+
+			renderer.BeginFrame();
+			for (const Sprite2D& sprite : sprites) { renderer.Submit(sprite); }
+			renderer.EndFrame();
+		}
+
+		renderer.Flush();
+		DoNotOptimize(renderer.GetStatistics().drawCallCount);
+	}
+
+	// INFO: Frame Time is Simulation + Render on One Thread, Closer to Max(Simulation, Render) with the Render Thread
+	const int simulateSingleThread = BenchmarkRegistry::Register("Renderer2D_SimulateAndRender_100kSprites_SingleThread", &SimulateAndRenderFrames<false>);
+	const int simulateRenderThread = BenchmarkRegistry::Register("Renderer2D_SimulateAndRender_100kSprites_RenderThread", &SimulateAndRenderFrames<true>);
+}
+
+// INFO: Full CPU Side of a Frame, Submission, Radix Sort, Parallel Vertex Generation and Batching (Null Backend)
+FLUX_BENCHMARK(Renderer2D_Frame_100kSprites)
+{
+	static Renderer2D renderer(std::make_unique<NullRenderBackend>());
+	const std::vector<Sprite2D>& sprites = GetSprites();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		renderer.BeginFrame();
+		for (const Sprite2D& sprite : sprites) { renderer.Submit(sprite); }
+		renderer.EndFrame();
+
+		DoNotOptimize(renderer.GetStatistics().drawCallCount);
+	}
+}
+
+FLUX_BENCHMARK(Renderer2D_SortKeys_100k_RadixSort)
+{
+	std::vector<uint64_t> keys;
+	std::vector<uint64_t> scratch;
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		keys = GetSortKeys();
+		RadixSort(keys, scratch, [](uint64_t key) { return key; });
+		DoNotOptimize(keys.front());
+	}
+}
+
+FLUX_BENCHMARK(Renderer2D_SortKeys_100k_StdSort)
+{
+	std::vector<uint64_t> keys;
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		keys = GetSortKeys();
+		std::stable_sort(keys.begin(), keys.end());
+		DoNotOptimize(keys.front());
+	}
+}
\ No newline at end of file
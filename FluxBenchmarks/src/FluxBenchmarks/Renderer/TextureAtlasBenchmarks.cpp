@@ -0,0 +1,130 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Renderer/NullRenderBackend.h>
+#include <Flux/Renderer/Renderer2D.h>
+#include <Flux/Renderer/SkylinePacker.h>
+
+#include <sfml/Graphics/Texture.hpp>
+
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t SpriteCount = 100000;
+	constexpr uint32_t ImageCount = 256;
+	constexpr uint32_t PageSize = 4096;
+
+	std::vector<sf::Vector2u> MakeImageSizes(uint32_t count, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<uint32_t> size(8, 128);
+
+		std::vector<sf::Vector2u> sizes(count);
+		for (sf::Vector2u& imageSize : sizes) { imageSize = sf::Vector2u(size(random), size(random)); }
+		return sizes;
+	}
+
+	// INFO: Default Constructed Textures Never Touch the GPU, only their Addresses Matter to the Renderer
+	std::array<sf::Texture, ImageCount>& GetSeparateTextures()
+	{
+		static std::array<sf::Texture, ImageCount> textures;
+		return textures;
+	}
+
+	sf::Texture& GetAtlasPage()
+	{
+		static sf::Texture page;
+		return page;
+	}
+
+	// INFO: The Same Scene Drawn Twice, Once with a Texture per Image and Once with Every Image Packed into One Atlas Page
+	struct SpriteScenes
+	{
+		std::vector<Sprite2D> separate;
+		std::vector<Sprite2D> atlased;
+	};
+
+	const SpriteScenes& GetScenes()
+	{
+		static SpriteScenes scenes = []()
+		{
+			const std::vector<sf::Vector2u> imageSizes = MakeImageSizes(ImageCount, 7);
+
+			SkylinePacker packer(sf::Vector2u(PageSize, PageSize));
+			std::vector<sf::IntRect> atlasRects;
+			for (const sf::Vector2u& imageSize : imageSizes)
+			{
+				atlasRects.emplace_back(sf::Vector2i(*packer.Insert(imageSize + sf::Vector2u(1, 1))), sf::Vector2i(imageSize));
+			}
+
+			std::mt19937 random(1337);
+			std::uniform_real_distribution<float> position(0.0f, 1920.0f);
+
+			SpriteScenes result;
+			for (uint32_t i = 0; i < SpriteCount; ++i)
+			{
+				const uint32_t image = random() % ImageCount;
+
+				Sprite2D sprite;
+				sprite.position = Vector2F(position(random), position(random));
+				sprite.size = Vector2F(imageSizes[image].x, imageSizes[image].y);
+				sprite.layer = static_cast<uint8_t>(random() % 4);
+				sprite.depth = static_cast<float>(random() % 4);
+
+				sprite.texture = &GetSeparateTextures()[image];
+				sprite.textureRect = sf::IntRect({ 0, 0 }, sf::Vector2i(imageSizes[image]));
+				result.separate.push_back(sprite);
+
+				sprite.texture = &GetAtlasPage();
+				sprite.textureRect = atlasRects[image];
+				result.atlased.push_back(sprite);
+			}
+			return result;
+		}();
+
+		return scenes;
+	}
+
+	void RenderFrames(const std::vector<Sprite2D>& sprites, uint64_t iterations)
+	{
+		static Renderer2D renderer(std::make_unique<NullRenderBackend>());
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			renderer.BeginFrame();
+			for (const Sprite2D& sprite : sprites) { renderer.Submit(sprite); }
+			renderer.EndFrame();
+
+			DoNotOptimize(renderer.GetStatistics().drawCallCount);
+		}
+	}
+}
+
+FLUX_BENCHMARK(SkylinePacker_Fill_4096Page)
+{
+	static const std::vector<sf::Vector2u> imageSizes = MakeImageSizes(4096, 42);
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		SkylinePacker packer(sf::Vector2u(PageSize, PageSize));
+		for (const sf::Vector2u& imageSize : imageSizes) { DoNotOptimize(packer.Insert(imageSize)); }
+		DoNotOptimize(packer.GetUsedArea());
+	}
+}
+
+// INFO: Roughly 4k Draw Calls, a Batch Ends at Every Texture Change within each Layer and Depth
+FLUX_BENCHMARK(Renderer2D_Frame_100kSprites_256Textures)
+{
+	RenderFrames(GetScenes().separate, iterations);
+}
+
+// INFO: One Draw Call, Every Sprite Samples the Same Atlas Page
+FLUX_BENCHMARK(Renderer2D_Frame_100kSprites_Atlas)
+{
+	RenderFrames(GetScenes().atlased, iterations);
+}
\ No newline at end of file
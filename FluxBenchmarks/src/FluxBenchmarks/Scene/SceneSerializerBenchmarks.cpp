@@ -0,0 +1,182 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Scene/Components.h>
+#include <Flux/Scene/Scene.h>
+#include <Flux/Scene/SceneSerializer.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	/// <summary>
+	/// Level-like scene, every entity has a transform, a quarter have bounds and an eighth are physics props
+	/// </summary>
+	void PopulateScene(Scene& scene, uint32_t entityCount)
+	{
+		entt::registry& registry = scene.GetRegistry();
+
+		std::mt19937 random(1337);
+		std::uniform_real_distribution<float> position(0.0f, 100000.0f);
+
+		for (uint32_t i = 0; i < entityCount; ++i)
+		{
+			const entt::entity entity = registry.create();
+			const Vector2F center(position(random), position(random));
+
+			registry.emplace<TransformComponent>(entity, center, static_cast<float>(i % 360));
+			if (i % 4 == 0) { registry.emplace<BoundsComponent>(entity, AABB::FromCenter(center, Vector2F(16.0f, 16.0f))); }
+
+			if (i % 8 == 0)
+			{
+				registry.emplace<RigidbodyComponent>(entity, RigidbodyType::Dynamic);
+				registry.emplace<ColliderComponent>(entity, ColliderShape::Box, Vector2F(32.0f, 32.0f));
+			}
+		}
+	}
+
+	/// <summary>
+	/// A 4-ary tree of transforms whose position x is the entity's creation index, so scenes can be compared without their handles
+	/// </summary>
+	void PopulateHierarchy(Scene& scene, uint32_t entityCount)
+	{
+		entt::registry& registry = scene.GetRegistry();
+
+		std::vector<entt::entity> entities(entityCount);
+		registry.create(entities.begin(), entities.end());
+
+		for (uint32_t i = 0; i < entityCount; ++i) { registry.emplace<TransformComponent>(entities[i], Vector2F(static_cast<float>(i), 0.0f), 0.0f); }
+
+		// INFO: Shuffled First so Parents Come Both Before and After their Children in the Saved Entity List
+		std::shuffle(entities.begin(), entities.end(), std::mt19937(1337));
+		for (uint32_t i = 1; i < entityCount; ++i) { scene.SetParent(entities[i], entities[(i - 1) / 4]); }
+	}
+
+	/// <summary>
+	/// Each entity's creation index mapped to its parent's (-1 for roots)
+	/// </summary>
+	std::map<float, float> GetParentLinks(Scene& scene)
+	{
+		entt::registry& registry = scene.GetRegistry();
+		std::map<float, float> links;
+
+		for (const auto [entity, transform] : registry.storage<TransformComponent>().each())
+		{
+			const entt::entity parent = scene.GetParent(entity);
+			links[transform.position.x] = parent != entt::null ? registry.get<TransformComponent>(parent).position.x : -1.0f;
+		}
+
+		return links;
+	}
+
+	/// <summary>
+	/// Saves a parented scene and loads it back, checking the first round trip kept every link
+	/// </summary>
+	void RoundTripHierarchy(bool isBinary, uint64_t iterations)
+	{
+		static Scene scene;
+		static const bool isPopulated = (PopulateHierarchy(scene, 10000), true);
+		static const std::map<float, float> links = GetParentLinks(scene);
+
+		const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "FluxBenchmarks" / (isBinary ? "Hierarchy.fluxscene" : "Hierarchy.yaml");
+		std::filesystem::create_directories(filepath.parent_path());
+
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			Scene loadedScene;
+			SceneSerializer serializer(loadedScene);
+
+			const bool isLoaded = isBinary ? SceneSerializer(scene).SerializeBinary(filepath) && serializer.DeserializeBinary(filepath)
+										   : SceneSerializer(scene).SerializeYAML(filepath) && serializer.DeserializeYAML(filepath);
+
+			if (i == 0) { FLUX_VERIFY(isLoaded && GetParentLinks(loadedScene) == links, "Scene hierarchy did not survive a save and load!"); }
+			DoNotOptimize(isLoaded);
+		}
+	}
+
+	/// <summary>
+	/// Saves the scene in both formats to a temporary directory once
+	/// </summary>
+	const std::filesystem::path& GetScenePath(uint32_t entityCount, bool isBinary)
+	{
+		static std::map<std::pair<uint32_t, bool>, std::filesystem::path> paths;
+
+		auto [it, isInserted] = paths.try_emplace({ entityCount, isBinary });
+		if (isInserted)
+		{
+			const std::filesystem::path directory = std::filesystem::temp_directory_path() / "FluxBenchmarks";
+			std::filesystem::create_directories(directory);
+
+			it->second = directory / std::format("Level{0}.{1}", entityCount, isBinary ? "fluxscene" : "yaml");
+
+			Scene scene("Level");
+			PopulateScene(scene, entityCount);
+
+			SceneSerializer serializer(scene);
+			if (isBinary) { serializer.SerializeBinary(it->second); }
+			else { serializer.SerializeYAML(it->second); }
+		}
+
+		return it->second;
+	}
+
+	void LoadScene(const std::filesystem::path& filepath, bool isBinary, uint64_t iterations)
+	{
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			Scene scene;
+			SceneSerializer serializer(scene);
+
+			const bool isLoaded = isBinary ? serializer.DeserializeBinary(filepath) : serializer.DeserializeYAML(filepath);
+			DoNotOptimize(isLoaded);
+		}
+	}
+}
+
+// INFO: Includes Destroying the Loaded Scene, as a Level Switch would
+FLUX_BENCHMARK(SceneSerializer_LoadBinary_1M)
+{
+	LoadScene(GetScenePath(1000000, true), true, iterations);
+}
+
+FLUX_BENCHMARK(SceneSerializer_LoadBinary_100k)
+{
+	LoadScene(GetScenePath(100000, true), true, iterations);
+}
+
+// INFO: A Tenth of the Binary Benchmark's Entities, the 1M Entity YAML Level Takes Too Long to Run Repeatedly
+FLUX_BENCHMARK(SceneSerializer_LoadYAML_100k)
+{
+	LoadScene(GetScenePath(100000, false), false, iterations);
+}
+
+FLUX_BENCHMARK(SceneSerializer_SaveBinary_100k)
+{
+	static Scene scene;
+	static const bool isPopulated = (PopulateScene(scene, 100000), true);
+
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "FluxBenchmarks" / "Save.fluxscene";
+	std::filesystem::create_directories(filepath.parent_path());
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		DoNotOptimize(SceneSerializer(scene).SerializeBinary(filepath));
+	}
+}
+
+FLUX_BENCHMARK(SceneSerializer_RoundTripBinary_Hierarchy_10k)
+{
+	RoundTripHierarchy(true, iterations);
+}
+
+FLUX_BENCHMARK(SceneSerializer_RoundTripYAML_Hierarchy_10k)
+{
+	RoundTripHierarchy(false, iterations);
+}
\ No newline at end of file
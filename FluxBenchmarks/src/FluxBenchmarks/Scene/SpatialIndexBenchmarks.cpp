@@ -0,0 +1,102 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Scene/Components.h>
+#include <Flux/Scene/Entity.h>
+#include <Flux/Scene/Scene.h>
+
+#include <random>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t StaticPropCount = 500000;
+	constexpr float WorldSize = 50000.0f;
+
+	// INFO: Large Level of Static Props, the Camera Sees a Few Hundred of them at a Time
+	Scene& GetLevel()
+	{
+		static Scene level("SpatialIndexBenchmark");
+		static bool isPopulated = false;
+
+		if (!isPopulated)
+		{
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> position(0.0f, WorldSize);
+			std::uniform_real_distribution<float> size(16.0f, 128.0f);
+
+			for (uint32_t i = 0; i < StaticPropCount; ++i)
+			{
+				const Vector2F min(position(random), position(random));
+				level.CreateEntity().AddComponent<BoundsComponent>(AABB(min, Vector2F(min.x + size(random), min.y + size(random))));
+			}
+
+			isPopulated = true;
+		}
+
+		return level;
+	}
+
+	AABB GetCameraView(uint64_t frame)
+	{
+		const float offset = static_cast<float>(frame % 1000) * 40.0f;
+		return AABB(Vector2F(offset, offset), Vector2F(offset + 1920.0f, offset + 1080.0f));
+	}
+}
+
+FLUX_BENCHMARK(SpatialIndex_CameraQuery_500kStaticProps)
+{
+	const Scene& level = GetLevel();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		uint32_t visibleCount = 0;
+		level.QueryArea(GetCameraView(i), [&visibleCount](entt::entity) { ++visibleCount; });
+		DoNotOptimize(visibleCount);
+	}
+}
+
+// INFO: What Culling Costs without the Index, Testing Every Prop's Bounds against the Camera
+FLUX_BENCHMARK(SpatialIndex_CameraBruteForce_500kStaticProps)
+{
+	const Scene& level = GetLevel();
+	auto view = level.GetRegistry().view<const BoundsComponent>();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		const AABB camera = GetCameraView(i);
+
+		uint32_t visibleCount = 0;
+		for (auto [entity, bounds] : view.each())
+		{
+			if (bounds.bounds.Overlaps(camera)) { ++visibleCount; }
+		}
+		DoNotOptimize(visibleCount);
+	}
+}
+
+FLUX_BENCHMARK(SpatialIndex_MoveProxy_Reinsert)
+{
+	static SpatialIndex index;
+	static std::vector<SpatialProxyID> proxies;
+
+	if (proxies.empty())
+	{
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> position(0.0f, WorldSize);
+		for (uint32_t i = 0; i < 100000; ++i)
+		{
+			const Vector2F min(position(random), position(random));
+			proxies.push_back(index.CreateProxy(AABB(min, Vector2F(min.x + 32.0f, min.y + 32.0f)), static_cast<entt::entity>(i)));
+		}
+	}
+
+	// INFO: Every Move Escapes the Fattened Bounds, Worst Case for the Tree
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		const SpatialProxyID proxy = proxies[i % proxies.size()];
+		const Vector2F min(static_cast<float>((i * 7919) % 50000), static_cast<float>((i * 104729) % 50000));
+		DoNotOptimize(index.MoveProxy(proxy, AABB(min, Vector2F(min.x + 32.0f, min.y + 32.0f))));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Scene/TransformHierarchy.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	// INFO: 1000 Trees of One Root, 10 Children and 90 Grandchildren (101K Nodes)
+	constexpr uint32_t TreeCount = 1000;
+	constexpr uint32_t ChildCount = 10;
+	constexpr uint32_t GrandchildCount = 9;
+	constexpr uint32_t NodesPerTree = 1 + ChildCount + ChildCount * GrandchildCount;
+	constexpr uint32_t NodeCount = TreeCount * NodesPerTree;
+
+	entt::entity ToEntity(uint32_t index) { return static_cast<entt::entity>(index); }
+
+	uint32_t GetParentIndex(uint32_t index)
+	{
+		const uint32_t tree = index / NodesPerTree;
+		const uint32_t local = index % NodesPerTree;
+
+		if (local == 0) { return ~0u; }
+		if (local <= ChildCount) { return tree * NodesPerTree; }
+		return tree * NodesPerTree + 1 + (local - 1 - ChildCount) / GrandchildCount;
+	}
+
+	Vector2F GetLocalPosition(uint32_t index)
+	{
+		return Vector2F(static_cast<float>(index % 97), static_cast<float>(index % 89));
+	}
+
+	/// <summary>
+	/// Nodes added in shuffled order and then parented, so the hierarchy has to sort them into depth first order itself
+	/// </summary>
+	TransformHierarchy& GetHierarchy()
+	{
+		static TransformHierarchy hierarchy;
+
+		if (hierarchy.GetNodeCount() == 0)
+		{
+			std::vector<uint32_t> order(NodeCount);
+			std::iota(order.begin(), order.end(), 0u);
+			std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+			for (uint32_t index : order) { hierarchy.Add(ToEntity(index), GetLocalPosition(index), static_cast<float>(index % 360)); }
+			for (uint32_t index : order)
+			{
+				const uint32_t parent = GetParentIndex(index);
+				if (parent != ~0u) { hierarchy.SetParent(ToEntity(index), ToEntity(parent)); }
+			}
+
+			hierarchy.Update();
+		}
+
+		return hierarchy;
+	}
+
+	/// <summary>
+	/// The pointer chasing scene graph the hierarchy replaces, heap allocated nodes holding their children and updated recursively
+	/// </summary>
+	struct SceneGraphNode
+	{
+		Vector2F position;
+		float rotation = 0.0f;
+		Matrix3x3 world;
+		std::vector<SceneGraphNode*> children;
+	};
+
+	struct SceneGraph
+	{
+		std::vector<std::unique_ptr<SceneGraphNode>> nodes;
+		std::vector<SceneGraphNode*> roots;
+
+		SceneGraph()
+		{
+			// INFO: Allocated in Shuffled Order so Siblings aren't Neighbours in Memory, as in a Long Running Game
+			std::vector<uint32_t> order(NodeCount);
+			std::iota(order.begin(), order.end(), 0u);
+			std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+			nodes.resize(NodeCount);
+			for (uint32_t index : order)
+			{
+				nodes[index] = std::make_unique<SceneGraphNode>();
+				nodes[index]->position = GetLocalPosition(index);
+				nodes[index]->rotation = static_cast<float>(index % 360);
+			}
+
+			for (uint32_t index = 0; index < NodeCount; ++index)
+			{
+				const uint32_t parent = GetParentIndex(index);
+				if (parent == ~0u) { roots.push_back(nodes[index].get()); }
+				else { nodes[parent]->children.push_back(nodes[index].get()); }
+			}
+		}
+
+		static void Update(SceneGraphNode& node, const Matrix3x3& parentWorld)
+		{
+			node.world = parentWorld * Matrix3x3::FromTransform(node.position, node.rotation);
+			for (SceneGraphNode* child : node.children) { Update(*child, node.world); }
+		}
+	};
+
+	SceneGraph& GetSceneGraph()
+	{
+		static SceneGraph graph;
+		return graph;
+	}
+}
+
+FLUX_BENCHMARK(TransformHierarchy_Update_100K_AllDirty)
+{
+	TransformHierarchy& hierarchy = GetHierarchy();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = 0; index < NodeCount; ++index)
+		{
+			hierarchy.SetLocal(ToEntity(index), GetLocalPosition(index + static_cast<uint32_t>(i)), static_cast<float>(index % 360));
+		}
+
+		hierarchy.Update();
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(TransformHierarchy_Update_100K_RootsDirty)
+{
+	TransformHierarchy& hierarchy = GetHierarchy();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t tree = 0; tree < TreeCount; ++tree)
+		{
+			const uint32_t index = tree * NodesPerTree;
+			hierarchy.SetLocal(ToEntity(index), GetLocalPosition(index + static_cast<uint32_t>(i)), 0.0f);
+		}
+
+		hierarchy.Update();
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(TransformHierarchy_Update_100K_OnePercentDirty)
+{
+	TransformHierarchy& hierarchy = GetHierarchy();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (uint32_t index = static_cast<uint32_t>(i % 100); index < NodeCount; index += 100)
+		{
+			hierarchy.SetLocal(ToEntity(index), GetLocalPosition(index + static_cast<uint32_t>(i)), static_cast<float>(index % 360));
+		}
+
+		hierarchy.Update();
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(TransformHierarchy_Update_100K_Clean)
+{
+	TransformHierarchy& hierarchy = GetHierarchy();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		hierarchy.Update();
+		ClobberMemory();
+	}
+}
+
+FLUX_BENCHMARK(TransformHierarchy_Reparent_2K)
+{
+	TransformHierarchy& hierarchy = GetHierarchy();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		// INFO: Moves a Grandchild to its Parent's Next Sibling and Back in Every Tree, the Structure is Unchanged After Every Iteration
+		for (uint32_t tree = 0; tree < TreeCount; ++tree)
+		{
+			const uint32_t grandchild = tree * NodesPerTree + 1 + ChildCount;
+			hierarchy.SetParent(ToEntity(grandchild), ToEntity(GetParentIndex(grandchild) + 1));
+			hierarchy.SetParent(ToEntity(grandchild), ToEntity(GetParentIndex(grandchild)));
+		}
+
+		hierarchy.Update();
+		ClobberMemory();
+	}
+}
+
+// INFO: Baseline, the Naive Scene Graph Recomputes Everything as it has no Cheap way to Find Dirty Nodes
+FLUX_BENCHMARK(TransformHierarchy_Update_100K_NaiveSceneGraph)
+{
+	SceneGraph& graph = GetSceneGraph();
+
+	for (uint64_t i = 0; i < iterations; ++i)
+	{
+		for (SceneGraphNode* root : graph.roots) { SceneGraph::Update(*root, Matrix3x3::Identity()); }
+		ClobberMemory();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Jobs/JobSystem.h>
+#include <Flux/Layer/Layer.h>
+#include <Flux/Scene/Components.h>
+#include <Flux/Scene/Entity.h>
+#include <Flux/Scene/Scene.h>
+#include <Flux/Simulation/SimulationHost.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t MatchElementCount = 1 << 12;
+	constexpr int ArenaBoxCount = 64;
+
+	/// <summary>
+	/// Stands in for a server side match, a fixed amount of deterministic simulation per fixed step
+	/// </summary>
+	class MatchLayer : public Layer
+	{
+	public:
+		MatchLayer() : Layer("MatchLayer"), state(MatchElementCount, 1.0f) {}
+
+		virtual void FixedUpdate(Timestep fixedTimestep) override
+		{
+			for (float& value : state) { value = std::sqrt(value * value + fixedTimestep) * 0.5f; }
+			DoNotOptimize(state.data());
+		}
+
+	private:
+		std::vector<float> state;
+	};
+
+	std::unique_ptr<Application> CreateMatch()
+	{
+		ApplicationSpecification specification;
+		specification.headless = true;
+		specification.tickRate = 60;
+
+		std::unique_ptr<Application> match = std::make_unique<Application>(specification);
+		match->PushLayer(new MatchLayer());
+		return match;
+	}
+
+	/// <summary>
+	/// Undeclared, steps a small physics scene every fixed step, so box2d's solver runs inside the instance's job
+	/// </summary>
+	class ArenaLayer : public Layer
+	{
+	public:
+		ArenaLayer() : Layer("ArenaLayer"), scene("Arena")
+		{
+			scene.EnablePhysics();
+
+			Entity ground = scene.CreateEntity();
+			ground.AddComponent<TransformComponent>(Vector2F(0.0f, 32.0f));
+			ground.AddComponent<ColliderComponent>(ColliderShape::Box, Vector2F(ArenaBoxCount * 40.0f, 64.0f));
+			ground.AddComponent<RigidbodyComponent>(RigidbodyType::Static);
+
+			for (int i = 0; i < ArenaBoxCount; ++i)
+			{
+				Entity box = scene.CreateEntity();
+				box.AddComponent<TransformComponent>(Vector2F((i % 16 - 8) * 34.0f, -16.0f - (i / 16) * 33.0f));
+				box.AddComponent<ColliderComponent>(ColliderShape::Box, Vector2F(32.0f, 32.0f));
+				box.AddComponent<RigidbodyComponent>();
+			}
+		}
+
+		virtual void FixedUpdate(Timestep fixedTimestep) override { scene.FixedUpdate(fixedTimestep); }
+
+	private:
+		Scene scene;
+	};
+
+	/// <summary>
+	/// Declares its access, so the instance's Update runs it (and the layers after it) as jobs from inside the instance's own job
+	/// </summary>
+	class SystemLayer : public Layer
+	{
+	public:
+		SystemLayer(const std::string& name, std::initializer_list<std::string_view> reads, std::initializer_list<std::string_view> writes)
+			: Layer(name), state(MatchElementCount / 4, 1.0f)
+		{
+			DeclareUpdateAccess(reads, writes);
+		}
+
+		virtual void Update(Timestep deltaTime) override
+		{
+			for (float& value : state) { value = std::sqrt(value * value + deltaTime) * 0.5f; }
+			DoNotOptimize(state.data());
+		}
+
+	private:
+		std::vector<float> state;
+	};
+
+	std::unique_ptr<Application> CreateArenaMatch()
+	{
+		ApplicationSpecification specification;
+		specification.headless = true;
+		specification.tickRate = 60;
+
+		// INFO: AI and Effects Run Side by Side after the Arena, Scoring Waits for AI
+		std::unique_ptr<Application> match = std::make_unique<Application>(specification);
+		match->PushLayer(new ArenaLayer());
+		match->PushLayer(new SystemLayer("AILayer", {}, { "AI" }));
+		match->PushLayer(new SystemLayer("ScoreLayer", { "AI" }, { "Score" }));
+		match->PushLayer(new SystemLayer("EffectsLayer", {}, { "Effects" }));
+		return match;
+	}
+
+	/// <summary>
+	/// Each iteration is one uncapped host step, ticking every instance once
+	/// </summary>
+	template<uint32_t InstanceCount>
+	void StepInstances(uint64_t iterations)
+	{
+		SimulationHostSpecification specification;
+		specification.tickRate = 0;
+
+		SimulationHost host(specification);
+		for (uint32_t i = 0; i < InstanceCount; ++i) { host.AddInstance(CreateMatch()); }
+
+		for (uint64_t i = 0; i < iterations; ++i) { host.Step(); }
+
+		DoNotOptimize(host.GetStepStats().GetTickCount());
+	}
+
+	/// <summary>
+	/// Four instances per thread, so every thread is inside an instance tick while the layer graph and physics solver wait on their own jobs
+	/// </summary>
+	void StepArenaInstances(uint64_t iterations)
+	{
+		SimulationHostSpecification specification;
+		specification.tickRate = 0;
+
+		SimulationHost host(specification);
+
+		const uint32_t instanceCount = JobSystem::GetThreadCount() * 4;
+		for (uint32_t i = 0; i < instanceCount; ++i) { host.AddInstance(CreateArenaMatch()); }
+
+		for (uint64_t i = 0; i < iterations; ++i) { host.Step(); }
+
+		DoNotOptimize(host.GetStepStats().GetTickCount());
+	}
+
+	// INFO: Per Instance Tick Cost with No Parallelism, Compare Against the Many Instance Steps Divided by Instances per Thread
+	const int step1 = BenchmarkRegistry::Register("SimulationHost_Step_1Instance", &StepInstances<1>);
+	const int step64 = BenchmarkRegistry::Register("SimulationHost_Step_64Instances", &StepInstances<64>);
+	const int step256 = BenchmarkRegistry::Register("SimulationHost_Step_256Instances", &StepInstances<256>);
+	const int stepArena = BenchmarkRegistry::Register("SimulationHost_Step_ArenaInstances_4PerThread", &StepArenaInstances);
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Time/FramePacer.h>
+#include <Flux/Time/FrameTimeStats.h>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	template<bool SpinWait>
+	void PaceFrames(uint64_t iterations)
+	{
+		FramePacer pacer(1000);
+		pacer.SetSpinWaitEnabled(SpinWait);
+
+		for (uint64_t i = 0; i < iterations; ++i) { pacer.Wait(); }
+
+		DoNotOptimize(pacer.GetFrameTimeStats().GetSummary());
+	}
+
+	// INFO: Each Iteration is a 1 ms Frame, the Closer to 1,000,000 ns per Iteration the More Precise the Pacing
+	const int paceSleep = BenchmarkRegistry::Register("FramePacer_Wait_1000Hz_Sleep", &PaceFrames<false>);
+	const int paceSpin = BenchmarkRegistry::Register("FramePacer_Wait_1000Hz_SleepThenSpin", &PaceFrames<true>);
+}
+
+// INFO: Per Frame Cost of Keeping the Rolling Percentiles Up to Date
+FLUX_BENCHMARK(FrameTimeStats_Record)
+{
+	FrameTimeStats stats;
+
+	for (uint64_t i = 0; i < iterations; ++i) { stats.Record(0.016 + static_cast<double>(i % 7) * 0.0001); }
+
+	DoNotOptimize(stats.GetSummary());
+}
\ No newline at end of file
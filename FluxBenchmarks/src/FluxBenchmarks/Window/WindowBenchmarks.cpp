@@ -0,0 +1,82 @@
+#include "FluxBenchmarks/Benchmark.h"
+
+#include <Flux/Window/SFMLWindow.h>
+
+#include <vector>
+
+namespace
+{
+	using namespace Flux;
+	using namespace FluxBenchmarks;
+
+	constexpr uint32_t EventsPerUpdate = 64;
+
+	/// <summary>
+	/// SFMLWindow without a native window, every Update translates the same scripted frame of SFML events
+	/// </summary>
+	class ScriptedSFMLWindow : public SFMLWindow
+	{
+	public:
+		ScriptedSFMLWindow(bool coalesceEvents = false) : SFMLWindow(WindowProperties(), false)
+		{
+			SetEventCoalescingEnabled(coalesceEvents);
+
+			// INFO: A Busy Frame, Mostly Mouse Movement with Some Keys and Clicks Mixed In
+			for (uint32_t i = 0; i < EventsPerUpdate; ++i)
+			{
+				switch (i % 8)
+				{
+					case 3: events.emplace_back(sf::Event::KeyPressed{ .code = sf::Keyboard::Key::W }); break;
+					case 5: events.emplace_back(sf::Event::MouseButtonPressed{ sf::Mouse::Button::Left, { static_cast<int>(i), 0 } }); break;
+					case 7: events.emplace_back(sf::Event::KeyReleased{ .code = sf::Keyboard::Key::W }); break;
+					default: events.emplace_back(sf::Event::MouseMoved{ { static_cast<int>(i), static_cast<int>(i) } }); break;
+				}
+			}
+		}
+
+		virtual void Update() override
+		{
+			nextEvent = 0;
+			SFMLWindow::Update();
+		}
+
+	protected:
+		virtual std::optional<sf::Event> PollNativeEvent() override
+		{
+			if (nextEvent == events.size()) { return std::nullopt; }
+			return events[nextEvent++];
+		}
+
+		virtual Vector2I GetNativePosition() const override { return data.properties.position; }
+
+	private:
+		std::vector<sf::Event> events;
+		size_t nextEvent = 0;
+	};
+}
+
+// INFO: SFML to Flux Event Translation and Emission, Handed to a Callback as the Application Receives them
+FLUX_BENCHMARK(Window_Update_Translate64Events)
+{
+	ScriptedSFMLWindow window;
+
+	uint64_t eventCount = 0;
+	window.SetEventCallback([&eventCount](Event& event) { eventCount += static_cast<uint64_t>(event.GetEventType()); });
+
+	for (uint64_t i = 0; i < iterations; ++i) { window.Update(); }
+
+	DoNotOptimize(eventCount);
+}
+
+// INFO: The Same Frame with Runs of Mouse Moves Folded into One, so Far Fewer Events Reach the Callback
+FLUX_BENCHMARK(Window_Update_Translate64Events_Coalesced)
+{
+	ScriptedSFMLWindow window(true);
+
+	uint64_t eventCount = 0;
+	window.SetEventCallback([&eventCount](Event& event) { eventCount += static_cast<uint64_t>(event.GetEventType()); });
+
+	for (uint64_t i = 0; i < iterations; ++i) { window.Update(); }
+
+	DoNotOptimize(eventCount);
+}
\ No newline at end of file
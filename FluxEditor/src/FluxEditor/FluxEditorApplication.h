@@ -8,7 +8,7 @@
 class EditorLayer : public Flux::Layer
 {
 public:
-	EditorLayer() : Layer("EditorLayer") {}
+	EditorLayer(sf::RenderWindow* nativeWindow, Flux::AssetHandle<sf::Image> windowIcon) : Layer("EditorLayer"), nativeWindow(nativeWindow), windowIcon(std::move(windowIcon)) {}
 
 	virtual void OnAttach() override
 	{
@@ -25,7 +25,7 @@ public:
 		FLUX_INFO("FluxEditor: {0}", event);
 	}
 
-	virtual void Update() override
+	virtual void Update(Flux::Timestep deltaTime) override
 	{
 		static bool once = true;
 
@@ -34,7 +34,22 @@ public:
 			FLUX_INFO("EditorLayer is actively updating!");
 			once = false;
 		}
+
+		// INFO: Icon is Decoded in the Background, Applied (and Released) Once it Arrives
+		if (windowIcon.IsLoaded())
+		{
+			nativeWindow->setIcon(windowIcon->getSize(), windowIcon->getPixelsPtr());
+			windowIcon.Reset();
+		}
+		else if (windowIcon.IsFailed())
+		{
+			windowIcon.Reset();
+		}
 	}
+
+private:
+	sf::RenderWindow* nativeWindow;
+	Flux::AssetHandle<sf::Image> windowIcon;
 };
 
 class FluxEditorApplication : public Flux::Application
@@ -42,15 +57,16 @@ class FluxEditorApplication : public Flux::Application
 public:
 	FluxEditorApplication() 
 	{
-		// INFO: Adding Default Flux Icon to Editor Window
-		auto& nativeWindow = GetWindow()->GetNativeWindow();
-		const std::filesystem::path iconPath = "resources/FluxIcon.png";
+		// INFO: High Polling Rate Mice Report Many Moves per Frame, the Editor Only Needs the Latest
+		GetWindow()->SetEventCoalescingEnabled(true);
+
+		// INFO: Adding Default Flux Icon to Editor Window (No Native Window when Replaying Input)
+		sf::RenderWindow* nativeWindow = GetWindow()->GetNativeWindow();
 
-		sf::Image icon;
-		FLUX_CORE_VERIFY(icon.loadFromFile(iconPath), std::format("Failed to load window icon from path: {0}", iconPath.string()));
-		nativeWindow->setIcon(icon.getSize(), icon.getPixelsPtr());
+		Flux::AssetHandle<sf::Image> windowIcon;
+		if (nativeWindow != nullptr) { windowIcon = GetAssetManager().Load<sf::Image>("resources/FluxIcon.png"); }
 
-		PushLayer(new EditorLayer()); 
+		PushLayer(new EditorLayer(nativeWindow, std::move(windowIcon)));
 		PushLayer(new SandboxLayer()); 
 	}
 	virtual ~FluxEditorApplication() override = default;
@@ -0,0 +1,3 @@
+#!/bin/sh
+# Linux: Requires premake5 on the PATH, then build with e.g. make FluxBenchmarks config=release
+premake5 gmake2
\ No newline at end of file
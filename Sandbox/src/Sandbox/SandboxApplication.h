@@ -20,7 +20,7 @@ public:
 		FLUX_INFO("Sandbox: {0}", event);
 	}
 
-	virtual void Update() override
+	virtual void Update(Flux::Timestep deltaTime) override
 	{
 		static bool once = true;
 
@@ -1,6 +1,6 @@
 ---@diagnostic disable: undefined-global, lowercase-global, undefined-field
 
--- Implementation Supports: Windows
+-- Implementation Supports: Windows, Linux (Flux and FluxBenchmarks Only)
 
 --[[Useful Commands List:
 cppdialect
@@ -33,6 +33,15 @@ function DirectoryExists(path)
     return os.rename(path, path) and os.isdir(path)
 end
 
+-- CMake Generator Arguments for the External Library Builds (Single Config Generators Need the Build Type Up Front)
+function CMakeGenerator(buildType)
+    if os.target() == "windows" then
+        return '-G "Visual Studio 17 2022" -A x64'
+    end
+
+    return '-DCMAKE_BUILD_TYPE=' .. buildType
+end
+
 workspace "Flux"
     architecture "x86_64" -- Only 64-Bit Systems are Supported
     configurations { "Debug", "Development", "Release" }
@@ -89,16 +98,21 @@ workspace "Flux"
             defines { "FLUX_PLATFORM_WINDOWS" }
         filter {}
 
+        -- Linux Specific Settings
+        filter "system:linux"
+            defines { "FLUX_PLATFORM_LINUX" }
+        filter {}
+
         -- Debug Configuration Settings
         filter "configurations:Debug"
-            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED" }
+            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
             symbols "On"
             runtime "Debug"
         filter {}
 
         -- Development Configuration Settings
         filter "configurations:Development"
-            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED" }
+            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
             symbols "On"
             runtime "Debug"
         filter {}
@@ -154,16 +168,21 @@ workspace "Flux"
             defines { "FLUX_PLATFORM_WINDOWS" }
         filter {}
 
+        -- Linux Specific Settings (Headless Only, e.g. --headless or --instances <count>)
+        filter "system:linux"
+            defines { "FLUX_PLATFORM_LINUX" }
+        filter {}
+
         -- Debug Configuration Settings
         filter "configurations:Debug"
-            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED" }
+            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
             symbols "On"
             runtime "Debug"
         filter {}
 
         -- Development Configuration Settings
         filter "configurations:Development"
-            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED" }
+            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
             symbols "On"
             runtime "Debug"
         filter {}
@@ -230,14 +249,14 @@ workspace "Flux"
 
         -- Debug Configuration Settings
         filter "configurations:Debug"
-            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED" }
+            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
             symbols "On"
             runtime "Debug"
         filter {}
 
         -- Development Configuration Settings
         filter "configurations:Development"
-            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED" }
+            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
             symbols "On"
             runtime "Debug"
         filter {}
@@ -249,4 +268,86 @@ workspace "Flux"
             runtime "Release"
         filter {}
 
-    dependson { "Sandbox", "Flux" }
\ No newline at end of file
+    dependson { "Sandbox", "Flux" }
+
+    -- Engine Micro-Benchmark Project
+    project "FluxBenchmarks"
+        location "FluxBenchmarks"
+        kind "ConsoleApp"
+        language "C++"
+        cppdialect "C++20"
+        staticruntime "On"
+
+        -- Build Directories
+        targetdir ("build/" .. builddir .. "/%{prj.name}")
+        objdir ("build-int/" .. builddir .. "/%{prj.name}")
+
+        -- Project Source Files
+        files { "%{prj.name}/src/**.h", "%{prj.name}/src/**.cpp" }
+
+        -- Include Directories
+        includedirs
+        {
+            "Flux/vendor/box2d/include",        -- 2D Physics Library
+            "Flux/vendor/entt/single_include",  -- Entity-Component-System Library
+            "Flux/vendor/sfml/include",         -- Simple and Fast Multimedia Library
+            "Flux/vendor/spdlog/include",       -- Logging Library
+            "Flux/vendor/yaml-cpp/include",     -- YAML Parser Library
+
+            "Flux/src",
+            "%{prj.name}/src"
+        }
+
+        -- Link to Flux Engine
+        links { "Flux" }
+
+        -- Global Defines
+        defines
+        {
+            "SFML_STATIC",
+            "SPDLOG_COMPILED_LIB", "SPDLOG_USE_STD_FORMAT",
+            "YAML_CPP_STATIC_DEFINE"
+        }
+
+        -- Windows Specific Settings
+        filter "system:windows"
+            systemversion "latest"
+            defines { "FLUX_PLATFORM_WINDOWS" }
+        filter {}
+
+        -- Linux Specific Settings (Static Libraries Don't Carry their Dependencies on Linux, so they're Linked Here)
+        filter "system:linux"
+            defines { "FLUX_PLATFORM_LINUX" }
+            links { "pthread", "dl" }
+            linkgroups "On"
+        filter {}
+
+        if os.target() == "linux" then
+            UseBOX2D()
+            UseSFML()
+            UseSPDLOG()
+            UseYAML()
+        end
+
+        -- Debug Configuration Settings
+        filter "configurations:Debug"
+            defines { "FLUX_DEBUG", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
+            symbols "On"
+            runtime "Debug"
+        filter {}
+
+        -- Development Configuration Settings
+        filter "configurations:Development"
+            defines { "FLUX_DEVELOPMENT", "FLUX_ASSERTS_ENABLED", "FLUX_PROFILING_ENABLED" }
+            symbols "On"
+            runtime "Debug"
+        filter {}
+
+        -- Release Configuration Settings (Benchmark Numbers are only Meaningful Here)
+        filter "configurations:Release"
+            defines { "FLUX_RELEASE" }
+            optimize "On"
+            runtime "Release"
+        filter {}
+
+    dependson { "Flux" }
\ No newline at end of file